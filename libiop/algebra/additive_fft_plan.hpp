@@ -0,0 +1,67 @@
+/**@file
+ *****************************************************************************
+ Precomputed data for the Gao-Mateer additive FFT/IFFT over a fixed affine
+ subspace.
+
+ Everything that depends only on the domain (the per-level twist factors and
+ the subset-sum tables used by the butterflies) is computed once, on first
+ use of each direction, and then shared by every transform over that domain.
+ Executing a plan transforms a vector in place and performs no allocations.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_ALGEBRA_ADDITIVE_FFT_PLAN_HPP_
+#define LIBIOP_ALGEBRA_ADDITIVE_FFT_PLAN_HPP_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace libiop {
+
+template<typename FieldT>
+class additive_fft_plan {
+protected:
+    std::vector<FieldT> basis_;
+    FieldT shift_;
+
+    /** Forward transform. twist_betas_[j] is the twist at level j, and the
+     *  subset sums for unwinding level j (2^j of them) start at offset 2^j - 1. */
+    mutable std::once_flag forward_built_;
+    mutable std::vector<FieldT> twist_betas_;
+    mutable std::vector<FieldT> unwind_sums_;
+
+    /** Inverse transform. inverse_twists_[j] is beta^{-1} at level j, and the
+     *  subset sums for level j (2^{m-1-j} of them) start at offset n - (n >> j). */
+    mutable std::once_flag inverse_built_;
+    mutable std::vector<FieldT> inverse_twists_;
+    mutable std::vector<FieldT> inverse_sums_;
+
+    void build_forward() const;
+    void build_inverse() const;
+public:
+    additive_fft_plan(const std::vector<FieldT> &basis, const FieldT &shift);
+
+    std::size_t dimension() const;
+    std::size_t num_elements() const;
+
+    /** Replaces the coefficients in data (of size num_elements()) with the
+     *  evaluations of that polynomial over the domain. */
+    void execute(std::vector<FieldT> &data) const;
+    /** As above, where only the first num_coefficients entries of data may
+     *  be non-zero. With d = num_coefficients rounded up to a power of 2,
+     *  the recursion only runs over the first d entries, and the first
+     *  log(n/d) unwinding levels reduce to replicating values, so the
+     *  transform costs O(n log d) rather than O(n log n). */
+    void execute(std::vector<FieldT> &data, const std::size_t num_coefficients) const;
+    /** Replaces the evaluations in data (of size num_elements()) with the
+     *  coefficients of the interpolating polynomial. */
+    void execute_inverse(std::vector<FieldT> &data) const;
+};
+
+} // namespace libiop
+
+#include "libiop/algebra/additive_fft_plan.tcc"
+
+#endif // LIBIOP_ALGEBRA_ADDITIVE_FFT_PLAN_HPP_
@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include <libff/common/utils.hpp>
+
+#include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+template<typename FieldT>
+additive_fft_plan<FieldT>::additive_fft_plan(const std::vector<FieldT> &basis, const FieldT &shift) :
+    basis_(basis),
+    shift_(shift)
+{
+}
+
+template<typename FieldT>
+std::size_t additive_fft_plan<FieldT>::dimension() const
+{
+    return this->basis_.size();
+}
+
+template<typename FieldT>
+std::size_t additive_fft_plan<FieldT>::num_elements() const
+{
+    return 1ull << this->basis_.size();
+}
+
+template<typename FieldT>
+void additive_fft_plan<FieldT>::build_forward() const
+{
+    const size_t n = this->num_elements();
+    const size_t m = this->dimension();
+
+    std::vector<FieldT> recursed_betas((m+1)*m/2, FieldT(0));
+    std::vector<FieldT> recursed_shifts(m, FieldT(0));
+    size_t recursed_betas_ptr = 0;
+
+    this->twist_betas_.resize(m);
+    std::vector<FieldT> betas2(this->basis_);
+    FieldT shift2 = this->shift_;
+    for (size_t j = 0; j < m; ++j)
+    {
+        const FieldT beta = betas2[m-1-j];
+        this->twist_betas_[j] = beta;
+
+        /* compute deltas used in the reverse process */
+        const FieldT betainv = beta.inverse();
+        for (size_t i = 0; i < m-1-j; ++i)
+        {
+            FieldT newbeta = betas2[i] * betainv;
+            recursed_betas[recursed_betas_ptr++] = newbeta;
+            betas2[i] = newbeta.squared() - newbeta;
+        }
+
+        FieldT newshift = shift2 * betainv;
+        recursed_shifts[j] = newshift;
+        shift2 = newshift.squared() - newshift;
+    }
+
+    this->unwind_sums_.resize(n - 1);
+    for (size_t j = 0; j < m; ++j)
+    {
+        recursed_betas_ptr -= j;
+        /* note that this devolves to empty range for the first level */
+        const std::vector<FieldT> popped_betas(recursed_betas.begin()+recursed_betas_ptr,
+                                               recursed_betas.begin()+recursed_betas_ptr+j);
+        const std::vector<FieldT> sums =
+            all_subset_sums<FieldT>(popped_betas, recursed_shifts[m-1-j]);
+        std::copy(sums.begin(), sums.end(), this->unwind_sums_.begin() + ((1ull<<j) - 1));
+    }
+    assert(recursed_betas_ptr == 0);
+}
+
+template<typename FieldT>
+void additive_fft_plan<FieldT>::build_inverse() const
+{
+    const size_t n = this->num_elements();
+    const size_t m = this->dimension();
+
+    this->inverse_twists_.resize(m);
+    this->inverse_sums_.resize(n - 1);
+
+    std::vector<FieldT> betas2(this->basis_);
+    FieldT shift2 = this->shift_;
+    for (size_t j = 0; j < m; ++j)
+    {
+        const FieldT beta = betas2[m-1-j];
+        const FieldT betainv = beta.inverse();
+        this->inverse_twists_[j] = betainv;
+
+        std::vector<FieldT> newbetas(m-1-j, FieldT(0));
+        for (size_t i = 0; i < m-1-j; ++i)
+        {
+            FieldT newbeta = betas2[i] * betainv;
+            newbetas[i] = newbeta;
+            betas2[i] = newbeta.squared() - newbeta;
+        }
+
+        FieldT newshift = shift2 * betainv;
+        shift2 = newshift.squared() - newshift;
+
+        const std::vector<FieldT> sums = all_subset_sums<FieldT>(newbetas, newshift);
+        std::copy(sums.begin(), sums.end(), this->inverse_sums_.begin() + (n - (n >> j)));
+    }
+}
+
+template<typename FieldT>
+void additive_fft_plan<FieldT>::execute(std::vector<FieldT> &S) const
+{
+    this->execute(S, S.size());
+}
+
+template<typename FieldT>
+void additive_fft_plan<FieldT>::execute(std::vector<FieldT> &S, const std::size_t num_coefficients) const
+{
+    const size_t n = this->num_elements();
+    const size_t m = this->dimension();
+    if (S.size() != n)
+    {
+        throw std::invalid_argument("additive_fft_plan: input size does not match domain size");
+    }
+    std::call_once(this->forward_built_, [this]() { this->build_forward(); });
+
+    /** All non-zero entries lie in [0, d). Twisting and radix conversion
+     *  only move values downwards within aligned blocks, so they stay in
+     *  [0, d). At levels j >= k the only block touching [0, d) is twisted by
+     *  beta^0 = 1 and every radix conversion stride is at least d, so those
+     *  levels do nothing at all. */
+    const size_t k = libff::log2(std::max<size_t>(std::min(num_coefficients, n), 1));
+    const size_t d = 1ull<<k;
+    /* Twisting d entries at each of the first k levels, and n/2 per unwinding level */
+    LIBIOP_TRACE_COUNT(FFT_points, n);
+    LIBIOP_TRACE_COUNT(field_multiplications, k * d + (m - k) * (n / 2));
+    for (size_t j = 0; j < k; ++j)
+    {
+        const FieldT beta = this->twist_betas_[j];
+        FieldT betai(1);
+
+        /* twist by beta. TODO: this can often be elided by a careful choice of betas */
+        for (size_t ofs = 0; ofs < d; ofs += (1ull<<j))
+        {
+            vector_scale(betai, &S[ofs], 1ull<<j);
+            betai *= beta;
+        }
+
+        /* perform radix conversion */
+        for (size_t stride = d/4; stride >= (1ul << j); stride >>= 1)
+        {
+            for (size_t ofs = 0; ofs < d; ofs += stride*4)
+            {
+                for (size_t i = 0; i < stride; ++i)
+                {
+                    S[ofs+2*stride+i] += S[ofs+3*stride+i];
+                    S[ofs+1*stride+i] += S[ofs+2*stride+i];
+                }
+            }
+        }
+    }
+
+    /** Bit-reversing over m bits sends position x < d to
+     *  bitreverse_k(x) * (n/d), and every other position holds zero. The
+     *  first m - k unwinding levels then just copy each of those values
+     *  across its block of n/d entries, so bit-reverse the first d entries
+     *  over k bits and fill the blocks directly. */
+    for (size_t x = 0; x < d; ++x)
+    {
+        const size_t rx = libff::bitreverse(x, k);
+        if (x < rx)
+        {
+            std::swap(S[x], S[rx]);
+        }
+    }
+    const size_t replication = n / d;
+    if (replication > 1)
+    {
+        for (size_t x = d; x--; )
+        {
+            std::fill(S.begin() + x * replication, S.begin() + (x + 1) * replication, S[x]);
+        }
+    }
+
+    /* unwind the recursion */
+    for (size_t j = m - k; j < m; ++j)
+    {
+        const FieldT *sums = &this->unwind_sums_[(1ull<<j) - 1];
+        const size_t stride = 1ull<<j;
+        for (size_t ofs = 0; ofs < n; ofs += 2*stride)
+        {
+            vector_pointwise_multiply_add(&S[ofs+stride], sums, &S[ofs], stride);
+            for (size_t i = 0; i < stride; ++i)
+            {
+                S[ofs+stride+i] += S[ofs+i];
+            }
+        }
+    }
+}
+
+template<typename FieldT>
+void additive_fft_plan<FieldT>::execute_inverse(std::vector<FieldT> &S) const
+{
+    const size_t n = this->num_elements();
+    const size_t m = this->dimension();
+    if (S.size() != n)
+    {
+        throw std::invalid_argument("additive_fft_plan: input size does not match domain size");
+    }
+    std::call_once(this->inverse_built_, [this]() { this->build_inverse(); });
+    /* n/2 per level for the sums and n per level for the twists */
+    LIBIOP_TRACE_COUNT(FFT_points, n);
+    LIBIOP_TRACE_COUNT(field_multiplications, m * (n / 2) + m * n);
+
+    for (size_t j = 0; j < m; ++j)
+    {
+        const FieldT *sums = &this->inverse_sums_[n - (n >> j)];
+        const size_t half = 1ull<<(m-1-j);
+        for (size_t ofs = 0; ofs < n; ofs += 2*half)
+        {
+            for (size_t p = 0; p < half; ++p)
+            {
+                S[ofs + half + p] += S[ofs + p];
+            }
+            vector_pointwise_multiply_add(&S[ofs + half], sums, &S[ofs], half);
+        }
+    }
+
+    bitreverse_vector<FieldT>(S);
+
+    for (size_t j = 0; j < m; ++j)
+    {
+        size_t N = 4ull<<(m-1-j);
+        /* perform radix combinations */
+        while (N <= n)
+        {
+            const size_t quarter = N/4;
+            for (size_t ofs = 0; ofs < n; ofs += N)
+            {
+                for (size_t i = 0; i < quarter; ++i)
+                {
+                    S[ofs+1*quarter+i] += S[ofs+2*quarter+i];
+                    S[ofs+2*quarter+i] += S[ofs+3*quarter+i];
+                }
+            }
+            N *= 2;
+        }
+
+        /* twist by \beta^{-1} */
+        const FieldT betainv = this->inverse_twists_[m-1-j];
+        FieldT betainvi(1);
+        for (size_t ofs = 0; ofs < n; ofs += (1ull<<(m-1-j)))
+        {
+            vector_scale(betainvi, &S[ofs], 1ull<<(m-1-j));
+            betainvi *= betainv;
+        }
+    }
+}
+
+} // namespace libiop
@@ -4,8 +4,11 @@
 #include <libfqfft/evaluation_domain/domains/basic_radix2_domain_aux.hpp>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/huge_pages.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/algebra/field_utils/field_utils.hpp>
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
 
 namespace libiop {
 
@@ -40,86 +43,11 @@ template<typename FieldT>
 std::vector<FieldT> additive_FFT(const std::vector<FieldT> &poly_coeffs,
                                  const affine_subspace<FieldT> &domain)
 {
-    std::vector<FieldT> S(poly_coeffs);
+    std::vector<FieldT> S;
+    reserve_oracle_buffer(S, domain.num_elements());
+    S.assign(poly_coeffs.begin(), poly_coeffs.end());
     S.resize(domain.num_elements(), FieldT::zero());
-
-    const size_t n = S.size();
-    const size_t m = domain.dimension();
-    assert(n == (1ull<<m));
-
-    std::vector<FieldT> recursed_betas((m+1)*m/2, FieldT(0));
-    std::vector<FieldT> recursed_shifts(m, FieldT(0));
-    size_t recursed_betas_ptr = 0;
-
-    std::vector<FieldT> betas2(domain.basis());
-    FieldT shift2 = domain.shift();
-    for (size_t j = 0; j < m; ++j)
-    {
-        FieldT beta = betas2[m-1-j];
-        FieldT betai(1);
-
-        /* twist by beta. TODO: this can often be elided by a careful choice of betas */
-        for (size_t ofs = 0; ofs < n; ofs += (1ull<<j))
-        {
-            for (size_t p = 0; p < (1ull<<j); ++p)
-            {
-                S[ofs + p] *= betai;
-            }
-
-            betai *= beta;
-        }
-
-        /* perform radix conversion */
-        for (size_t stride = n/4; stride >= (1ul << j); stride >>= 1)
-        {
-            for (size_t ofs = 0; ofs < n; ofs += stride*4)
-            {
-                for (size_t i = 0; i < stride; ++i)
-                {
-                    S[ofs+2*stride+i] += S[ofs+3*stride+i];
-                    S[ofs+1*stride+i] += S[ofs+2*stride+i];
-                }
-            }
-        }
-
-        /* compute deltas used in the reverse process */
-        FieldT betainv = beta.inverse();
-        for (size_t i = 0; i < m-1-j; ++i)
-        {
-            FieldT newbeta = betas2[i] * betainv;
-            recursed_betas[recursed_betas_ptr++] = newbeta;
-            betas2[i] = newbeta.squared() - newbeta;
-        }
-
-        FieldT newshift = shift2 * betainv;
-        recursed_shifts[j] = newshift;
-        shift2 = newshift.squared() - newshift;
-    }
-
-    bitreverse_vector<FieldT>(S);
-
-    /* unwind the recursion */
-    for (size_t j = 0; j < m; ++j)
-    {
-        recursed_betas_ptr -= j;
-        /* note that this devolves to empty range for the first loop iteration */
-        std::vector<FieldT> popped_betas = std::vector<FieldT>(recursed_betas.begin()+recursed_betas_ptr,
-                                                               recursed_betas.begin()+recursed_betas_ptr+j);
-        const FieldT popped_shift = recursed_shifts[m-1-j];
-        std::vector<FieldT> sums = all_subset_sums<FieldT>(popped_betas, popped_shift);
-
-        size_t stride = 1ull<<j;
-        for (size_t ofs = 0; ofs < n; ofs += 2*stride)
-        {
-            for (size_t i = 0; i < stride; ++i)
-            {
-                S[ofs+i] += S[ofs+stride+i] * sums[i];
-                S[ofs+stride+i] += S[ofs+i];
-            }
-        }
-    }
-    assert(recursed_betas_ptr == 0);
-
+    domain.fft_plan()->execute(S, poly_coeffs.size());
     return S;
 }
 
@@ -127,79 +55,11 @@ template<typename FieldT>
 std::vector<FieldT> additive_IFFT(const std::vector<FieldT> &evals,
                                   const affine_subspace<FieldT> &domain)
 {
-    const size_t n = evals.size();
-    const size_t m = domain.dimension();
-    assert(n == (1ull<<m));
-
-    std::vector<FieldT> S(evals);
-    std::vector<FieldT> recursed_twists(m, FieldT(0));
-
-    std::vector<FieldT> betas2(domain.basis());
-    FieldT shift2 = domain.shift();
-    for (size_t j = 0; j < m; ++j)
-    {
-        const FieldT beta = betas2[m-1-j];
-        const FieldT betainv = beta.inverse();
-        recursed_twists[j] = betainv;
-
-        std::vector<FieldT> newbetas(m-1-j, FieldT(0));
-
-        for (size_t i = 0; i < m-1-j; ++i)
-        {
-            FieldT newbeta = betas2[i] * betainv;
-            newbetas[i] = newbeta;
-            betas2[i] = newbeta.squared() - newbeta;
-        }
-
-        FieldT newshift = shift2 * betainv;
-        shift2 = newshift.squared() - newshift;
-
-        const std::vector<FieldT> sums = all_subset_sums<FieldT>(newbetas, newshift);
-
-        const size_t half = 1ull<<(m-1-j);
-        for (size_t ofs = 0; ofs < n; ofs += 2*half)
-        {
-            for (size_t p = 0; p < half; ++p)
-            {
-                S[ofs + half + p] += S[ofs + p];
-                S[ofs + p] += S[ofs + half + p] * sums[p];
-            }
-        }
-    }
-
-    bitreverse_vector<FieldT>(S);
-
-    for (size_t j = 0; j < m; ++j)
-    {
-        size_t N = 4ull<<(m-1-j);
-        /* perform radix combinations */
-        while (N <= n)
-        {
-            const size_t quarter = N/4;
-            for (size_t ofs = 0; ofs < n; ofs += N)
-            {
-                for (size_t i = 0; i < quarter; ++i)
-                {
-                    S[ofs+1*quarter+i] += S[ofs+2*quarter+i];
-                    S[ofs+2*quarter+i] += S[ofs+3*quarter+i];
-                }
-            }
-            N *= 2;
-        }
-
-        /* twist by \beta^{-1} */
-        const FieldT betainv = recursed_twists[m-1-j];
-        FieldT betainvi(1);
-        for (size_t ofs = 0; ofs < n; ofs += (1ull<<(m-1-j)))
-        {
-            for (size_t p = 0; p < (1ull<<(m-1-j)); ++p)
-            {
-                S[ofs + p] *= betainvi;
-            }
-            betainvi *= betainv;
-        }
-    }
-
+    assert(evals.size() == domain.num_elements());
+    std::vector<FieldT> S;
+    reserve_oracle_buffer(S, evals.size());
+    S.assign(evals.begin(), evals.end());
+    domain.fft_plan()->execute_inverse(S);
     return S;
 }
 
@@ -207,11 +67,11 @@ template<typename FieldT>
 std::vector<FieldT> additive_FFT_wrapper(const std::vector<FieldT> &v,
                                          const affine_subspace<FieldT> &H)
 {
-    libff::enter_block("Call to additive_FFT_wrapper");
+    LIBIOP_TRACE_BEGIN("Call to additive_FFT_wrapper");
     libff::print_indent(); printf("* Vector size: %zu\n", v.size());
     libff::print_indent(); printf("* Subspace size: %zu\n", H.num_elements());
     const std::vector<FieldT> result = additive_FFT(v, H);
-    libff::leave_block("Call to additive_FFT_wrapper");
+    LIBIOP_TRACE_END("Call to additive_FFT_wrapper");
     return result;
 }
 
@@ -219,11 +79,11 @@ template<typename FieldT>
 std::vector<FieldT> additive_IFFT_wrapper(const std::vector<FieldT> &v,
                                           const affine_subspace<FieldT> &H)
 {
-    libff::enter_block("Call to additive_IFFT_wrapper");
+    LIBIOP_TRACE_BEGIN("Call to additive_IFFT_wrapper");
     libff::print_indent(); printf("* Vector size: %zu\n", v.size());
     libff::print_indent(); printf("* Subspace size: %zu\n", H.num_elements());
     const std::vector<FieldT> result = additive_IFFT(v, H);
-    libff::leave_block("Call to additive_IFFT_wrapper");
+    LIBIOP_TRACE_END("Call to additive_IFFT_wrapper");
     return result;
 }
 
@@ -232,16 +92,24 @@ std::vector<FieldT> additive_IFFT_wrapper(const std::vector<FieldT> &v,
  *  It performs / utilizes precomputation on the subgroup to save time.
  *  It also makes the FFT O(N * ceil(log_2(d))) instead of O(N * log(N))
  *  The libfqfft implementation uses pseudocode from [CLRS 2n Ed, pp. 864].
+ *
+ *  This version transforms the coefficients held in a in place, growing a to
+ *  the size of the coset, so that callers doing many FFTs can reuse a buffer.
  */
 template<typename FieldT>
-std::vector<FieldT> multiplicative_FFT_degree_aware(const std::vector<FieldT> &poly_coeffs,
-                                                    const multiplicative_subgroup_base<FieldT> &coset,
-                                                    const FieldT &shift)
+void multiplicative_FFT_degree_aware_in_place(std::vector<FieldT> &a,
+                                              const multiplicative_subgroup_base<FieldT> &coset,
+                                              const FieldT &shift)
 {
-    assert(poly_coeffs.size() <= coset.num_elements());
+    assert(a.size() <= coset.num_elements());
     const size_t n = coset.num_elements(), logn = libff::log2(n);
+    const size_t poly_dimension = libff::log2(a.size());
+    const size_t poly_size = a.size();
+    /* The coset shift, then n/2 butterflies for each round that is not skipped below */
+    LIBIOP_TRACE_COUNT(FFT_points, n);
+    LIBIOP_TRACE_COUNT(field_multiplications,
+                       (shift != FieldT::one() ? poly_size : 0) + n / 2 * poly_dimension);
 
-    std::vector<FieldT> a(poly_coeffs);
     /** If there is a coset shift x, the degree i term of the polynomial is multiplied by x^i */
     if (shift != FieldT::one())
     {
@@ -249,8 +117,6 @@ std::vector<FieldT> multiplicative_FFT_degree_aware(const std::vector<FieldT> &p
     }
     a.resize(n, FieldT::zero());
 
-    const size_t poly_dimension = libff::log2(poly_coeffs.size());
-    const size_t poly_size = poly_coeffs.size();
     /** When the polynomial is of size k*|coset|, for k < 2^i,
      *  the first i iterations of Cooley Tukey are easily predictable.
      *  This is because they will be combining g(w^2) + wh(w^2), but g or h will always refer
@@ -301,18 +167,24 @@ std::vector<FieldT> multiplicative_FFT_degree_aware(const std::vector<FieldT> &p
         asm volatile  ("/* pre-inner */");
         for (size_t k = 0; k < n; k += 2*m)
         {
-            for (size_t j = 0; j < m; ++j)
-            {
-                /** fft_cache[w_index_base + j] is w_m^j
-                 *  t = w*h(w^2) up to a sign difference in w */
-                const FieldT t = fft_cache[w_index_base + j] * a[k+j+m];
-                a[k+j+m] = a[k+j] - t;
-                a[k+j] += t;
-            }
+            /** fft_cache[w_index_base + j] is w_m^j
+             *  t = w*h(w^2) up to a sign difference in w */
+            vector_butterfly(&fft_cache[w_index_base], &a[k], &a[k+m], m);
         }
         asm volatile ("/* post-inner */");
         m *= 2;
     }
+}
+
+template<typename FieldT>
+std::vector<FieldT> multiplicative_FFT_degree_aware(const std::vector<FieldT> &poly_coeffs,
+                                                    const multiplicative_subgroup_base<FieldT> &coset,
+                                                    const FieldT &shift)
+{
+    std::vector<FieldT> a;
+    reserve_oracle_buffer(a, coset.num_elements());
+    a.assign(poly_coeffs.begin(), poly_coeffs.end());
+    multiplicative_FFT_degree_aware_in_place<FieldT>(a, coset, shift);
     return a;
 }
 
@@ -346,10 +218,17 @@ std::vector<FieldT> multiplicative_IFFT_internal(
     const multiplicative_subgroup_base<FieldT> &domain, const FieldT shift)
 {
     assert(domain.num_elements() == evals.size());
+    const size_t n = domain.num_elements();
+    /* n/2 butterflies per round, scaling by 1/n, and undoing the coset shift */
+    LIBIOP_TRACE_COUNT(FFT_points, n);
+    LIBIOP_TRACE_COUNT(field_multiplications,
+                       n / 2 * libff::log2(n) + n + (shift != FieldT::one() ? n : 0));
 
     libfqfft::basic_radix2_domain<FieldT> eval_domain = domain.FFT_eval_domain();
 
-    std::vector<FieldT> vec = evals;
+    std::vector<FieldT> vec;
+    reserve_oracle_buffer(vec, n);
+    vec.assign(evals.begin(), evals.end());
     // Handle separately, as icosetFFT requires more multiplications
     if (shift == FieldT::one()) {
         eval_domain.iFFT(vec);
@@ -379,11 +258,11 @@ template<typename FieldT>
 std::vector<FieldT> multiplicative_FFT_wrapper(const std::vector<FieldT> &v,
                                                const multiplicative_coset<FieldT> &H)
 {
-    libff::enter_block("Call to multiplicative_FFT_wrapper");
+    LIBIOP_TRACE_BEGIN("Call to multiplicative_FFT_wrapper");
     libff::print_indent(); printf("* Vector size: %zu\n", v.size());
     libff::print_indent(); printf("* Subgroup size: %zu\n", H.num_elements());
     const std::vector<FieldT> result = multiplicative_FFT(v, H);
-    libff::leave_block("Call to multiplicative_FFT_wrapper");
+    LIBIOP_TRACE_END("Call to multiplicative_FFT_wrapper");
     return result;
 }
 
@@ -391,16 +270,16 @@ template<typename FieldT>
 std::vector<FieldT> multiplicative_IFFT_wrapper(const std::vector<FieldT> &v,
                                                 const multiplicative_coset<FieldT> &H)
 {
-    libff::enter_block("Call to multiplicative_IFFT_wrapper");
+    LIBIOP_TRACE_BEGIN("Call to multiplicative_IFFT_wrapper");
     libff::print_indent(); printf("* Vector size: %zu\n", v.size());
     libff::print_indent(); printf("* Coset size: %zu\n", H.num_elements());
     if (v.size() == 1)
     {
-        libff::leave_block("Call to multiplicative_IFFT_wrapper");
+        LIBIOP_TRACE_END("Call to multiplicative_IFFT_wrapper");
         return {v[0]};
     }
     const std::vector<FieldT> result = multiplicative_IFFT(v, H);
-    libff::leave_block("Call to multiplicative_IFFT_wrapper");
+    LIBIOP_TRACE_END("Call to multiplicative_IFFT_wrapper");
     return result;
 }
 
@@ -190,6 +190,7 @@ std::vector<size_t> field_subset<FieldT>::all_positions_in_coset_i(
 {
     /* TODO: If we need more performance we can make direct methods for these. */
     std::vector<size_t> positions;
+    positions.reserve(coset_size);
     for (size_t i = 0; i < coset_size; i++)
     {
         positions.emplace_back(this->position_by_coset_indices(coset_index, i, coset_size));
@@ -15,6 +15,8 @@
 #endif
 
 #include <cstddef>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <cstdint>
 #include <libfqfft/evaluation_domain/get_evaluation_domain.hpp>
@@ -29,6 +31,8 @@ class multiplicative_subgroup_base {
 protected:
     std::shared_ptr<std::vector<FieldT>> elems_;
     std::shared_ptr<std::vector<FieldT>> fft_cache_;
+    /* Guards the lazy fill of fft_cache_, which is shared between copies of this subgroup */
+    std::shared_ptr<std::once_flag> fft_cache_once_;
 
     FieldT g_;
     size_t order_; // FIX 1: Replaced non-standard u_long with size_t
@@ -66,6 +66,7 @@ void multiplicative_subgroup_base<FieldT>::construct_internal(
 
     this->elems_ = std::make_shared<std::vector<FieldT> >();
     this->fft_cache_ = std::make_shared<std::vector<FieldT> >();
+    this->fft_cache_once_ = std::make_shared<std::once_flag>();
     this->order_ = static_cast<size_t>(order.as_ulong());
 
     if (libff::is_power_of_2(this->order_) && this->order_ > 1)
@@ -116,11 +117,14 @@ std::size_t multiplicative_subgroup_base<FieldT>::num_elements() const
 
 
 /** The FFT cache is the set of elements within the field organized in a
- * a cache friendly way, for the multiplicative FFT access pattern. */
+ * a cache friendly way, for the multiplicative FFT access pattern.
+ * It is filled on first use, under a once flag shared by all copies of the subgroup,
+ * as concurrent FFTs over one domain, such as the Fractal indexer's low degree
+ * extensions, may all be the first to use it. */
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> multiplicative_subgroup_base<FieldT>::fft_cache() const
 {
-    if (this->fft_cache_->empty()) {
+    std::call_once(*this->fft_cache_once_, [this]() {
         /** The elements placed in the cache are all the unique powers
          * of g^m,
          * for m in the set {order / 2, order / 4, order / 8 ... }
@@ -142,7 +146,7 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_subgroup_base<FieldT>::fft_c
             m *= 2;
         }
         this->fft_cache_->swap(elems);
-    }
+    });
     return this->fft_cache_;
 }
 
@@ -9,9 +9,12 @@
 #define LIBIOP_ALGEBRA_SUBSPACES_HPP_
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 #include <libff/algebra/field_utils/field_utils.hpp>
 
+#include "libiop/algebra/additive_fft_plan.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -51,6 +54,9 @@ template<typename FieldT>
 class affine_subspace : public linear_subspace<FieldT> {
 protected:
     FieldT shift_;
+    /** Shared between copies, so that every transform over this domain
+     *  reuses the same precomputation. */
+    std::shared_ptr<additive_fft_plan<FieldT>> fft_plan_;
 
 public:
     affine_subspace() = default;
@@ -59,6 +65,7 @@ public:
     affine_subspace(linear_subspace<FieldT> &&base_space, const FieldT &shift = FieldT(0));
 
     const FieldT shift() const;
+    std::shared_ptr<additive_fft_plan<FieldT>> fft_plan() const;
 
     std::vector<FieldT> all_elements() const;
     FieldT element_by_index(const std::size_t index) const;
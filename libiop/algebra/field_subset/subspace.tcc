@@ -131,6 +131,7 @@ affine_subspace<FieldT>::affine_subspace(const std::vector<FieldT> &basis,
                                          const FieldT &shift) :
     linear_subspace<FieldT>(basis), shift_(shift)
 {
+    this->fft_plan_ = std::make_shared<additive_fft_plan<FieldT>>(this->basis_, this->shift_);
 }
 
 template<typename FieldT>
@@ -140,6 +141,7 @@ affine_subspace<FieldT>::affine_subspace(
     linear_subspace<FieldT>(base_space),
     shift_(shift)
 {
+    this->fft_plan_ = std::make_shared<additive_fft_plan<FieldT>>(this->basis_, this->shift_);
 }
 
 template<typename FieldT>
@@ -149,6 +151,7 @@ affine_subspace<FieldT>::affine_subspace(
     linear_subspace<FieldT>(std::move(base_space)),
     shift_(shift)
 {
+    this->fft_plan_ = std::make_shared<additive_fft_plan<FieldT>>(this->basis_, this->shift_);
 }
 
 template<typename FieldT>
@@ -157,6 +160,18 @@ const FieldT affine_subspace<FieldT>::shift() const
     return this->shift_;
 }
 
+/** Default-constructed subspaces have no shared plan, so they get a fresh
+ *  one on every call. */
+template<typename FieldT>
+std::shared_ptr<additive_fft_plan<FieldT>> affine_subspace<FieldT>::fft_plan() const
+{
+    if (this->fft_plan_ == nullptr)
+    {
+        return std::make_shared<additive_fft_plan<FieldT>>(this->basis_, this->shift_);
+    }
+    return this->fft_plan_;
+}
+
 template<typename FieldT>
 std::vector<FieldT> affine_subspace<FieldT>::all_elements() const
 {
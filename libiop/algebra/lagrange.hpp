@@ -24,6 +24,13 @@ private:
     void construct_internal(const multiplicative_coset<FieldT> &domain);
     std::vector<FieldT> subspace_coefficients_for(const FieldT &interpolation_point);
     std::vector<FieldT> coset_coefficients_for(const FieldT &interpolation_point);
+    /* For every interpolation point outside the domain, L_i(x) = scale(x) / denominator_i(x).
+     * Returns all of these denominators, inverted with a single batch inversion and laid out
+     * point by point. Points inside the domain get no denominators and are flagged in in_domain. */
+    template<typename Allocator>
+    std::vector<FieldT> inverse_denominators_for(const std::vector<FieldT, Allocator> &interpolation_points,
+                                                 std::vector<FieldT> &scales,
+                                                 std::vector<bool> &in_domain) const;
 protected:
     const field_subset<FieldT> domain_;
     const vanishing_polynomial<FieldT> vp_;
@@ -51,6 +58,17 @@ public:
                    const bool cache_evaluations = false,
                    const bool interpolation_domain_intersects_domain = false);
     std::vector<FieldT> coefficients_for(const FieldT &interpolation_point);
+    /** Coefficients for several interpolation points, e.g. all queried points of a verifier,
+     *  sharing one batch inversion. result[j] holds the coefficients for interpolation_points[j]. */
+    std::vector<std::vector<FieldT>> coefficients_for(const std::vector<FieldT> &interpolation_points);
+    /** Evaluates at every interpolation point each polynomial of degree < |domain| given by its
+     *  evaluations over the domain (missing trailing evaluations are zero). This is the barycentric
+     *  form sum_i y_i L_i(x), which needs O(|domain|) work per point and never materializes the
+     *  coefficient vectors. result[k][j] is polynomial k at interpolation_points[j]. */
+    template<typename Allocator>
+    std::vector<std::vector<FieldT>> interpolate_at_points(
+        const std::vector<std::vector<FieldT>> &evaluations,
+        const std::vector<FieldT, Allocator> &interpolation_points);
 };
 
 template<typename FieldT>
@@ -161,6 +161,144 @@ std::vector<FieldT> lagrange_cache<FieldT>::coefficients_for(
     return result;
 }
 
+template<typename FieldT>
+template<typename Allocator>
+std::vector<FieldT> lagrange_cache<FieldT>::inverse_denominators_for(
+    const std::vector<FieldT, Allocator> &interpolation_points,
+    std::vector<FieldT> &scales,
+    std::vector<bool> &in_domain) const
+{
+    const size_t m = this->domain_.num_elements();
+    scales.resize(interpolation_points.size());
+    in_domain.assign(interpolation_points.size(), false);
+
+    std::vector<FieldT> denominators;
+    denominators.reserve(interpolation_points.size() * m);
+    if (this->domain_.type() == affine_subspace_type)
+    {
+        /* L_i(x) = Z(x) * c / (x - V_i), see subspace_coefficients_for */
+        for (size_t j = 0; j < interpolation_points.size(); j++)
+        {
+            const FieldT &x = interpolation_points[j];
+            scales[j] = this->vp_.evaluation_at_point(x) * this->c_;
+            if (this->interpolation_domain_intersects_domain_ && scales[j] == FieldT::zero())
+            {
+                in_domain[j] = true;
+                continue;
+            }
+            const std::vector<FieldT> V =
+                all_subset_sums<FieldT>(this->domain_.basis(), x + this->domain_.shift());
+            denominators.insert(denominators.end(), V.begin(), V.end());
+        }
+    }
+    else if (this->domain_.type() == multiplicative_coset_type)
+    {
+        /* L_i(x) = Z(x) / (v_i^{-1} * (x - h g^i)), see coset_coefficients_for.
+         * The domain elements are computed once for all points. */
+        const std::vector<FieldT> domain_elements = this->domain_.all_elements();
+        for (size_t j = 0; j < interpolation_points.size(); j++)
+        {
+            const FieldT &x = interpolation_points[j];
+            scales[j] = libff::power(x, m) + this->vp_.constant_coefficient();
+            if (this->interpolation_domain_intersects_domain_ && scales[j] == FieldT::zero())
+            {
+                in_domain[j] = true;
+                continue;
+            }
+            for (size_t i = 0; i < m; i++)
+            {
+                denominators.emplace_back(this->v_inv_[i] * (x - domain_elements[i]));
+            }
+        }
+    }
+
+    if (denominators.empty())
+    {
+        return denominators;
+    }
+    return batch_inverse(denominators);
+}
+
+template<typename FieldT>
+std::vector<std::vector<FieldT>> lagrange_cache<FieldT>::coefficients_for(
+    const std::vector<FieldT> &interpolation_points)
+{
+    const size_t m = this->domain_.num_elements();
+    std::vector<FieldT> scales;
+    std::vector<bool> in_domain;
+    const std::vector<FieldT> inverses =
+        this->inverse_denominators_for(interpolation_points, scales, in_domain);
+
+    std::vector<std::vector<FieldT>> result(interpolation_points.size());
+    size_t offset = 0;
+    for (size_t j = 0; j < interpolation_points.size(); j++)
+    {
+        if (in_domain[j])
+        {
+            result[j] = this->coefficients_for(interpolation_points[j]);
+            continue;
+        }
+        result[j].reserve(m);
+        for (size_t i = 0; i < m; i++)
+        {
+            result[j].emplace_back(inverses[offset + i] * scales[j]);
+        }
+        offset += m;
+    }
+    return result;
+}
+
+template<typename FieldT>
+template<typename Allocator>
+std::vector<std::vector<FieldT>> lagrange_cache<FieldT>::interpolate_at_points(
+    const std::vector<std::vector<FieldT>> &evaluations,
+    const std::vector<FieldT, Allocator> &interpolation_points)
+{
+    const size_t m = this->domain_.num_elements();
+    for (const std::vector<FieldT> &evals : evaluations)
+    {
+        if (evals.size() > m)
+        {
+            throw std::invalid_argument("More evaluations were provided than the domain has elements.");
+        }
+    }
+
+    std::vector<FieldT> scales;
+    std::vector<bool> in_domain;
+    const std::vector<FieldT> inverses =
+        this->inverse_denominators_for(interpolation_points, scales, in_domain);
+
+    std::vector<std::vector<FieldT>> result(
+        evaluations.size(), std::vector<FieldT>(interpolation_points.size(), FieldT::zero()));
+    size_t offset = 0;
+    for (size_t j = 0; j < interpolation_points.size(); j++)
+    {
+        if (in_domain[j])
+        {
+            const std::vector<FieldT> coefficients = this->coefficients_for(interpolation_points[j]);
+            for (size_t k = 0; k < evaluations.size(); k++)
+            {
+                for (size_t i = 0; i < evaluations[k].size(); i++)
+                {
+                    result[k][j] += coefficients[i] * evaluations[k][i];
+                }
+            }
+            continue;
+        }
+        for (size_t k = 0; k < evaluations.size(); k++)
+        {
+            FieldT sum = FieldT::zero();
+            for (size_t i = 0; i < evaluations[k].size(); i++)
+            {
+                sum += inverses[offset + i] * evaluations[k][i];
+            }
+            result[k][j] = sum * scales[j];
+        }
+        offset += m;
+    }
+    return result;
+}
+
 template<typename FieldT>
 std::vector<FieldT> lagrange_coefficients(const field_subset<FieldT> &domain,
                                           const FieldT &interpolation_point)
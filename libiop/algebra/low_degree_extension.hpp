@@ -0,0 +1,42 @@
+/**@file
+ *****************************************************************************
+ Low degree extension of evaluations from a small domain onto a larger one,
+ with an optional zero knowledge mask vanishing on the small domain.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_ALGEBRA_LOW_DEGREE_EXTENSION_HPP_
+#define LIBIOP_ALGEBRA_LOW_DEGREE_EXTENSION_HPP_
+
+#include <vector>
+
+#include "libiop/algebra/field_subset/field_subset.hpp"
+#include "libiop/algebra/polynomials/polynomial.hpp"
+
+namespace libiop {
+
+/** Returns the evaluations over large_domain of
+ *      f(X) + Z_{small_domain}(X) * mask(X),
+ *  where f is the polynomial of degree < |small_domain| interpolating evals
+ *  over small_domain. The mask defaults to zero.
+ *
+ *  For multiplicative cosets, large_domain is split into cosets of the
+ *  order |small_domain| subgroup. Z_{small_domain} is constant on each of
+ *  these, so the masked polynomial is folded to |small_domain| coefficients
+ *  per coset and evaluated with one small FFT, without ever forming a
+ *  zero-padded transform of size |large_domain|. If there is no mask and the
+ *  cosets outnumber their elements, a single degree-aware FFT over
+ *  large_domain is done instead. For affine subspaces the
+ *  mask is added in coefficient form and a single degree-aware FFT is done. */
+template<typename FieldT>
+std::vector<FieldT> low_degree_extend(const std::vector<FieldT> &evals,
+                                      const field_subset<FieldT> &small_domain,
+                                      const field_subset<FieldT> &large_domain,
+                                      const polynomial<FieldT> &mask = polynomial<FieldT>());
+
+} // namespace libiop
+
+#include "libiop/algebra/low_degree_extension.tcc"
+
+#endif // LIBIOP_ALGEBRA_LOW_DEGREE_EXTENSION_HPP_
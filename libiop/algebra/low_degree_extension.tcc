@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <libff/algebra/field_utils/field_utils.hpp>
+#include "libiop/algebra/fft.hpp"
+#include "libiop/algebra/polynomials/vanishing_polynomial.hpp"
+#include "libiop/common/huge_pages.hpp"
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+template<typename FieldT>
+std::vector<FieldT> low_degree_extend_internal(
+    const std::vector<typename libff::enable_if<libff::is_multiplicative<FieldT>::value, FieldT>::type> &evals,
+    const field_subset<FieldT> &small_domain,
+    const field_subset<FieldT> &large_domain,
+    const polynomial<FieldT> &mask)
+{
+    const size_t small_size = small_domain.num_elements();
+    const size_t large_size = large_domain.num_elements();
+    const size_t num_cosets = large_size / small_size;
+
+    std::vector<FieldT> coefficients = IFFT_over_field_subset<FieldT>(evals, small_domain);
+    /** Z(X) = X^s - h^s for the small coset's shift h, so
+     *  Z(X) * mask(X) = X^s * mask(X) - h^s * mask(X). */
+    if (mask.num_terms() > 0)
+    {
+        if (small_size + mask.num_terms() > large_size)
+        {
+            throw std::invalid_argument("low_degree_extend: masked polynomial does not fit in the large domain");
+        }
+        const FieldT small_shift_to_s = libff::power(small_domain.shift(), small_size);
+        coefficients.resize(small_size + mask.num_terms(), FieldT::zero());
+        for (size_t i = 0; i < mask.num_terms(); ++i)
+        {
+            coefficients[i + small_size] += mask[i];
+            coefficients[i] -= small_shift_to_s * mask[i];
+        }
+    }
+
+    const multiplicative_coset<FieldT> large_coset = large_domain.coset();
+    const size_t num_blocks = (coefficients.size() + small_size - 1) / small_size;
+    /** With at most one block there is nothing to fold. When there are also
+     *  more cosets than points per coset, the coset FFTs are too small to pay
+     *  for their setup, so evaluate over the whole large domain at once. */
+    if (num_blocks <= 1 && num_cosets > small_size)
+    {
+        LIBIOP_TRACE_COUNT(field_multiplications, mask.num_terms());
+        return multiplicative_FFT_degree_aware<FieldT>(coefficients, large_coset, large_coset.shift());
+    }
+
+    /** The j-th coset is c_j * <g^{num_cosets}> with c_j = shift * g^j, and its
+     *  t-th element is at position j + num_cosets * t of large_domain. */
+    const FieldT g = large_coset.generator();
+    const FieldT g_to_s = libff::power(g, small_size);
+    const multiplicative_subgroup<FieldT> subgroup(small_size, libff::power(g, num_cosets));
+    /* Build the twiddle table here rather than have every coset's thread wait
+       on whichever one reaches fft_cache() first. */
+    subgroup.fft_cache();
+
+    /* Folding the blocks on every coset; the IFFT and coset FFTs count their own */
+    LIBIOP_TRACE_COUNT(field_multiplications,
+                       mask.num_terms() + (num_blocks > 1 ? num_cosets * small_size * num_blocks : 0));
+    /* Every coset writes across the whole result, so it is first touched on this thread */
+    std::vector<FieldT> result;
+    reserve_oracle_buffer(result, large_size);
+    result.resize(large_size);
+    /** Each thread takes one contiguous range of cosets, so for every t its
+     *  writes to result[j + num_cosets * t] form a run of adjacent elements,
+     *  and threads only share the cache lines at the ends of their runs. */
+#ifdef MULTICORE
+#pragma omp parallel
+#endif
+    {
+        std::vector<FieldT> folded;
+        folded.reserve(small_size);
+        FieldT c;
+        FieldT c_to_s;
+        size_t next_j = num_cosets;
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+        for (size_t j = 0; j < num_cosets; ++j)
+        {
+            /* c and c^s are stepped by g and g^s along a thread's range */
+            if (j != next_j)
+            {
+                c = large_coset.shift() * libff::power(g, j);
+                c_to_s = libff::power(c, small_size);
+            }
+            next_j = j + 1;
+
+            /** On this coset X^s = c^s, so fold the coefficients of block q
+             *  onto block 0 with weight (c^s)^q, by Horner's rule over blocks. */
+            if (num_blocks <= 1)
+            {
+                folded.assign(coefficients.begin(), coefficients.end());
+            }
+            else
+            {
+                folded.assign(small_size, FieldT::zero());
+                for (size_t q = num_blocks; q--; )
+                {
+                    const size_t block_end = std::min(coefficients.size(), (q + 1) * small_size);
+                    for (size_t t = 0; t < small_size; ++t)
+                    {
+                        folded[t] *= c_to_s;
+                        if (q * small_size + t < block_end)
+                        {
+                            folded[t] += coefficients[q * small_size + t];
+                        }
+                    }
+                }
+            }
+
+            multiplicative_FFT_degree_aware_in_place<FieldT>(folded, subgroup, c);
+            for (size_t t = 0; t < small_size; ++t)
+            {
+                result[j + num_cosets * t] = folded[t];
+            }
+
+            c *= g;
+            c_to_s *= g_to_s;
+        }
+    }
+
+    return result;
+}
+
+template<typename FieldT>
+std::vector<FieldT> low_degree_extend_internal(
+    const std::vector<typename libff::enable_if<libff::is_additive<FieldT>::value, FieldT>::type> &evals,
+    const field_subset<FieldT> &small_domain,
+    const field_subset<FieldT> &large_domain,
+    const polynomial<FieldT> &mask)
+{
+    polynomial<FieldT> f(IFFT_over_field_subset<FieldT>(evals, small_domain));
+    if (mask.num_terms() > 0)
+    {
+        const vanishing_polynomial<FieldT> small_vp(small_domain);
+        f += small_vp * mask;
+        if (f.num_terms() > large_domain.num_elements())
+        {
+            throw std::invalid_argument("low_degree_extend: masked polynomial does not fit in the large domain");
+        }
+    }
+    return FFT_over_field_subset<FieldT>(f.coefficients(), large_domain);
+}
+
+template<typename FieldT>
+std::vector<FieldT> low_degree_extend(const std::vector<FieldT> &evals,
+                                      const field_subset<FieldT> &small_domain,
+                                      const field_subset<FieldT> &large_domain,
+                                      const polynomial<FieldT> &mask)
+{
+    if (small_domain.type() != large_domain.type())
+    {
+        throw std::invalid_argument("low_degree_extend: domains must be of the same type");
+    }
+    if (small_domain.num_elements() > large_domain.num_elements())
+    {
+        throw std::invalid_argument("low_degree_extend: small domain is larger than the large domain");
+    }
+    if (evals.size() != small_domain.num_elements())
+    {
+        throw std::invalid_argument("low_degree_extend: expected one evaluation per small domain element");
+    }
+    return low_degree_extend_internal<FieldT>(evals, small_domain, large_domain, mask);
+}
+
+} // namespace libiop
@@ -44,6 +44,11 @@ public:
     explicit polynomial(std::vector<FieldT> &&coefficients);
 
     FieldT evaluation_at_point(const FieldT &evalpoint) const;
+    /** Horner's rule run on all points together, so each coefficient is read once
+     *  and the per-point multiplications are independent. The result uses the
+     *  same allocator as evalpoints. */
+    template<typename Allocator>
+    std::vector<FieldT, Allocator> evaluations_at_points(const std::vector<FieldT, Allocator> &evalpoints) const;
     std::vector<FieldT> evaluations_over_field_subset(const field_subset<FieldT> &S) const;
 
     void reserve(const std::size_t degree_bound);
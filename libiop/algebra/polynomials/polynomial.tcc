@@ -2,6 +2,7 @@
 
 #include "libiop/algebra/field_subset/field_subset.hpp"
 #include "libiop/algebra/fft.hpp"
+#include "libiop/algebra/utils.hpp"
 
 namespace libiop {
 
@@ -108,6 +109,25 @@ FieldT polynomial<FieldT>::evaluation_at_point(const FieldT &evalpoint) const
     return result;
 }
 
+template<typename FieldT>
+template<typename Allocator>
+std::vector<FieldT, Allocator> polynomial<FieldT>::evaluations_at_points(
+    const std::vector<FieldT, Allocator> &evalpoints) const
+{
+    std::vector<FieldT, Allocator> result(evalpoints.size(), FieldT(0), evalpoints.get_allocator());
+
+    for (auto it = this->coefficients_.rbegin(); it != this->coefficients_.rend(); ++it)
+    {
+        for (std::size_t i = 0; i < evalpoints.size(); ++i)
+        {
+            result[i] *= evalpoints[i];
+            result[i] += (*it);
+        }
+    }
+
+    return result;
+}
+
 template<typename FieldT>
 std::vector<FieldT> polynomial<FieldT>::evaluations_over_field_subset(const field_subset<FieldT> &S) const
 {
@@ -232,14 +252,7 @@ polynomial<FieldT> polynomial<FieldT>::random_polynomial(const size_t degree_bou
 {
     /* Can't use bytewise random_vector<FieldT> because that will give invalid elements
         for libff prime fields. */
-    std::vector<FieldT> random_coefficients;
-    random_coefficients.reserve(degree_bound);
-    for (size_t i = 0; i < degree_bound; ++i)
-    {
-        random_coefficients.emplace_back(FieldT::random_element());
-    }
-
-    return polynomial<FieldT>(std::move(random_coefficients));
+    return polynomial<FieldT>(random_FieldT_vector<FieldT>(degree_bound));
 }
 
 } // namespace libiop
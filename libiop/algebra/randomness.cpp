@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+#include <sodium/core.h>
+#include <sodium/crypto_generichash.h>
+#include <sodium/crypto_stream_chacha20.h>
+#include <sodium/randombytes.h>
+#include <sodium/utils.h>
+
+#include "libiop/algebra/randomness.hpp"
+
+namespace libiop {
+
+namespace {
+
+/* Each chunk is generated on its own, starting from its block offset in the ChaCha20 stream,
+ * so the output does not depend on the number of threads. */
+const std::size_t random_chunk_size = 1ull << 20; /* 1 MB */
+const std::size_t chacha20_block_size = 64;
+
+static_assert(sizeof(randomness_seed_state::key) == crypto_stream_chacha20_KEYBYTES,
+              "the seed is used as a ChaCha20 key");
+/* The seed in force on this thread, see set_randomness_seed */
+thread_local randomness_seed_state current_seed;
+
+void chacha20_stream(unsigned char *buf,
+                     const std::size_t size,
+                     const unsigned char *nonce,
+                     const unsigned char *key)
+{
+    const std::size_t num_chunks = (size + random_chunk_size - 1) / random_chunk_size;
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (std::size_t i = 0; i < num_chunks; ++i)
+    {
+        const std::size_t start = i * random_chunk_size;
+        const std::size_t length = std::min(random_chunk_size, size - start);
+        std::memset(buf + start, 0, length);
+        crypto_stream_chacha20_xor_ic(buf + start, buf + start, length,
+                                      nonce, start / chacha20_block_size, key);
+    }
+}
+
+} // namespace
+
+void random_bytes(void *buf, const std::size_t size)
+{
+    static std::once_flag sodium_initialized;
+    std::call_once(sodium_initialized, []() {
+        if (sodium_init() < 0)
+        {
+            throw std::runtime_error("libsodium could not be initialized");
+        }
+    });
+    if (size == 0)
+    {
+        return;
+    }
+
+    unsigned char key[crypto_stream_chacha20_KEYBYTES];
+    unsigned char nonce[crypto_stream_chacha20_NONCEBYTES] = {0};
+    if (current_seed.is_seeded)
+    {
+        /* Every call gets its own stream, numbered in the order of the calls */
+        std::memcpy(key, current_seed.key, sizeof(key));
+        const uint64_t stream = current_seed.next_stream++;
+        for (std::size_t i = 0; i < sizeof(nonce); ++i)
+        {
+            nonce[i] = (unsigned char)(stream >> (8 * i));
+        }
+    }
+    else
+    {
+        randombytes_buf(key, sizeof(key));
+    }
+
+    chacha20_stream(static_cast<unsigned char*>(buf), size, nonce, key);
+    sodium_memzero(key, sizeof(key));
+}
+
+void set_randomness_seed(const std::string &seed)
+{
+    crypto_generichash(current_seed.key, sizeof(current_seed.key),
+                       reinterpret_cast<const unsigned char*>(seed.data()), seed.size(),
+                       NULL, 0);
+    current_seed.next_stream = 0;
+    current_seed.is_seeded = true;
+}
+
+void clear_randomness_seed()
+{
+    sodium_memzero(current_seed.key, sizeof(current_seed.key));
+    current_seed.next_stream = 0;
+    current_seed.is_seeded = false;
+}
+
+scoped_randomness_seed::scoped_randomness_seed(const std::string &seed) :
+    enclosing_seed_(current_seed)
+{
+    set_randomness_seed(seed);
+}
+
+scoped_randomness_seed::~scoped_randomness_seed()
+{
+    current_seed = this->enclosing_seed_;
+    sodium_memzero(this->enclosing_seed_.key, sizeof(this->enclosing_seed_.key));
+}
+
+} // namespace libiop
@@ -0,0 +1,73 @@
+/**@file
+ *****************************************************************************
+ Bulk sampling of random bytes and field elements.
+
+ Randomness is expanded with ChaCha20 from a 256-bit key, in 1 MB chunks
+ which are generated in parallel under MULTICORE. By default every call draws
+ a fresh key from libsodium's system CSPRNG. After set_randomness_seed, keys
+ are instead derived from the seed, so that a fixed sequence of calls yields
+ the same randomness; this is meant for reproducible benchmarking only. The
+ seed is per thread, so concurrent provers can be seeded independently.
+
+ Binary field elements are filled directly with random bytes. Prime field
+ elements (libff::Fp_model) are sampled by rejection on their Montgomery
+ limbs, which is uniform since Montgomery form is a bijection. Other fields
+ fall back to FieldT::random_element().
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_ALGEBRA_RANDOMNESS_HPP_
+#define LIBIOP_ALGEBRA_RANDOMNESS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <libff/algebra/field_utils/field_utils.hpp>
+#include <libff/algebra/fields/prime_base/fp.hpp>
+
+namespace libiop {
+
+/** Fills buf with size random bytes. */
+void random_bytes(void *buf, const std::size_t size);
+
+/** Makes all subsequent randomness requested on the calling thread a
+ *  deterministic function of seed, and of the order in which it is requested. */
+void set_randomness_seed(const std::string &seed);
+void clear_randomness_seed();
+
+/* The seed key and the number of streams drawn from it so far */
+struct randomness_seed_state {
+    bool is_seeded = false;
+    unsigned char key[32] = {};
+    uint64_t next_stream = 0;
+};
+
+/** Seeds the randomness of the calling thread for the lifetime of this object,
+ *  e.g. a single proof, after which the enclosing seed, if any, is restored
+ *  along with its position in the sequence of calls. */
+class scoped_randomness_seed {
+protected:
+    randomness_seed_state enclosing_seed_;
+public:
+    explicit scoped_randomness_seed(const std::string &seed);
+    ~scoped_randomness_seed();
+
+    scoped_randomness_seed(const scoped_randomness_seed &) = delete;
+    scoped_randomness_seed &operator=(const scoped_randomness_seed &) = delete;
+};
+
+/** Fills elements[0, count) with uniformly random field elements. */
+template<typename FieldT>
+void random_field_elements(FieldT *elements, const std::size_t count);
+
+template<mp_size_t N, const libff::bigint<N>& modulus>
+void random_field_elements(libff::Fp_model<N, modulus> *elements, const std::size_t count);
+
+} // namespace libiop
+
+#include "libiop/algebra/randomness.tcc"
+
+#endif // LIBIOP_ALGEBRA_RANDOMNESS_HPP_
@@ -0,0 +1,48 @@
+#include <algorithm>
+
+namespace libiop {
+
+template<typename FieldT>
+void random_field_elements(FieldT *elements, const std::size_t count)
+{
+    if (libff::is_additive<FieldT>::value)
+    {
+        /* Every bit pattern is a valid binary field element */
+        random_bytes(elements, count * sizeof(FieldT));
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        elements[i] = FieldT::random_element();
+    }
+}
+
+template<mp_size_t N, const libff::bigint<N>& modulus>
+void random_field_elements(libff::Fp_model<N, modulus> *elements, const std::size_t count)
+{
+    /* Candidates are masked to the bit length of the modulus, so each is accepted with probability over 1/2 */
+    const std::size_t top_limb_bits = modulus.num_bits() - (N - 1) * GMP_NUMB_BITS;
+    const mp_limb_t top_limb_mask = (top_limb_bits >= GMP_NUMB_BITS) ?
+        ~mp_limb_t(0) : ((mp_limb_t(1) << top_limb_bits) - 1);
+
+    std::vector<mp_limb_t> candidates;
+    std::size_t filled = 0;
+    while (filled < count)
+    {
+        const std::size_t num_candidates = count - filled;
+        candidates.resize(num_candidates * N);
+        random_bytes(candidates.data(), candidates.size() * sizeof(mp_limb_t));
+        for (std::size_t i = 0; i < num_candidates; ++i)
+        {
+            mp_limb_t *limbs = &candidates[i * N];
+            limbs[N - 1] &= top_limb_mask;
+            if (mpn_cmp(limbs, modulus.data, N) < 0)
+            {
+                std::copy(limbs, limbs + N, elements[filled].mont_repr.data);
+                ++filled;
+            }
+        }
+    }
+}
+
+} // namespace libiop
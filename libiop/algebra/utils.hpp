@@ -25,6 +25,10 @@ void bitreverse_vector(std::vector<T> &a);
 template<typename T>
 std::vector<T> random_vector(const std::size_t count);
 
+/** Unlike random_vector, this produces valid elements for prime fields too. */
+template<typename FieldT>
+std::vector<FieldT> random_FieldT_vector(const std::size_t count);
+
 template<typename T>
 std::vector<T> all_subset_sums(const std::vector<T> &basis, const T& shift = 0)
 #if defined(__clang__)
@@ -33,11 +37,13 @@ std::vector<T> all_subset_sums(const std::vector<T> &basis, const T& shift = 0)
     __attribute__((optimize("unroll-loops")));
 #endif
 
-template<typename FieldT>
-std::vector<FieldT> batch_inverse(const std::vector<FieldT> &vec, const bool has_zeroes=false);
+/** The result uses the same allocator as vec, e.g. a temporary_vector's arena. */
+template<typename FieldT, typename Allocator>
+std::vector<FieldT, Allocator> batch_inverse(const std::vector<FieldT, Allocator> &vec, const bool has_zeroes=false);
 
-template<typename FieldT>
-std::vector<FieldT> batch_inverse_and_mul(const std::vector<FieldT> &vec, const FieldT &k, const bool has_zeroes=false);
+/** The result uses the same allocator as vec, e.g. a temporary_vector's arena. */
+template<typename FieldT, typename Allocator>
+std::vector<FieldT, Allocator> batch_inverse_and_mul(const std::vector<FieldT, Allocator> &vec, const FieldT &k, const bool has_zeroes=false);
 
 template<typename FieldT>
 void mut_batch_inverse(std::vector<FieldT> &vec);
@@ -1,7 +1,7 @@
 #include <cassert>
-#include <sodium/randombytes.h>
 
 #include <libff/common/utils.hpp>
+#include "libiop/algebra/randomness.hpp"
 
 namespace libiop {
 
@@ -29,20 +29,20 @@ std::vector<T> all_subset_sums(const std::vector<T> &basis, const T& shift)
     return result;
 }
 
-template<typename FieldT>
-std::vector<FieldT> batch_inverse(const std::vector<FieldT> &vec, const bool has_zeroes)
+template<typename FieldT, typename Allocator>
+std::vector<FieldT, Allocator> batch_inverse(const std::vector<FieldT, Allocator> &vec, const bool has_zeroes)
 {
     return batch_inverse_and_mul(vec, FieldT::one(), has_zeroes);
 }
 
-template<typename FieldT>
-std::vector<FieldT> batch_inverse_and_mul_internal(const std::vector<FieldT> &vec, const FieldT &k)
+template<typename FieldT, typename Allocator>
+std::vector<FieldT, Allocator> batch_inverse_and_mul_internal(const std::vector<FieldT, Allocator> &vec, const FieldT &k)
 {
     /** Montgomery batch inversion trick.
      *  This assumes that all elements of the input are non-zero.
      *  It also multiplies every element by k, which can be done with one multiplication.
      */
-    std::vector<FieldT> R;
+    std::vector<FieldT, Allocator> R(vec.get_allocator());
     R.reserve(vec.size());
 
     FieldT c = vec[0];
@@ -68,8 +68,8 @@ std::vector<FieldT> batch_inverse_and_mul_internal(const std::vector<FieldT> &ve
     return R;
 }
 
-template<typename FieldT>
-std::vector<FieldT> batch_inverse_and_mul(const std::vector<FieldT> &vec, const FieldT &k, const bool has_zeroes)
+template<typename FieldT, typename Allocator>
+std::vector<FieldT, Allocator> batch_inverse_and_mul(const std::vector<FieldT, Allocator> &vec, const FieldT &k, const bool has_zeroes)
 {
     /** Montgomery batch inversion trick.
      *  This wraps the internal batch inverse and mul to handle 0's.
@@ -78,7 +78,7 @@ std::vector<FieldT> batch_inverse_and_mul(const std::vector<FieldT> &vec, const
      *  We omit this optimization, as has_zeroes=false in the verifiers code path. */
     if (has_zeroes)
     {
-        std::vector<FieldT> vec_copy(vec);
+        std::vector<FieldT, Allocator> vec_copy(vec);
         std::vector<size_t> zero_locations;
         FieldT zero = FieldT::zero();
         for (std::size_t i = 0; i < vec.size(); i++)
@@ -89,7 +89,7 @@ std::vector<FieldT> batch_inverse_and_mul(const std::vector<FieldT> &vec, const
                 vec_copy[i] = FieldT::one();
             }
         }
-        std::vector<FieldT> result = batch_inverse_and_mul_internal(vec_copy, k);
+        std::vector<FieldT, Allocator> result = batch_inverse_and_mul_internal(vec_copy, k);
         for (std::size_t i = 0; i < zero_locations.size(); i++)
         {
             result[zero_locations[i]] = zero;
@@ -163,7 +163,7 @@ std::vector<T> random_vector(const std::size_t count)
 {
     std::vector<T> result(count);
 
-    randombytes_buf(result.data(), count * sizeof(T));
+    random_bytes(result.data(), count * sizeof(T));
 
     return result;
 }
@@ -171,11 +171,8 @@ std::vector<T> random_vector(const std::size_t count)
 template<typename FieldT>
 std::vector<FieldT> random_FieldT_vector(const std::size_t count)
 {
-    std::vector<FieldT> result;
-    result.reserve(count);
-    for (std::size_t i = 0; i < count; i++) {
-        result.emplace_back(FieldT::random_element());
-    }
+    std::vector<FieldT> result(count);
+    random_field_elements(result.data(), count);
 
     return result;
 }
@@ -0,0 +1,213 @@
+#include <cstdint>
+#include <type_traits>
+
+#ifdef USE_ASM
+#include <immintrin.h>
+#endif
+
+#include "libiop/algebra/vector_ops.hpp"
+
+namespace libiop {
+
+#ifdef USE_ASM
+
+namespace {
+
+static_assert(sizeof(libff::gf64) == sizeof(uint64_t), "gf64 is expected to be a single machine word");
+static_assert(std::is_standard_layout<libff::gf64>::value, "gf64 is expected to be standard layout");
+
+/* x^64 = x^4 + x^3 + x + 1 modulo the gf64 defining polynomial */
+const long long gf64_reduction_polynomial = 0b11011;
+
+inline const uint64_t *gf64_words(const libff::gf64 *x)
+{
+    return reinterpret_cast<const uint64_t*>(x);
+}
+
+inline uint64_t *gf64_words(libff::gf64 *x)
+{
+    return reinterpret_cast<uint64_t*>(x);
+}
+
+inline __m128i load2(const uint64_t *p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void store2(uint64_t *p, const __m128i v)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+/* Reduces two unreduced 128-bit carry-less products at once, returning them
+   in the low and high lanes respectively. The first fold leaves at most 4
+   bits above x^64, so a second fold finishes the job. */
+inline __m128i reduce2(const __m128i p0, const __m128i p1)
+{
+    const __m128i poly = _mm_set_epi64x(0, gf64_reduction_polynomial);
+    const __m128i hi = _mm_unpackhi_epi64(p0, p1);
+    const __m128i lo = _mm_unpacklo_epi64(p0, p1);
+    const __m128i t0 = _mm_clmulepi64_si128(hi, poly, 0x00);
+    const __m128i t1 = _mm_clmulepi64_si128(hi, poly, 0x01);
+    const __m128i t_hi = _mm_unpackhi_epi64(t0, t1);
+    const __m128i t_lo = _mm_unpacklo_epi64(t0, t1);
+    const __m128i u0 = _mm_clmulepi64_si128(t_hi, poly, 0x00);
+    const __m128i u1 = _mm_clmulepi64_si128(t_hi, poly, 0x01);
+    return _mm_xor_si128(_mm_xor_si128(lo, t_lo), _mm_unpacklo_epi64(u0, u1));
+}
+
+/* Lane-wise product of two pairs of gf64 elements */
+inline __m128i mul2(const __m128i a, const __m128i b)
+{
+    return reduce2(_mm_clmulepi64_si128(a, b, 0x00),
+                   _mm_clmulepi64_si128(a, b, 0x11));
+}
+
+} // namespace
+
+void vector_scale(const libff::gf64 &a, libff::gf64 *x, const std::size_t n)
+{
+    const __m128i av = _mm_set1_epi64x(gf64_words(&a)[0]);
+    uint64_t *xw = gf64_words(x);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i r0 = mul2(av, load2(xw + i));
+        const __m128i r1 = mul2(av, load2(xw + i + 2));
+        store2(xw + i, r0);
+        store2(xw + i + 2, r1);
+    }
+    for (; i < n; ++i)
+    {
+        x[i] *= a;
+    }
+}
+
+void vector_axpy(const libff::gf64 &a, const libff::gf64 *x, libff::gf64 *y, const std::size_t n)
+{
+    const __m128i av = _mm_set1_epi64x(gf64_words(&a)[0]);
+    const uint64_t *xw = gf64_words(x);
+    uint64_t *yw = gf64_words(y);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i r0 = mul2(av, load2(xw + i));
+        const __m128i r1 = mul2(av, load2(xw + i + 2));
+        store2(yw + i, _mm_xor_si128(load2(yw + i), r0));
+        store2(yw + i + 2, _mm_xor_si128(load2(yw + i + 2), r1));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] += a * x[i];
+    }
+}
+
+void vector_pointwise_multiply(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n)
+{
+    const uint64_t *xw = gf64_words(x);
+    const uint64_t *yw = gf64_words(y);
+    uint64_t *zw = gf64_words(z);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i r0 = mul2(load2(xw + i), load2(yw + i));
+        const __m128i r1 = mul2(load2(xw + i + 2), load2(yw + i + 2));
+        store2(zw + i, r0);
+        store2(zw + i + 2, r1);
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+}
+
+void vector_pointwise_multiply_add(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n)
+{
+    const uint64_t *xw = gf64_words(x);
+    const uint64_t *yw = gf64_words(y);
+    uint64_t *zw = gf64_words(z);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i r0 = mul2(load2(xw + i), load2(yw + i));
+        const __m128i r1 = mul2(load2(xw + i + 2), load2(yw + i + 2));
+        store2(zw + i, _mm_xor_si128(load2(zw + i), r0));
+        store2(zw + i + 2, _mm_xor_si128(load2(zw + i + 2), r1));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+}
+
+libff::gf64 vector_dot_product(const libff::gf64 *x, const libff::gf64 *y, const std::size_t n)
+{
+    const uint64_t *xw = gf64_words(x);
+    const uint64_t *yw = gf64_words(y);
+
+    /* Reduction is linear, so accumulate unreduced 128-bit products in four
+       independent chains and reduce once at the end. */
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    __m128i acc2 = _mm_setzero_si128();
+    __m128i acc3 = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i x0 = load2(xw + i);
+        const __m128i y0 = load2(yw + i);
+        const __m128i x1 = load2(xw + i + 2);
+        const __m128i y1 = load2(yw + i + 2);
+        acc0 = _mm_xor_si128(acc0, _mm_clmulepi64_si128(x0, y0, 0x00));
+        acc1 = _mm_xor_si128(acc1, _mm_clmulepi64_si128(x0, y0, 0x11));
+        acc2 = _mm_xor_si128(acc2, _mm_clmulepi64_si128(x1, y1, 0x00));
+        acc3 = _mm_xor_si128(acc3, _mm_clmulepi64_si128(x1, y1, 0x11));
+    }
+    for (; i < n; ++i)
+    {
+        acc0 = _mm_xor_si128(acc0, _mm_clmulepi64_si128(
+            _mm_cvtsi64_si128(xw[i]), _mm_cvtsi64_si128(yw[i]), 0x00));
+    }
+
+    const __m128i acc = _mm_xor_si128(_mm_xor_si128(acc0, acc1), _mm_xor_si128(acc2, acc3));
+    const __m128i reduced = reduce2(acc, _mm_setzero_si128());
+    libff::gf64 result;
+    gf64_words(&result)[0] = static_cast<uint64_t>(_mm_cvtsi128_si64(reduced));
+    return result;
+}
+
+#else
+
+void vector_scale(const libff::gf64 &a, libff::gf64 *x, const std::size_t n)
+{
+    vector_scale<libff::gf64>(a, x, n);
+}
+
+void vector_axpy(const libff::gf64 &a, const libff::gf64 *x, libff::gf64 *y, const std::size_t n)
+{
+    vector_axpy<libff::gf64>(a, x, y, n);
+}
+
+void vector_pointwise_multiply(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n)
+{
+    vector_pointwise_multiply<libff::gf64>(x, y, z, n);
+}
+
+void vector_pointwise_multiply_add(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n)
+{
+    vector_pointwise_multiply_add<libff::gf64>(x, y, z, n);
+}
+
+libff::gf64 vector_dot_product(const libff::gf64 *x, const libff::gf64 *y, const std::size_t n)
+{
+    return vector_dot_product<libff::gf64>(x, y, n);
+}
+
+#endif // USE_ASM
+
+} // namespace libiop
@@ -0,0 +1,65 @@
+/**@file
+ *****************************************************************************
+ Elementwise kernels over contiguous arrays of field elements.
+
+ The generic versions are plain loops. gf64 has non-template overloads which,
+ when built with USE_ASM, compute several carry-less products at once with
+ PCLMULQDQ and (for dot products) reduce only once at the end. Callers should
+ invoke these with deduced template arguments so that the overloads are
+ picked up.
+
+ The kernels run inside the FFT loops, so they leave the
+ field_multiplications trace counter alone. The FFTs and low degree
+ extensions that call them count their multiplications once per call.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_ALGEBRA_VECTOR_OPS_HPP_
+#define LIBIOP_ALGEBRA_VECTOR_OPS_HPP_
+
+#include <cstddef>
+
+#include <libff/algebra/fields/binary/gf64.hpp>
+
+namespace libiop {
+
+/** x[i] *= a */
+template<typename FieldT>
+void vector_scale(const FieldT &a, FieldT *x, const std::size_t n);
+
+/** y[i] += a * x[i] */
+template<typename FieldT>
+void vector_axpy(const FieldT &a, const FieldT *x, FieldT *y, const std::size_t n);
+
+/** z[i] = x[i] * y[i]. z may alias x or y. */
+template<typename FieldT>
+void vector_pointwise_multiply(const FieldT *x, const FieldT *y, FieldT *z, const std::size_t n);
+
+/** z[i] += x[i] * y[i] */
+template<typename FieldT>
+void vector_pointwise_multiply_add(const FieldT *x, const FieldT *y, FieldT *z, const std::size_t n);
+
+/** sum_i x[i] * y[i] */
+template<typename FieldT>
+FieldT vector_dot_product(const FieldT *x, const FieldT *y, const std::size_t n);
+
+/** x[i] = x[i]^2 */
+template<typename FieldT>
+void vector_square(FieldT *x, const std::size_t n);
+
+/** Radix-2 butterflies: t = w[i] * hi[i]; hi[i] = lo[i] - t; lo[i] += t */
+template<typename FieldT>
+void vector_butterfly(const FieldT *w, FieldT *lo, FieldT *hi, const std::size_t n);
+
+void vector_scale(const libff::gf64 &a, libff::gf64 *x, const std::size_t n);
+void vector_axpy(const libff::gf64 &a, const libff::gf64 *x, libff::gf64 *y, const std::size_t n);
+void vector_pointwise_multiply(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n);
+void vector_pointwise_multiply_add(const libff::gf64 *x, const libff::gf64 *y, libff::gf64 *z, const std::size_t n);
+libff::gf64 vector_dot_product(const libff::gf64 *x, const libff::gf64 *y, const std::size_t n);
+
+} // namespace libiop
+
+#include "libiop/algebra/vector_ops.tcc"
+
+#endif // LIBIOP_ALGEBRA_VECTOR_OPS_HPP_
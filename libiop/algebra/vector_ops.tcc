@@ -0,0 +1,70 @@
+namespace libiop {
+
+template<typename FieldT>
+void vector_scale(const FieldT &a, FieldT *x, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] *= a;
+    }
+}
+
+template<typename FieldT>
+void vector_axpy(const FieldT &a, const FieldT *x, FieldT *y, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] += a * x[i];
+    }
+}
+
+template<typename FieldT>
+void vector_pointwise_multiply(const FieldT *x, const FieldT *y, FieldT *z, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+}
+
+template<typename FieldT>
+void vector_pointwise_multiply_add(const FieldT *x, const FieldT *y, FieldT *z, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+}
+
+template<typename FieldT>
+FieldT vector_dot_product(const FieldT *x, const FieldT *y, const std::size_t n)
+{
+    FieldT result = FieldT::zero();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+template<typename FieldT>
+void vector_square(FieldT *x, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = x[i].squared();
+    }
+}
+
+template<typename FieldT>
+void vector_butterfly(const FieldT *w, FieldT *lo, FieldT *hi, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const FieldT t = w[i] * hi[i];
+        hi[i] = lo[i] - t;
+        lo[i] += t;
+    }
+}
+
+} // namespace libiop
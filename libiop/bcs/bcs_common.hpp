@@ -13,6 +13,7 @@
 #include <map>
 #include <vector>
 
+#include "libiop/common/huge_pages.hpp"
 #include "libiop/iop/iop.hpp"
 #include "libiop/bcs/hashing/hashing.hpp"
 #include "libiop/bcs/hashing/hash_enum.hpp"
@@ -31,6 +32,9 @@ struct bcs_transformation_parameters {
     std::shared_ptr<hashchain<FieldT, MT_hash_type>> hashchain_;
     std::shared_ptr<leafhash<FieldT, MT_hash_type>> leafhasher_;
     two_to_one_hash_function<MT_hash_type> compression_hasher;
+
+    /* Backing of the prover's codeword-sized buffers, see libiop/common/huge_pages.hpp */
+    oracle_page_policy oracle_page_policy_ = oracle_page_policy::default_pages;
 };
 
 template<typename FieldT, typename MT_hash_type>
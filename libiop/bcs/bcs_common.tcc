@@ -5,6 +5,7 @@
 #include <libff/common/profiling.hpp>
 
 #include "libiop/algebra/fft.hpp"
+#include "libiop/common/memory_accounting.hpp"
 
 namespace libiop {
 
@@ -786,6 +787,12 @@ void print_detailed_transcript_data(
     libff::print_indent(); printf("* Argument size in bytes (BCS, no pruning): %zu\n", transcript.BCS_size_in_bytes_without_pruning());
     libff::print_indent(); printf("* Argument size in bytes (total, no pruning): %zu\n", transcript.size_in_bytes_without_pruning());
 
+    if (memory_accounting_enabled())
+    {
+        printf("\nThe prover's heap memory, by phase, was as follows:\n");
+        print_memory_phase_report();
+    }
+
     printf("\n");
     printf("total prover messages size: %lu\n", total_prover_message_size);
     const size_t total_two_to_one_hashes = std::accumulate(
@@ -0,0 +1,67 @@
+/**@file
+ *****************************************************************************
+ Binary on-disk format for the BCS prover and verifier indices.
+
+ Indexing is the most expensive step of a holographic SNARK, and only depends
+ on the constraint system, so the indices are written once and then loaded by
+ every prover / verifier process. Arrays are aligned within the file, and a
+ loaded prover index keeps the file mapped into memory and views its index
+ oracle evaluations, Merkle tree salts and field element Merkle tree nodes
+ in place. So these are only paged in as they are used, and are shared
+ between all processes which load the same file. Binary hash digests and the
+ small prover messages are copied out of the file.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_SNARK_COMMON_BCS_INDEX_SERIALIZATION_HPP_
+#define LIBIOP_SNARK_COMMON_BCS_INDEX_SERIALIZATION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "libiop/bcs/bcs_common.hpp"
+#include "libiop/common/binary_io.hpp"
+
+namespace libiop {
+
+/** Field elements are stored in their in-memory representation,
+ *  so index files are only portable between builds using the same field
+ *  implementation and endianness. The header records enough about the field
+ *  for this to be checked when loading. */
+template<typename FieldT, typename MT_hash_type>
+void write_bcs_prover_index(std::ostream &out,
+                            const bcs_prover_index<FieldT, MT_hash_type> &index);
+
+template<typename FieldT, typename MT_hash_type>
+void write_bcs_verifier_index(std::ostream &out,
+                              const bcs_verifier_index<FieldT, MT_hash_type> &index);
+
+template<typename FieldT, typename MT_hash_type>
+void save_bcs_prover_index(const std::string &path,
+                           const bcs_prover_index<FieldT, MT_hash_type> &index);
+
+template<typename FieldT, typename MT_hash_type>
+void save_bcs_verifier_index(const std::string &path,
+                             const bcs_verifier_index<FieldT, MT_hash_type> &index);
+
+/** The Merkle trees in the prover index are rebuilt with the hash functions
+ *  from the given parameters, which must match the ones used when indexing.
+ *  The file must not be modified while the index, or any copy of it, is in use. */
+template<typename FieldT, typename MT_hash_type>
+bcs_prover_index<FieldT, MT_hash_type> load_bcs_prover_index(
+    const std::string &path,
+    const bcs_transformation_parameters<FieldT, MT_hash_type> &parameters);
+
+template<typename FieldT, typename MT_hash_type>
+bcs_verifier_index<FieldT, MT_hash_type> load_bcs_verifier_index(
+    const std::string &path);
+
+} // namespace libiop
+
+#include "libiop/bcs/bcs_index_serialization.tcc"
+
+#endif // LIBIOP_SNARK_COMMON_BCS_INDEX_SERIALIZATION_HPP_
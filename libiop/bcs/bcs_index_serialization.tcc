@@ -0,0 +1,249 @@
+#include <fstream>
+#include <stdexcept>
+
+#include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+const char bcs_index_magic[8] = {'L', 'I', 'O', 'P', 'I', 'D', 'X', '\0'};
+const std::uint32_t bcs_index_format_version = 2;
+
+enum bcs_index_kind {
+    bcs_prover_index_kind = 1,
+    bcs_verifier_index_kind = 2
+};
+
+/** The header stores the size of a field element and the representation of one.
+ *  The latter differs between prime fields with different moduli,
+ *  as they are stored in Montgomery form. */
+template<typename FieldT>
+void write_bcs_index_header(std::ostream &out, const bcs_index_kind kind)
+{
+    out.write(bcs_index_magic, sizeof(bcs_index_magic));
+    write_value<std::uint32_t>(out, bcs_index_format_version);
+    write_value<std::uint32_t>(out, (std::uint32_t)kind);
+    write_value<std::uint64_t>(out, sizeof(FieldT));
+    write_value<FieldT>(out, FieldT::one());
+}
+
+template<typename FieldT>
+void read_bcs_index_header(byte_reader &in, const bcs_index_kind kind)
+{
+    char magic[sizeof(bcs_index_magic)];
+    in.read(magic, sizeof(magic));
+    if (std::memcmp(magic, bcs_index_magic, sizeof(magic)) != 0)
+    {
+        throw std::invalid_argument("Not a libiop index file.");
+    }
+    if (in.read_value<std::uint32_t>() != bcs_index_format_version)
+    {
+        throw std::invalid_argument("Unsupported index file version.");
+    }
+    if (in.read_value<std::uint32_t>() != (std::uint32_t)kind)
+    {
+        throw std::invalid_argument("Index file contains a different kind of index.");
+    }
+    if (in.read_value<std::uint64_t>() != sizeof(FieldT) ||
+        in.read_value<FieldT>() != FieldT::one())
+    {
+        throw std::invalid_argument("Index file was written for a different field.");
+    }
+}
+
+template<typename FieldT>
+void write_Field_Elem_vec_binary(std::ostream &out, const FieldT *data, const std::size_t size)
+{
+    write_value<std::uint64_t>(out, size);
+    write_aligned_array<FieldT>(out, data, size);
+}
+
+template<typename FieldT>
+void write_Field_Elem_vec_binary(std::ostream &out, const std::vector<FieldT> &v)
+{
+    write_Field_Elem_vec_binary<FieldT>(out, v.data(), v.size());
+}
+
+template<typename FieldT>
+shared_buffer<FieldT> read_Field_Elem_buffer_binary(byte_reader &in,
+                                                    const std::shared_ptr<const void> &owner)
+{
+    const std::uint64_t size = in.read_value<std::uint64_t>();
+    return read_aligned_array<FieldT>(in, owner, size);
+}
+
+template<typename FieldT>
+void read_Field_Elem_vec_binary(byte_reader &in, std::vector<FieldT> &v)
+{
+    const shared_buffer<FieldT> contents = read_Field_Elem_buffer_binary<FieldT>(in, nullptr);
+    v.assign(contents.begin(), contents.end());
+}
+
+template<typename FieldT>
+void write_Field_Elem_vec_of_vec_binary(std::ostream &out, const std::vector<std::vector<FieldT>> &v)
+{
+    write_value<std::uint64_t>(out, v.size());
+    for (const std::vector<FieldT> &vec : v)
+    {
+        write_Field_Elem_vec_binary<FieldT>(out, vec);
+    }
+}
+
+template<typename FieldT>
+void read_Field_Elem_vec_of_vec_binary(byte_reader &in, std::vector<std::vector<FieldT>> &v)
+{
+    const std::uint64_t size = in.read_value<std::uint64_t>();
+    v.clear();
+    for (std::uint64_t i = 0; i < size; i++)
+    {
+        std::vector<FieldT> vec;
+        read_Field_Elem_vec_binary<FieldT>(in, vec);
+        v.emplace_back(std::move(vec));
+    }
+}
+
+template<typename FieldT>
+void write_Field_Elem_buffers_binary(std::ostream &out,
+                                     const std::vector<shared_buffer<FieldT>> &v)
+{
+    write_value<std::uint64_t>(out, v.size());
+    for (const shared_buffer<FieldT> &buffer : v)
+    {
+        write_Field_Elem_vec_binary<FieldT>(out, buffer.data(), buffer.size());
+    }
+}
+
+/* The buffers view the input in place if owner keeps it alive, see read_aligned_array */
+template<typename FieldT>
+void read_Field_Elem_buffers_binary(byte_reader &in,
+                                    const std::shared_ptr<const void> &owner,
+                                    std::vector<shared_buffer<FieldT>> &v)
+{
+    const std::uint64_t size = in.read_value<std::uint64_t>();
+    v.clear();
+    for (std::uint64_t i = 0; i < size; i++)
+    {
+        v.emplace_back(read_Field_Elem_buffer_binary<FieldT>(in, owner));
+    }
+}
+
+template<typename FieldT, typename MT_hash_type>
+void write_bcs_prover_index(std::ostream &out,
+                            const bcs_prover_index<FieldT, MT_hash_type> &index)
+{
+    write_bcs_index_header<FieldT>(out, bcs_prover_index_kind);
+    write_value<std::uint64_t>(out, index.index_MTs_.size());
+    for (const merkle_tree<FieldT, MT_hash_type> &MT : index.index_MTs_)
+    {
+        MT.write_binary(out);
+    }
+    write_Field_Elem_vec_of_vec_binary<FieldT>(out, index.indexed_messages_);
+    write_Field_Elem_buffers_binary<FieldT>(out, index.iop_index_.all_oracle_evals_);
+    write_Field_Elem_vec_of_vec_binary<FieldT>(out, index.iop_index_.prover_messages_);
+}
+
+template<typename FieldT, typename MT_hash_type>
+void write_bcs_verifier_index(std::ostream &out,
+                              const bcs_verifier_index<FieldT, MT_hash_type> &index)
+{
+    write_bcs_index_header<FieldT>(out, bcs_verifier_index_kind);
+    const std::size_t digest_len_bytes = index.index_MT_roots_.empty() ? 0 :
+        get_hash_size<MT_hash_type>(index.index_MT_roots_[0]);
+    const std::size_t digest_size = index.index_MT_roots_.empty() ? 0 :
+        stored_digest_size(index.index_MT_roots_[0], digest_len_bytes);
+    write_value<std::uint64_t>(out, index.index_MT_roots_.size());
+    write_value<std::uint64_t>(out, digest_size);
+    write_digests(out, index.index_MT_roots_.data(), index.index_MT_roots_.size(), digest_size);
+    write_Field_Elem_vec_of_vec_binary<FieldT>(out, index.indexed_messages_);
+}
+
+template<typename FieldT, typename MT_hash_type>
+void save_bcs_prover_index(const std::string &path,
+                           const bcs_prover_index<FieldT, MT_hash_type> &index)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    write_bcs_prover_index<FieldT, MT_hash_type>(out, index);
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write prover index to " + path);
+    }
+}
+
+template<typename FieldT, typename MT_hash_type>
+void save_bcs_verifier_index(const std::string &path,
+                             const bcs_verifier_index<FieldT, MT_hash_type> &index)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    write_bcs_verifier_index<FieldT, MT_hash_type>(out, index);
+    if (!out)
+    {
+        throw std::runtime_error("Failed to write verifier index to " + path);
+    }
+}
+
+template<typename FieldT, typename MT_hash_type>
+bcs_prover_index<FieldT, MT_hash_type> load_bcs_prover_index(
+    const std::string &path,
+    const bcs_transformation_parameters<FieldT, MT_hash_type> &parameters)
+{
+    LIBIOP_TRACE_BEGIN("Load prover index");
+    const std::shared_ptr<const mapped_file> file = std::make_shared<const mapped_file>(path);
+    byte_reader in(file->data(), file->data() + file->size());
+    read_bcs_index_header<FieldT>(in, bcs_prover_index_kind);
+
+    bcs_prover_index<FieldT, MT_hash_type> index;
+    const std::uint64_t num_MTs = in.read_value<std::uint64_t>();
+    for (std::uint64_t i = 0; i < num_MTs; i++)
+    {
+        /* Peek at the tree configuration, read_binary checks it again */
+        byte_reader peek = in;
+        const std::size_t num_leaves = peek.read_value<std::uint64_t>();
+        const std::size_t digest_len_bytes = peek.read_value<std::uint64_t>();
+        peek.read_value<std::uint64_t>();
+        const bool make_zk = (peek.read_value<std::uint8_t>() != 0);
+
+        merkle_tree<FieldT, MT_hash_type> MT(
+            num_leaves,
+            parameters.leafhasher_,
+            parameters.compression_hasher,
+            digest_len_bytes,
+            make_zk,
+            parameters.security_parameter);
+        MT.read_binary(in, file);
+        index.index_MTs_.emplace_back(std::move(MT));
+    }
+    read_Field_Elem_vec_of_vec_binary<FieldT>(in, index.indexed_messages_);
+    read_Field_Elem_buffers_binary<FieldT>(in, file, index.iop_index_.all_oracle_evals_);
+    read_Field_Elem_vec_of_vec_binary<FieldT>(in, index.iop_index_.prover_messages_);
+    if (!in.at_end())
+    {
+        throw std::invalid_argument("Trailing data in prover index file.");
+    }
+    LIBIOP_TRACE_END("Load prover index");
+    return index;
+}
+
+template<typename FieldT, typename MT_hash_type>
+bcs_verifier_index<FieldT, MT_hash_type> load_bcs_verifier_index(
+    const std::string &path)
+{
+    /* The verifier index is small, so it is copied out of the file */
+    const mapped_file file(path);
+    byte_reader in(file.data(), file.data() + file.size());
+    read_bcs_index_header<FieldT>(in, bcs_verifier_index_kind);
+
+    bcs_verifier_index<FieldT, MT_hash_type> index;
+    const std::uint64_t num_roots = in.read_value<std::uint64_t>();
+    const std::uint64_t digest_size = in.read_value<std::uint64_t>();
+    shared_buffer<MT_hash_type> roots;
+    read_digests(in, nullptr, roots, num_roots, digest_size);
+    index.index_MT_roots_.assign(roots.begin(), roots.end());
+    read_Field_Elem_vec_of_vec_binary<FieldT>(in, index.indexed_messages_);
+    if (!in.at_end())
+    {
+        throw std::invalid_argument("Trailing data in verifier index file.");
+    }
+    return index;
+}
+
+} // namespace libiop
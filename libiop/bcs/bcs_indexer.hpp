@@ -21,7 +21,7 @@ class bcs_indexer : public bcs_protocol<FieldT, MT_hash_type> {
 protected:
     std::size_t MTs_processed_ = 0;
     size_t prover_messages_indexed = 0;
-    std::vector<std::vector<FieldT>> indexed_oracles_;
+    std::vector<shared_buffer<FieldT>> indexed_oracles_;
 
     bool get_prover_index_has_been_called_ = false;
 public:
@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT, typename MT_hash_type>
@@ -17,7 +19,7 @@ void bcs_indexer<FieldT, MT_hash_type>::signal_prover_round_done()
 template<typename FieldT, typename MT_hash_type>
 void bcs_indexer<FieldT, MT_hash_type>::signal_index_submissions_done()
 {
-    libff::enter_block("Merkelize indexed oracles");
+    LIBIOP_TRACE_BEGIN("Merkelize indexed oracles");
     iop_protocol<FieldT>::signal_prover_round_done();
     std::size_t ended_round = this->num_prover_rounds_done_-1;
     if (ended_round != 0)
@@ -28,8 +30,9 @@ void bcs_indexer<FieldT, MT_hash_type>::signal_index_submissions_done()
     const round_parameters<FieldT> round_params = this->get_round_parameters(ended_round);
 
     /* First, go through all the oracle messages in this round and
-       compress each one using a Merkle Tree. */
-    std::vector<MT_hash_type> roots;
+       compress each one using a Merkle Tree. The trees are independent,
+       so they are constructed in parallel when the hashes are stateless. */
+    std::vector<std::vector<std::shared_ptr<std::vector<FieldT>>>> contents_by_tree;
     for (auto &kv : mapping)
     {
         std::vector<std::shared_ptr<std::vector<FieldT>>> all_evaluated_contents;
@@ -38,22 +41,37 @@ void bcs_indexer<FieldT, MT_hash_type>::signal_index_submissions_done()
             std::shared_ptr<std::vector<FieldT>> oracle_contents = this->oracles_[v.id()].evaluated_contents();
             all_evaluated_contents.emplace_back(oracle_contents);
         }
-        libff::enter_block("Construct Merkle tree");
-        this->Merkle_trees_[this->MTs_processed_].construct_with_leaves_serialized_by_cosets(
-            all_evaluated_contents, round_params.quotient_map_size_);
-        libff::leave_block("Construct Merkle tree");
+        contents_by_tree.emplace_back(std::move(all_evaluated_contents));
+    }
+
+    LIBIOP_TRACE_BEGIN("Construct Merkle trees");
+    const size_t first_MT = this->MTs_processed_;
+    const size_t num_trees = contents_by_tree.size();
+    const bool parallel = hash_is_thread_safe<MT_hash_type>() && num_trees > 1;
+    libff::UNUSED(parallel);
+#ifdef MULTICORE
+#pragma omp parallel for if(parallel)
+#endif
+    for (size_t i = 0; i < num_trees; i++)
+    {
+        this->Merkle_trees_[first_MT + i].construct_with_leaves_serialized_by_cosets(
+            contents_by_tree[i], round_params.quotient_map_size_);
+    }
+    this->MTs_processed_ += num_trees;
+    contents_by_tree.clear();
+    LIBIOP_TRACE_END("Construct Merkle trees");
 
-        ++this->MTs_processed_;
-        /* Now make the oracles in a form suitable for creating an index */
+    /* Now make the oracles in a form suitable for creating an index */
+    for (auto &kv : mapping)
+    {
         for (auto &v : kv.second)
         {
-            std::shared_ptr<std::vector<FieldT>> oracle_contents = this->oracles_[v.id()].evaluated_contents();
-            this->indexed_oracles_.emplace_back(*oracle_contents.get());
+            this->indexed_oracles_.emplace_back(this->oracles_[v.id()].evaluated_contents());
             this->oracles_[v.id()].erase_contents();
         }
     }
 
-    libff::leave_block("Merkelize indexed oracles");
+    LIBIOP_TRACE_END("Merkelize indexed oracles");
 }
 
 template<typename FieldT, typename MT_hash_type>
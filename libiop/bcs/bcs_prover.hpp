@@ -25,9 +25,8 @@ protected:
     void remove_index_info_from_transcript(bcs_transformation_transcript<FieldT, MT_hash_type> &transcript);
 public:
     bcs_prover(const bcs_transformation_parameters<FieldT, MT_hash_type> &parameters);
-    /* Mutates index */
     bcs_prover(const bcs_transformation_parameters<FieldT, MT_hash_type> &parameters,
-               bcs_prover_index<FieldT, MT_hash_type> &index);
+               const bcs_prover_index<FieldT, MT_hash_type> &index);
 
     /** The overloaded method for signal_prover_round_done performs
      *  hashing of all oracles and prover messages submitted in the
@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT, typename MT_hash_type>
@@ -11,19 +13,20 @@ bcs_prover<FieldT, MT_hash_type>::bcs_prover(
 template<typename FieldT, typename MT_hash_type>
 bcs_prover<FieldT, MT_hash_type>::bcs_prover(
     const bcs_transformation_parameters<FieldT, MT_hash_type> &parameters,
-    bcs_prover_index<FieldT, MT_hash_type> &index) :
+    const bcs_prover_index<FieldT, MT_hash_type> &index) :
     bcs_protocol<FieldT, MT_hash_type>(parameters),
     is_preprocessing_(true)
 {
+    /* Constructed Merkle trees share their nodes when copied, so this does not copy the index */
     this->num_indexed_MTs_ = index.index_MTs_.size();
-    std::swap(this->Merkle_trees_, index.index_MTs_);
+    this->Merkle_trees_ = index.index_MTs_;
     this->indexed_prover_messages_ = index.indexed_messages_;
 }
 
 template<typename FieldT, typename MT_hash_type>
 void bcs_prover<FieldT, MT_hash_type>::signal_prover_round_done()
 {
-    libff::enter_block("Finish prover round");
+    LIBIOP_TRACE_BEGIN("Finish prover round");
     iop_protocol<FieldT>::signal_prover_round_done();
     std::size_t ended_round = this->num_prover_rounds_done_-1;
     const domain_to_oracles_map mapping = this->oracles_in_round_by_domain(ended_round);
@@ -40,23 +43,23 @@ void bcs_prover<FieldT, MT_hash_type>::signal_prover_round_done()
         {
             all_oracle_evaluated_contents.emplace_back(this->oracles_[v.id()].evaluated_contents());
         }
-        libff::enter_block("Construct Merkle tree");
+        LIBIOP_TRACE_BEGIN("Construct Merkle tree");
         this->Merkle_trees_[this->processed_MTs_].construct_with_leaves_serialized_by_cosets(
             all_oracle_evaluated_contents, round_params.quotient_map_size_);
-        libff::leave_block("Construct Merkle tree");
+        LIBIOP_TRACE_END("Construct Merkle tree");
     }
 
     this->run_hashchain_for_round();
 
-    libff::leave_block("Finish prover round");
-    libff::enter_block("pow");
+    LIBIOP_TRACE_END("Finish prover round");
+    LIBIOP_TRACE_BEGIN("pow");
     // If we are in the last round, do a proof of work
     if (this->num_prover_rounds_done_ == this->num_interaction_rounds_)
     {
         MT_hash_type pow_challenge = this->hashchain_->squeeze_root_type();
         this->pow_answer_ = this->pow_.solve_pow(this->parameters_.compression_hasher, pow_challenge);
     }
-    libff::leave_block("pow");
+    LIBIOP_TRACE_END("pow");
 }
 
 template<typename FieldT, typename MT_hash_type>
@@ -152,12 +155,9 @@ bcs_transformation_transcript<FieldT, MT_hash_type>
     /*
       Make sure all queries are hit.
     */
-    for (std::size_t query_id = 0; query_id < this->query_registrations_.size(); ++query_id)
-    {
-        this->obtain_query_response(query_handle(query_id));
-        /* this will populate oracle_id_to_query_positions_ (a hack used
-           below in constructing the transcript to collect query positions) */
-    }
+    this->evaluate_all_queries();
+    /* this populates recorded_query_positions_, used below in constructing
+       the transcript to collect query positions */
 
     /*
       Go over all MTs and prepare multi membership proofs. (Now that we
@@ -175,12 +175,12 @@ bcs_transformation_transcript<FieldT, MT_hash_type>
         for (auto &kv : mapping)
         {
             /* Where is this oracle going to be queried? */
-            std::set<std::size_t> query_positions_set;
-            std::set<std::size_t> MT_leaf_positions_set;
+            std::pmr::set<std::size_t> query_positions_set(temporary_resource());
+            std::pmr::set<std::size_t> MT_leaf_positions_set(temporary_resource());
             const std::size_t num_leaves = this->domains_[kv.first.id()].num_elements() / round_params.quotient_map_size_;
             for (auto oracle_h : kv.second)
             {
-                for (auto pos : this->oracle_id_to_query_positions_[oracle_h.id()])
+                for (auto pos : this->recorded_query_positions(oracle_h.id()))
                 {
                     query_positions_set.insert(pos);
                     MT_leaf_positions_set.insert(
@@ -199,11 +199,12 @@ bcs_transformation_transcript<FieldT, MT_hash_type>
             for (auto pos : query_positions)
             {
                 std::vector<FieldT> column;
+                column.reserve(kv.second.size());
                 for (auto oracle_h : kv.second)
                 {
                     column.emplace_back(this->get_oracle_evaluation_at_point(std::make_shared<oracle_handle>(oracle_h), pos));
                 }
-                values.emplace_back(column);
+                values.emplace_back(std::move(column));
             }
 
             result.total_depth_without_pruning += MT_leaf_positions.size() * this->Merkle_trees_[MT_idx].depth();
@@ -8,6 +8,7 @@
 #ifndef LIBIOP_SNARK_COMMON_BCS16_VERIFIER_HPP_
 #define LIBIOP_SNARK_COMMON_BCS16_VERIFIER_HPP_
 
+#include <exception>
 #include <set>
 
 #include <libff/common/profiling.hpp>
@@ -19,7 +20,8 @@ template<typename FieldT, typename MT_hash_type>
 class bcs_verifier : public bcs_protocol<FieldT, MT_hash_type> {
 protected:
     bcs_transformation_transcript<FieldT, MT_hash_type> transcript_;
-    std::map<std::pair<std::size_t, std::size_t>, FieldT> oracle_id_and_pos_idx_to_value_;
+    /* Queried values of each real oracle, indexed by oracle id */
+    std::vector<oracle_evaluation_cache<FieldT>> oracle_id_to_queried_values_;
     bool transcript_is_valid_;
 
     bool is_preprocessing_ = false;
@@ -48,6 +50,7 @@ public:
 
     bool transcript_is_valid() const;
 protected:
+    void validate_MT_queries(const std::vector<std::vector<std::vector<FieldT>>> &MT_leaf_columns);
     void parse_query_responses_from_transcript();
     std::vector<std::vector<FieldT>> query_responses_to_MT_leaf_responses(
         std::vector<std::size_t> &query_positions,
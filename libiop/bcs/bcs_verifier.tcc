@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT, typename MT_hash_type>
@@ -35,11 +37,13 @@ bcs_verifier<FieldT, MT_hash_type>::bcs_verifier(
 template<typename FieldT, typename hash_digest_type>
 void bcs_verifier<FieldT, hash_digest_type>::seal_interaction_registrations()
 {
-    libff::enter_block("verifier_seal_interaction_registrations");
+    LIBIOP_TRACE_BEGIN("verifier_seal_interaction_registrations");
     bcs_protocol<FieldT, hash_digest_type>::seal_interaction_registrations();
 
     this->transcript_is_valid_ = true;
 
+    /* Serialized leaves for every Merkle tree, validated after the hashchain has run. */
+    std::vector<std::vector<std::vector<FieldT>>> MT_leaf_columns;
     std::size_t processed_MTs = 0; // Updated at end of loop.
     for (std::size_t round = 0; round < this->num_interaction_rounds_; ++round)
     {
@@ -65,31 +69,24 @@ void bcs_verifier<FieldT, hash_digest_type>::seal_interaction_registrations()
             this->transcript_.MT_roots_.cbegin() + processed_MTs + num_domains);
         this->run_hashchain_for_round(round, MT_roots_for_round, this->transcript_.prover_messages_);
 
-        /* Validate all MT queries relative to the transcript. */
+        /* Serialize query responses into leafs */
         for (std::size_t i = 0; i < num_domains; i++)
         {
-            const auto &root = this->transcript_.MT_roots_[processed_MTs];
             std::vector<std::size_t> &query_positions = this->transcript_.query_positions_[processed_MTs];
-            std::vector<std::size_t> &MT_leaf_positions = this->transcript_.MT_leaf_positions_[processed_MTs];
             std::vector<std::vector<FieldT> > &query_responses = this->transcript_.query_responses_[processed_MTs];
-            const auto &proof = this->transcript_.MT_set_membership_proofs_[processed_MTs];
-
-            // Step 1) serialize query responses into leafs
-            std::vector<std::vector< FieldT> > MT_leaf_columns =
-                this->query_responses_to_MT_leaf_responses(query_positions, query_responses, round);
-
-            // Step 2) validate proof
-            const bool proof_is_valid = this->Merkle_trees_[processed_MTs]
-                .validate_set_membership_proof(root, MT_leaf_positions, MT_leaf_columns, proof);
 
-            if (!proof_is_valid)
-            {
-                this->transcript_is_valid_ = false;
-            }
+            MT_leaf_columns.emplace_back(
+                this->query_responses_to_MT_leaf_responses(query_positions, query_responses, round));
+            this->Merkle_trees_[processed_MTs].check_leaf_salts(
+                this->transcript_.MT_set_membership_proofs_[processed_MTs],
+                MT_leaf_columns.back().size());
             processed_MTs++;
         }
     }
 
+    /* Validate all MT queries relative to the transcript. */
+    this->validate_MT_queries(MT_leaf_columns);
+
     /* Check proof of work */
 
     hash_digest_type pow_challenge = this->hashchain_->squeeze_root_type();
@@ -102,12 +99,81 @@ void bcs_verifier<FieldT, hash_digest_type>::seal_interaction_registrations()
 
     /* Finally populate things for obtaining query responses */
     this->parse_query_responses_from_transcript();
-    libff::leave_block("verifier_seal_interaction_registrations");
+    LIBIOP_TRACE_END("verifier_seal_interaction_registrations");
+}
+
+template<typename FieldT, typename MT_hash_type>
+void bcs_verifier<FieldT, MT_hash_type>::validate_MT_queries(
+    const std::vector<std::vector<std::vector<FieldT>>> &MT_leaf_columns)
+{
+    LIBIOP_TRACE_BEGIN("verifier_validate_MT_queries");
+    const std::size_t num_MTs = MT_leaf_columns.size();
+    const bool parallel = hash_is_thread_safe<MT_hash_type>();
+    libff::UNUSED(parallel);
+
+    /* Step 1) hash the queried leaves of all trees in one flat pass */
+    std::vector<std::pair<std::size_t, std::size_t>> leaves_to_hash;
+    std::vector<std::vector<MT_hash_type>> leaf_hashes(num_MTs);
+    for (std::size_t t = 0; t < num_MTs; t++)
+    {
+        leaf_hashes[t].resize(MT_leaf_columns[t].size());
+        for (std::size_t j = 0; j < MT_leaf_columns[t].size(); j++)
+        {
+            leaves_to_hash.emplace_back(std::make_pair(t, j));
+        }
+    }
+#ifdef MULTICORE
+#pragma omp parallel for if(parallel)
+#endif
+    for (std::size_t k = 0; k < leaves_to_hash.size(); k++)
+    {
+        const std::size_t t = leaves_to_hash[k].first;
+        const std::size_t j = leaves_to_hash[k].second;
+        leaf_hashes[t][j] = this->Merkle_trees_[t].hash_leaf(
+            MT_leaf_columns[t][j], this->transcript_.MT_set_membership_proofs_[t], j);
+    }
+
+    /* Step 2) rebuild each tree's path to its root. Exceptions can't leave the
+       parallel region, so they are rethrown afterwards in tree order. */
+    std::vector<int> proof_is_valid(num_MTs, 1);
+    std::vector<std::exception_ptr> errors(num_MTs);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic) if(parallel)
+#endif
+    for (std::size_t t = 0; t < num_MTs; t++)
+    {
+        try
+        {
+            proof_is_valid[t] = this->Merkle_trees_[t].validate_set_membership_proof_from_leaf_hashes(
+                this->transcript_.MT_roots_[t],
+                this->transcript_.MT_leaf_positions_[t],
+                leaf_hashes[t],
+                this->transcript_.MT_set_membership_proofs_[t]);
+        }
+        catch (...)
+        {
+            errors[t] = std::current_exception();
+        }
+    }
+
+    for (std::size_t t = 0; t < num_MTs; t++)
+    {
+        if (errors[t])
+        {
+            std::rethrow_exception(errors[t]);
+        }
+        if (!proof_is_valid[t])
+        {
+            this->transcript_is_valid_ = false;
+        }
+    }
+    LIBIOP_TRACE_END("verifier_validate_MT_queries");
 }
 
 template<typename FieldT, typename MT_hash_type>
 void bcs_verifier<FieldT, MT_hash_type>::parse_query_responses_from_transcript()
 {
+    this->oracle_id_to_queried_values_.resize(this->oracle_registrations_.size());
     std::size_t processed_MTs = 0;
     for (std::size_t round = 0; round < this->num_interaction_rounds_; ++round)
     {
@@ -119,15 +185,16 @@ void bcs_verifier<FieldT, MT_hash_type>::parse_query_responses_from_transcript()
         for (auto &kv : mapping)
         {
             std::size_t oracles_processed_for_MT = 0;
+            const std::vector<std::size_t> &query_positions = this->transcript_.query_positions_[processed_MTs];
             for (auto &oh : kv.second)
             {
-                for (std::size_t i = 0; i < this->transcript_.query_positions_[processed_MTs].size(); ++i)
+                std::vector<FieldT> values(query_positions.size());
+                for (std::size_t i = 0; i < query_positions.size(); ++i)
                 {
-                    const std::size_t pos_idx = transcript_.query_positions_[processed_MTs][i];
-                    const FieldT value = transcript_.query_responses_[processed_MTs][i][oracles_processed_for_MT];
-
-                    this->oracle_id_and_pos_idx_to_value_[std::make_pair(oh.id(), pos_idx)] = value;
+                    values[i] = transcript_.query_responses_[processed_MTs][i][oracles_processed_for_MT];
                 }
+
+                this->oracle_id_to_queried_values_[oh.id()].insert(query_positions, values);
                 ++oracles_processed_for_MT;
             }
 
@@ -193,17 +260,17 @@ FieldT bcs_verifier<FieldT, MT_hash_type>::get_oracle_evaluation_at_point(
     {
         /* If real oracle, use our saved values that we saved from
            the transcript. */
-        auto it = this->oracle_id_and_pos_idx_to_value_.find(std::make_pair(handle->id(), evaluation_position));
+        const FieldT *value = this->oracle_id_to_queried_values_[handle->id()].find(evaluation_position);
 
 #ifdef DEBUG
         printf("query: oracle %zu at position %zu\n", handle->id(), evaluation_position);
 #endif // DEBUG
 
-        if (it == this->oracle_id_and_pos_idx_to_value_.end())
+        if (value == nullptr)
         {
             throw std::logic_error("Got a request for a query position that's unavailable in the proof.");
         }
-        return it->second;
+        return *value;
     }
     else
     {
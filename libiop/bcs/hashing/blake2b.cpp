@@ -47,6 +47,29 @@ binary_hash_digest blake2b_two_to_one_hash(const binary_hash_digest &first,
     return result;
 }
 
+binary_hash_digest blake2b_two_to_one_hash(const binary_hash_digest &first,
+                                           const std::uint8_t *second,
+                                           const std::size_t second_size,
+                                           const std::size_t digest_len_bytes)
+{
+    binary_hash_digest result(digest_len_bytes, 'X');
+
+    /* Hashing the two parts incrementally gives the same digest as hashing their concatenation */
+    crypto_generichash_blake2b_state state;
+    int status = crypto_generichash_blake2b_init(&state, NULL, 0, digest_len_bytes);
+    status |= crypto_generichash_blake2b_update(&state,
+                                                (const unsigned char*)first.data(),
+                                                first.size());
+    status |= crypto_generichash_blake2b_update(&state, second, second_size);
+    status |= crypto_generichash_blake2b_final(&state, (unsigned char*)&result[0], digest_len_bytes);
+    if (status != 0)
+    {
+        throw std::runtime_error("Got non-zero status from crypto_generichash_blake2b. (Is digest_len_bytes correct?)");
+    }
+
+    return result;
+}
+
 std::size_t blake2b_integer_randomness_extractor(const binary_hash_digest &root,
                                                  const std::size_t index,
                                                  const std::size_t upper_bound)
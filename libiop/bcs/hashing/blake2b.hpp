@@ -56,12 +56,23 @@ class blake2b_leafhash : public leafhash<FieldT, binary_hash_digest>
     binary_hash_digest hash(const std::vector<FieldT> &leaf);
     binary_hash_digest zk_hash(const std::vector<FieldT> &leaf,
         const zk_salt_type &zk_salt);
+    binary_hash_digest hash(const FieldT *leaf, const std::size_t leaf_size);
+    binary_hash_digest zk_hash(const FieldT *leaf, const std::size_t leaf_size,
+        const zk_salt_type &zk_salt);
+    binary_hash_digest zk_hash(const FieldT *leaf, const std::size_t leaf_size,
+        const std::uint8_t *zk_salt, const std::size_t zk_salt_size);
 };
 
 template<typename FieldT>
 binary_hash_digest blake2b_field_element_hash(const std::vector<FieldT> &data,
                                        const std::size_t digest_len_bytes);
 
+/* Hashes num_elements field elements stored contiguously starting at data. */
+template<typename FieldT>
+binary_hash_digest blake2b_field_element_hash(const FieldT *data,
+                                       const std::size_t num_elements,
+                                       const std::size_t digest_len_bytes);
+
 template<typename FieldT>
 std::vector<FieldT> blake2b_FieldT_randomness_extractor(const binary_hash_digest &root,
                                                         const std::size_t index,
@@ -79,6 +90,12 @@ binary_hash_digest blake2b_two_to_one_hash(const binary_hash_digest &first,
                                     const binary_hash_digest &second,
                                     const std::size_t digest_len_bytes);
 
+/* Same as above, with second given as raw bytes, which are hashed in place. */
+binary_hash_digest blake2b_two_to_one_hash(const binary_hash_digest &first,
+                                    const std::uint8_t *second,
+                                    const std::size_t second_size,
+                                    const std::size_t digest_len_bytes);
+
 } // namespace libiop
 
 #include "libiop/bcs/hashing/blake2b.tcc"
@@ -135,20 +135,57 @@ binary_hash_digest blake2b_leafhash<FieldT>::zk_hash(
     return blake2b_two_to_one_hash(leaf_hash, zk_salt, this->digest_len_bytes_);
 }
 
+template<typename FieldT>
+binary_hash_digest blake2b_leafhash<FieldT>::hash(const FieldT *leaf, const std::size_t leaf_size)
+{
+    return blake2b_field_element_hash<FieldT>(leaf, leaf_size, this->digest_len_bytes_);
+}
+
+template<typename FieldT>
+binary_hash_digest blake2b_leafhash<FieldT>::zk_hash(
+    const FieldT *leaf,
+    const std::size_t leaf_size,
+    const zk_salt_type &zk_salt)
+{
+    binary_hash_digest leaf_hash = blake2b_field_element_hash<FieldT>(
+        leaf, leaf_size, this->digest_len_bytes_);
+    return blake2b_two_to_one_hash(leaf_hash, zk_salt, this->digest_len_bytes_);
+}
+
+template<typename FieldT>
+binary_hash_digest blake2b_leafhash<FieldT>::zk_hash(
+    const FieldT *leaf,
+    const std::size_t leaf_size,
+    const std::uint8_t *zk_salt,
+    const std::size_t zk_salt_size)
+{
+    binary_hash_digest leaf_hash = blake2b_field_element_hash<FieldT>(
+        leaf, leaf_size, this->digest_len_bytes_);
+    return blake2b_two_to_one_hash(leaf_hash, zk_salt, zk_salt_size, this->digest_len_bytes_);
+}
+
 // TODO: Consider how this interacts with field elems being in montgomery form
 // don't we need to make them in canonical form first?
 template<typename FieldT>
 binary_hash_digest blake2b_field_element_hash(const std::vector<FieldT> &data,
                                        const std::size_t digest_len_bytes)
 {
+    return blake2b_field_element_hash<FieldT>(data.data(), data.size(), digest_len_bytes);
+}
+
+template<typename FieldT>
+binary_hash_digest blake2b_field_element_hash(const FieldT *data,
+                                       const std::size_t num_elements,
+                                       const std::size_t digest_len_bytes)
+{
 
     binary_hash_digest result(digest_len_bytes, 'X');
 
     /* see https://download.libsodium.org/doc/hashing/generic_hashing.html */
     const int status = crypto_generichash_blake2b((unsigned char*)&result[0],
                                                   digest_len_bytes,
-                                                  (result.empty() ? NULL : (unsigned char*)&data[0]),
-                                                  sizeof(FieldT) * data.size(),
+                                                  (num_elements == 0 ? NULL : (const unsigned char*)data),
+                                                  sizeof(FieldT) * num_elements,
                                                   NULL, 0);
     if (status != 0)
     {
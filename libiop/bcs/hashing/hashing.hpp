@@ -8,6 +8,7 @@
 #ifndef LIBIOP_SNARK_COMMON_HASHING_HASHING_HPP_
 #define LIBIOP_SNARK_COMMON_HASHING_HASHING_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -47,6 +48,29 @@ class leafhash
     virtual leaf_hash_type hash(const std::vector<FieldT> &leaf) = 0;
     virtual leaf_hash_type zk_hash(const std::vector<FieldT> &leaf,
         const zk_salt_type &zk_salt) = 0;
+
+    /* Variants for leaves that are stored contiguously inside a larger buffer.
+     * The defaults copy the leaf into a local vector, so that they stay safe to call
+     * from several threads whenever the vector overloads are;
+     * leaf hashes that can consume raw memory should override these. */
+    virtual leaf_hash_type hash(const FieldT *leaf, const std::size_t leaf_size)
+    {
+        const std::vector<FieldT> leaf_copy(leaf, leaf + leaf_size);
+        return this->hash(leaf_copy);
+    }
+    virtual leaf_hash_type zk_hash(const FieldT *leaf, const std::size_t leaf_size,
+        const zk_salt_type &zk_salt)
+    {
+        const std::vector<FieldT> leaf_copy(leaf, leaf + leaf_size);
+        return this->zk_hash(leaf_copy, zk_salt);
+    }
+    /* Variant taking the salt as raw bytes, e.g. straight out of a Merkle tree's salt buffer. */
+    virtual leaf_hash_type zk_hash(const FieldT *leaf, const std::size_t leaf_size,
+        const std::uint8_t *zk_salt, const std::size_t zk_salt_size)
+    {
+        return this->zk_hash(leaf, leaf_size,
+            zk_salt_type(reinterpret_cast<const char*>(zk_salt), zk_salt_size));
+    }
 };
 
 template<typename hash_type>
@@ -68,6 +92,14 @@ size_t get_hash_size(const typename libff::enable_if<std::is_same<hash_type, bin
     return h.size();
 }
 
+/* Binary hashes are stateless, so they may be called from several threads at once.
+ * Algebraic hashes carry sponge state and must be called serially. */
+template<typename hash_type>
+constexpr bool hash_is_thread_safe()
+{
+    return std::is_same<hash_type, binary_hash_digest>::value;
+}
+
 
 template<typename FieldT>
 class hash_circuit_description
@@ -21,9 +21,14 @@
 
 #include "libiop/algebra/field_subset/field_subset.hpp"
 #include "libiop/bcs/hashing/hashing.hpp"
+#include "libiop/common/binary_io.hpp"
+#include "libiop/common/shared_buffer.hpp"
 
 namespace libiop {
 
+/* Leaves are gathered into a buffer of roughly this many bytes before being hashed */
+const std::size_t merkle_leaf_block_size_bytes = 1ull << 16; /* 64 KB */
+
 /* Authentication paths for a set of positions */
 template<typename hash_digest_type>
 struct merkle_tree_set_membership_proof {
@@ -50,7 +55,10 @@ template<typename FieldT, typename hash_digest_type>
 class merkle_tree {
 protected:
     bool constructed_;
-    std::vector<hash_digest_type> inner_nodes_;
+    /* A constructed tree is never modified, so copies of it share the nodes and salts.
+     * This keeps copying a constructed tree (e.g. out of a prover index) cheap.
+     * A tree read from a mapped index file may view them in the file. */
+    shared_buffer<hash_digest_type> inner_nodes_;
 
     std::size_t num_leaves_;
     std::shared_ptr<leafhash<FieldT, hash_digest_type>> leaf_hasher_;
@@ -59,10 +67,12 @@ protected:
     bool make_zk_;
     std::size_t num_zk_bytes_;
 
-    /* Each element will be hashed (individually) to produce a random hash digest. */
-    std::vector<zk_salt_type> zk_leaf_randomness_elements_;
-    void sample_leaf_randomness();
-    void compute_inner_nodes();
+    /* The salt of each leaf, num_zk_bytes_ bytes per leaf, stored back to back in leaf order.
+     * Salts are only copied out for the leaves that are queried. */
+    shared_buffer<std::uint8_t> zk_leaf_salts_;
+    std::vector<std::uint8_t> sample_leaf_randomness() const;
+    const std::uint8_t *leaf_salt(const std::size_t leaf_index) const;
+    void compute_inner_nodes(std::vector<hash_digest_type> &inner_nodes) const;
 public:
     /* Create a merkle tree with the given configuration.
     If make_zk is true, 2 * security parameter random bytes will be appended to each leaf
@@ -115,6 +125,21 @@ public:
         const std::vector<std::vector<FieldT>> &leaf_contents,
         const merkle_tree_set_membership_proof<hash_digest_type> &proof);
 
+    /** The steps of validate_set_membership_proof, exposed so that a verifier can hash
+     *  the leaves of several trees in one batch before checking each tree's layers.
+     *  check_leaf_salts throws if a zk proof does not carry one salt per leaf,
+     *  and must pass before hash_leaf is called. */
+    void check_leaf_salts(const merkle_tree_set_membership_proof<hash_digest_type> &proof,
+                          const std::size_t num_leaf_contents) const;
+    hash_digest_type hash_leaf(const std::vector<FieldT> &leaf_contents,
+                               const merkle_tree_set_membership_proof<hash_digest_type> &proof,
+                               const std::size_t leaf_index) const;
+    bool validate_set_membership_proof_from_leaf_hashes(
+        const hash_digest_type &root,
+        const std::vector<std::size_t> &positions,
+        const std::vector<hash_digest_type> &leaf_hashes,
+        const merkle_tree_set_membership_proof<hash_digest_type> &proof) const;
+
     /* Returns number of two to one hashes */
     size_t count_hashes_to_verify_set_membership_proof(
         const std::vector<std::size_t> &positions) const;
@@ -123,6 +148,14 @@ public:
     std::size_t depth() const;
     bool zk() const;
     std::size_t num_total_bytes() const;
+
+    /** Flat binary serialization of a constructed tree, used for persisting index trees.
+     *  The hash functions are not serialized, so read_binary must be called on a tree
+     *  created with the same configuration as the tree that was written.
+     *  If owner keeps the input alive, the salts, and the nodes if they are field elements,
+     *  are read in place rather than copied (see read_aligned_array). */
+    void write_binary(std::ostream &out) const;
+    void read_binary(byte_reader &in, const std::shared_ptr<const void> &owner = nullptr);
 };
 
 } // namespace libiop
@@ -1,11 +1,14 @@
 #include <algorithm>
+#include <map>
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/common/cpp17_bits.hpp"
+#include "libiop/common/proof_arena.hpp"
 #include <libff/common/utils.hpp>
 
-#include <sodium/randombytes.h>
+#include "libiop/algebra/randomness.hpp"
 
 namespace libiop {
 
@@ -34,41 +37,19 @@ merkle_tree<FieldT, hash_digest_type>::merkle_tree(
 }
 
 template<typename FieldT, typename hash_digest_type>
-void merkle_tree<FieldT, hash_digest_type>::sample_leaf_randomness()
+std::vector<std::uint8_t> merkle_tree<FieldT, hash_digest_type>::sample_leaf_randomness() const
 {
-    libff::enter_block("BCS: Sample randomness");
-    assert(this->zk_leaf_randomness_elements_.size() == 0);
-    this->zk_leaf_randomness_elements_.reserve(this->num_leaves_);
-
-    /* This uses a batch size since the libsodium API makes no guarantee for the maximum supported
-    * vector size. */
-    const size_t num_rand_bytes = this->num_leaves_ * this->num_zk_bytes_;
-    const size_t rand_batch_size = 1ull << 20; /* 1 MB */
-    const size_t num_batches = num_rand_bytes / rand_batch_size;
-    const size_t leafs_per_batch = (num_batches == 0) ? 0 : this->num_leaves_ / num_batches;
-    for (size_t i = 0; i < num_batches; i++) {
-        std::vector<uint8_t> batch_randomness;
-        batch_randomness.resize(rand_batch_size);
-        randombytes_buf(&batch_randomness[0], rand_batch_size);
-        std::vector<uint8_t>::const_iterator first = batch_randomness.begin();
-        std::vector<uint8_t>::const_iterator last = batch_randomness.begin() + this->num_zk_bytes_;
-        for (size_t i = 0; i < leafs_per_batch; ++i) {
-            std::string rand_str(first, last);
-            this->zk_leaf_randomness_elements_.emplace_back(rand_str);
-            first += this->num_zk_bytes_;
-            last += this->num_zk_bytes_;
-        }
-    }
-    const size_t remaining_leaves = this->num_leaves_ - leafs_per_batch * num_batches;
-    for (size_t i = 0; i < remaining_leaves; ++i)
-    {
-        std::vector<uint8_t> rand_leaf;
-        rand_leaf.resize(this->num_zk_bytes_);
-        randombytes_buf(&rand_leaf[0], this->num_zk_bytes_);
-        std::string rand_str(rand_leaf.begin(), rand_leaf.end());
-        this->zk_leaf_randomness_elements_.push_back(rand_str);
-    }
-    libff::leave_block("BCS: Sample randomness");
+    LIBIOP_TRACE_BEGIN("BCS: Sample randomness");
+    std::vector<std::uint8_t> salts(this->num_leaves_ * this->num_zk_bytes_);
+    random_bytes(salts.data(), salts.size());
+    LIBIOP_TRACE_END("BCS: Sample randomness");
+    return salts;
+}
+
+template<typename FieldT, typename hash_digest_type>
+const std::uint8_t *merkle_tree<FieldT, hash_digest_type>::leaf_salt(const std::size_t leaf_index) const
+{
+    return this->zk_leaf_salts_.data() + leaf_index * this->num_zk_bytes_;
 }
 
 template<typename FieldT, typename hash_digest_type>
@@ -110,44 +91,81 @@ void merkle_tree<FieldT, hash_digest_type>::construct_with_leaves_serialized_by_
     /* Sample randomness for zk merkle trees */
     if (this->make_zk_)
     {
-        this->sample_leaf_randomness();
+        this->zk_leaf_salts_ = shared_buffer<std::uint8_t>(this->sample_leaf_randomness());
     }
 
-    this->inner_nodes_.resize(2 * this->num_leaves_ - 1);
-    /* Domain with the same size as inputs, used for getting coset positions */
+    std::vector<hash_digest_type> inner_nodes(2 * this->num_leaves_ - 1);
+    /* Domain with the same size as inputs, used for getting coset positions.
+     * For every supported domain type, the positions within coset i are
+     * first_position(i) + j * coset_stride, so we compute them arithmetically. */
     field_subset<FieldT> leaf_domain(leaf_contents[0]->size());
-    /* First hash the leaves. Since we are putting an entire coset into a leaf,
-     * our slice is of size num_input_oracles * coset_size */
-    std::vector<FieldT> slice(leaf_contents.size() * coset_serialization_size,
-        FieldT::zero());
-    for (std::size_t i = 0; i < this->num_leaves_; ++i)
-    {
-        std::vector<size_t> positions_in_this_slice =
-            leaf_domain.all_positions_in_coset_i(i, coset_serialization_size);
-        for (size_t j = 0; j < coset_serialization_size; j++)
+    const size_t coset_stride = (coset_serialization_size == 1) ? 0 :
+        leaf_domain.position_by_coset_indices(0, 1, coset_serialization_size) -
+        leaf_domain.position_by_coset_indices(0, 0, coset_serialization_size);
+
+    /* Since we are putting an entire coset into a leaf, each leaf is of size
+     * num_input_oracles * coset_size. Leaves are gathered a block at a time into a
+     * leaf-major buffer, so that the reads from each oracle stay local,
+     * and each leaf is then hashed directly out of the buffer. */
+    const size_t leaf_size = leaf_contents.size() * coset_serialization_size;
+    const size_t leaves_per_block = std::min(this->num_leaves_,
+        std::max<size_t>(1, merkle_leaf_block_size_bytes / (leaf_size * sizeof(FieldT))));
+    const size_t num_blocks = (this->num_leaves_ + leaves_per_block - 1) / leaves_per_block;
+    /* Blocks are independent, so they are hashed in parallel when the hashers are stateless. */
+    const bool parallel = hash_is_thread_safe<hash_digest_type>();
+    libff::UNUSED(parallel);
+#ifdef MULTICORE
+#pragma omp parallel if(parallel)
+#endif
+    {
+    std::vector<FieldT> leaf_block(leaves_per_block * leaf_size, FieldT::zero());
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+    for (std::size_t block = 0; block < num_blocks; block++)
+    {
+        const size_t block_start = block * leaves_per_block;
+        const size_t block_end = std::min(block_start + leaves_per_block, this->num_leaves_);
+        for (size_t k = 0; k < leaf_contents.size(); k++)
         {
-            for (size_t k = 0; k < leaf_contents.size(); k++)
+            const FieldT *oracle = leaf_contents[k]->data();
+            FieldT *out = &leaf_block[k * coset_serialization_size];
+            for (size_t i = block_start; i < block_end; i++)
             {
-                slice[j + k*coset_serialization_size] =
-                    leaf_contents[k]->operator[](positions_in_this_slice[j]);
+                const size_t first_position =
+                    leaf_domain.position_by_coset_indices(i, 0, coset_serialization_size);
+                for (size_t j = 0; j < coset_serialization_size; j++)
+                {
+                    out[j] = oracle[first_position + j * coset_stride];
+                }
+                out += leaf_size;
             }
         }
 
-        hash_digest_type digest;
-        if (this->make_zk_)
-        {
-            digest = this->leaf_hasher_->zk_hash(slice, this->zk_leaf_randomness_elements_[i]);
-        }
-        else
+        const FieldT *leaf = leaf_block.data();
+        for (size_t i = block_start; i < block_end; i++)
         {
-            digest = this->leaf_hasher_->hash(slice);
+            hash_digest_type digest;
+            if (this->make_zk_)
+            {
+                digest = this->leaf_hasher_->zk_hash(leaf, leaf_size, this->leaf_salt(i), this->num_zk_bytes_);
+            }
+            else
+            {
+                digest = this->leaf_hasher_->hash(leaf, leaf_size);
+            }
+            inner_nodes[(this->num_leaves_ - 1) + i] = digest;
+            leaf += leaf_size;
         }
-        this->inner_nodes_[(this->num_leaves_ - 1) + i] = digest;
+    }
     }
 
     /* Then hash all the layers */
-    this->compute_inner_nodes();
+    this->compute_inner_nodes(inner_nodes);
+    this->inner_nodes_ = shared_buffer<hash_digest_type>(std::move(inner_nodes));
     this->constructed_ = true;
+    LIBIOP_TRACE_COUNT(hashes, 2 * this->num_leaves_ - 1);
+    LIBIOP_TRACE_COUNT(allocated_bytes, this->num_total_bytes());
 }
 
 template<typename FieldT, typename hash_digest_type>
@@ -169,14 +187,14 @@ std::vector<std::vector<FieldT>> merkle_tree<FieldT, hash_digest_type>::serializ
     /** Elements within a given coset appear in order,
      * so we simply store the index for the next element of the coset,
      * and increment as we see new positions belonging to this coset. */
-    std::vector<size_t> intra_coset_index(MT_leaf_columns.size(), 0);
-    std::map<size_t, size_t> MT_leaf_pos_to_response_index;
+    temporary_vector<size_t> intra_coset_index(MT_leaf_columns.size(), 0, temporary_resource());
+    std::pmr::map<size_t, size_t> MT_leaf_pos_to_response_index(temporary_resource());
     size_t next_response_index = 0;
     for (size_t i = 0; i < query_positions.size(); i++)
     {
         const size_t query_position = query_positions[i];
         const size_t MT_leaf_index = leaf_domain.coset_index(query_position, coset_serialization_size);
-        std::map<size_t, size_t>::iterator it = MT_leaf_pos_to_response_index.find(MT_leaf_index);
+        const auto it = MT_leaf_pos_to_response_index.find(MT_leaf_index);
         /* For supported domain types, new MT leaf positions appear in order of query positions.
          * If we don't yet know the index of this leaf within the queried for leaves,
          * we can find it by simply incrementing the prior leaf's index. */
@@ -198,7 +216,8 @@ std::vector<std::vector<FieldT>> merkle_tree<FieldT, hash_digest_type>::serializ
 }
 
 template<typename FieldT, typename hash_digest_type>
-void merkle_tree<FieldT, hash_digest_type>::compute_inner_nodes()
+void merkle_tree<FieldT, hash_digest_type>::compute_inner_nodes(
+    std::vector<hash_digest_type> &inner_nodes) const
 {
     // TODO: Better document this function, its hashing layer by layer.
     std::size_t n = (this->num_leaves_ - 1) / 2;
@@ -207,15 +226,21 @@ void merkle_tree<FieldT, hash_digest_type>::compute_inner_nodes()
         // TODO: Evaluate how much time is spent in hashing vs memory access.
         // For better memory efficiency, we could hash sub-tree by sub-tree
         // in an unrolled recursive fashion.
+        /* Nodes within a layer are independent. Small layers are not worth forking for. */
+        const bool parallel = hash_is_thread_safe<hash_digest_type>() && n >= 1024;
+        libff::UNUSED(parallel);
+#ifdef MULTICORE
+#pragma omp parallel for if(parallel)
+#endif
         for (std::size_t j = n; j <= 2*n; ++j)
         {
             // TODO: Can we rely on left and right to be placed sequentially in memory,
             // for better performance in node hasher?
-            const hash_digest_type& left = this->inner_nodes_[2*j + 1];
-            const hash_digest_type& right = this->inner_nodes_[2*j + 2];
+            const hash_digest_type& left = inner_nodes[2*j + 1];
+            const hash_digest_type& right = inner_nodes[2*j + 2];
             const hash_digest_type digest = this->node_hasher_(left, right, this->digest_len_bytes_);
 
-            this->inner_nodes_[j] = digest;
+            inner_nodes[j] = digest;
         }
         if (n > 0)
         {
@@ -236,7 +261,7 @@ hash_digest_type merkle_tree<FieldT, hash_digest_type>::get_root() const
         throw std::logic_error("Attempting to obtain a Merkle tree root without constructing the tree first.");
     }
 
-    return inner_nodes_[0];
+    return this->inner_nodes_[0];
 }
 
 template<typename FieldT, typename hash_digest_type>
@@ -255,7 +280,8 @@ merkle_tree_set_membership_proof<hash_digest_type>
         return result;
     }
 
-    std::vector<std::size_t> S = positions; /* sorted set of positions */
+    /* sorted set of positions */
+    temporary_vector<std::size_t> S(positions.begin(), positions.end(), temporary_resource());
     std::sort(S.begin(), S.end());
     S.erase(std__unique(S.begin(), S.end()), S.end()); /* remove possible duplicates */
 
@@ -270,8 +296,8 @@ merkle_tree_set_membership_proof<hash_digest_type>
         /* add random hashes, in order, to the beginning (one for each query) */
         for (auto &pos : S)
         {
-            const zk_salt_type random_digest = this->zk_leaf_randomness_elements_[pos];
-            result.randomness_hashes.emplace_back(random_digest);
+            const char *salt = reinterpret_cast<const char*>(this->leaf_salt(pos));
+            result.randomness_hashes.emplace_back(salt, this->num_zk_bytes_);
         }
     }
 
@@ -292,7 +318,7 @@ merkle_tree_set_membership_proof<hash_digest_type>
             break;
         }
 
-        std::vector<std::size_t> new_S;
+        temporary_vector<std::size_t> new_S(temporary_resource());
         while (it != S.end())
         {
             const std::size_t it_pos = *it;
@@ -346,6 +372,58 @@ bool merkle_tree<FieldT, hash_digest_type>::validate_set_membership_proof(
     {
         throw std::invalid_argument("The number of positions and hashes provided must match.");
     }
+    this->check_leaf_salts(proof, leaf_contents.size());
+
+    std::vector<hash_digest_type> leaf_hashes(leaf_contents.size());
+    const bool parallel = hash_is_thread_safe<hash_digest_type>();
+    libff::UNUSED(parallel);
+#ifdef MULTICORE
+#pragma omp parallel for if(parallel)
+#endif
+    for (std::size_t i = 0; i < leaf_contents.size(); i++)
+    {
+        leaf_hashes[i] = this->hash_leaf(leaf_contents[i], proof, i);
+    }
+
+    return this->validate_set_membership_proof_from_leaf_hashes(root, positions, leaf_hashes, proof);
+}
+
+template<typename FieldT, typename hash_digest_type>
+void merkle_tree<FieldT, hash_digest_type>::check_leaf_salts(
+    const merkle_tree_set_membership_proof<hash_digest_type> &proof,
+    const std::size_t num_leaf_contents) const
+{
+    if (this->make_zk_ && proof.randomness_hashes.size() != num_leaf_contents)
+    {
+        throw std::invalid_argument("The proof must contain one salt per leaf.");
+    }
+}
+
+template<typename FieldT, typename hash_digest_type>
+hash_digest_type merkle_tree<FieldT, hash_digest_type>::hash_leaf(
+    const std::vector<FieldT> &leaf_contents,
+    const merkle_tree_set_membership_proof<hash_digest_type> &proof,
+    const std::size_t leaf_index) const
+{
+    LIBIOP_TRACE_COUNT(hashes, 1);
+    if (this->make_zk_)
+    {
+        return this->leaf_hasher_->zk_hash(leaf_contents, proof.randomness_hashes[leaf_index]);
+    }
+    return this->leaf_hasher_->hash(leaf_contents);
+}
+
+template<typename FieldT, typename hash_digest_type>
+bool merkle_tree<FieldT, hash_digest_type>::validate_set_membership_proof_from_leaf_hashes(
+    const hash_digest_type &root,
+    const std::vector<std::size_t> &positions,
+    const std::vector<hash_digest_type> &leaf_hashes,
+    const merkle_tree_set_membership_proof<hash_digest_type> &proof) const
+{
+    if (positions.size() != leaf_hashes.size())
+    {
+        throw std::invalid_argument("The number of positions and hashes provided must match.");
+    }
 
     if (positions.empty())
     {
@@ -359,127 +437,93 @@ bool merkle_tree<FieldT, hash_digest_type>::validate_set_membership_proof(
         }
     }
 
-    auto rand_it = proof.randomness_hashes.begin();
-    auto aux_it = proof.auxiliary_hashes.begin();
-
-    typedef std::pair<std::size_t, hash_digest_type> pos_and_digest_t;
-    std::vector<pos_and_digest_t> S;
-    S.reserve(positions.size());
-
-    std::vector<hash_digest_type> leaf_hashes;
-    if (this->make_zk_) {
-        for (auto &leaf : leaf_contents)
+    /* The current layer is kept as two flat arrays of node indices and digests.
+     * Each layer is at most as long as the one below it, so it is written in place. */
+    std::vector<std::size_t> S_positions(positions.size());
+    std::vector<hash_digest_type> S_digests(positions.size());
+    std::size_t S_size = 0;
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        if (positions[i] >= this->num_leaves_)
         {
-            const zk_salt_type zk_salt = *rand_it++;
-            leaf_hashes.emplace_back(this->leaf_hasher_->zk_hash(leaf, zk_salt));
+            throw std::invalid_argument("All positions must be between 0 and num_leaves-1.");
         }
-    } else {
-        for (auto &leaf : leaf_contents)
+        /* remove possible duplicates */
+        const std::size_t node_pos = positions[i] + (this->num_leaves_ - 1);
+        if (S_size > 0 && S_positions[S_size - 1] == node_pos)
         {
-            leaf_hashes.emplace_back(this->leaf_hasher_->hash(leaf));
+            if (S_digests[S_size - 1] != leaf_hashes[i])
+            {
+                throw std::invalid_argument("Duplicate position with unequal hash values.");
+            }
+            continue;
         }
+        S_positions[S_size] = node_pos;
+        S_digests[S_size] = leaf_hashes[i];
+        S_size++;
     }
 
-    // TODO: Refactor this to have a single std::vector all contents hashes, and make each case modify that
-    // with a single transform at the bottom.
-    std::transform(positions.begin(), positions.end(), leaf_hashes.begin(),
-                std::back_inserter(S),
-                [](const std::size_t pos, const hash_digest_type &hash) {
-                    return std::make_pair(pos, hash);
-                });
-
-    S.erase(std__unique(S.begin(), S.end()), S.end()); /* remove possible duplicates */
-
-    if (std__adjacent_find(S.begin(), S.end(),
-                           [] (const pos_and_digest_t &p1,
-                               const pos_and_digest_t &p2) {
-                               return (p1.first == p2.first && p1.second != p2.second);
-                           }) != S.end())
+    const std::vector<hash_digest_type> &aux = proof.auxiliary_hashes;
+    std::size_t aux_index = 0;
+    while (!(S_size == 1 && S_positions[0] == 0)) /* for every layer, until we reach the root */
     {
-        throw std::invalid_argument("Duplicate position with unequal hash values.");
-    }
-
-    if (std::any_of(S.begin(), S.end(),
-                    [this](const pos_and_digest_t &pos) {
-                        return pos.first >= this->num_leaves_;
-                    }))
-    {
-        throw std::invalid_argument("All positions must be between 0 and num_leaves-1.");
-    }
-
-    /* transform to sorted set of indices */
-    for (auto &pos : S)
-    {
-        pos.first += (this->num_leaves_ - 1);
-    }
-
-    while (true) /* for every layer */
-    {
-        auto it = S.begin();
-        if (it->first == 0 && it == --S.end())
-        {
-            /* we have arrived at the root */
-            break;
-        }
-
-        std::vector<std::pair<std::size_t, hash_digest_type> > new_S;
-        while (it != S.end())
+        std::size_t new_size = 0;
+        std::size_t i = 0;
+        while (i < S_size)
         {
-            const std::size_t it_pos = it->first;
-            const hash_digest_type it_hash = it->second;
-
-            auto next_it = ++it;
-
-            hash_digest_type left_hash;
-            hash_digest_type right_hash;
+            const std::size_t it_pos = S_positions[i];
+            const hash_digest_type *left_hash;
+            const hash_digest_type *right_hash;
 
             if ((it_pos & 1) == 0)
             {
                 /* We are the right node, so there was no left node
                    (o.w. would have been processed in b)
                    below). Take it from the auxiliary. */
-                left_hash = *aux_it++;
-                right_hash = it_hash;
-            }
-            else
-            {
-                /* We are the left node. Two cases: */
-                left_hash = it_hash;
-
-                if (next_it == S.end() || next_it->first != it_pos + 1)
+                if (aux_index == aux.size())
                 {
-                    /* a) Our right sibling is not in S, so we must
-                       take an auxiliary. */
-                    right_hash = *aux_it++;
+                    throw std::invalid_argument("The proof has too few auxiliary hashes.");
                 }
-                else
+                left_hash = &aux[aux_index++];
+                right_hash = &S_digests[i];
+                i += 1;
+            }
+            else if (i + 1 == S_size || S_positions[i + 1] != it_pos + 1)
+            {
+                /* a) We are the left node, and our right sibling is not in S,
+                   so we must take an auxiliary. */
+                if (aux_index == aux.size())
                 {
-                    /* b) Our right sibling is in S. So don't need
-                       auxiliary and skip over the right sibling.
-                       (Note that only one parent will be processed.)
-                    */
-                    right_hash = next_it->second;
-                    ++next_it;
+                    throw std::invalid_argument("The proof has too few auxiliary hashes.");
                 }
+                left_hash = &S_digests[i];
+                right_hash = &aux[aux_index++];
+                i += 1;
+            }
+            else
+            {
+                /* b) We are the left node, and our right sibling is in S. So don't need
+                   auxiliary and skip over the right sibling.
+                   (Note that only one parent will be processed.) */
+                left_hash = &S_digests[i];
+                right_hash = &S_digests[i + 1];
+                i += 2;
             }
 
-            const std::size_t parent_pos = (it_pos - 1)/2;
-            const hash_digest_type parent_hash = this->node_hasher_(left_hash, right_hash,
-                                                                    this->digest_len_bytes_);
-            new_S.emplace_back(std::make_pair(parent_pos, parent_hash));
-
-            it = next_it;
+            /* new_size < i here, so this never overwrites an unread entry */
+            S_digests[new_size] = this->node_hasher_(*left_hash, *right_hash, this->digest_len_bytes_);
+            S_positions[new_size] = (it_pos - 1) / 2;
+            new_size++;
         }
-
-        std::swap(S, new_S);
+        S_size = new_size;
     }
 
-    if (aux_it != proof.auxiliary_hashes.end())
+    if (aux_index != aux.size())
     {
         throw std::logic_error("Validation did not consume the entire proof.");
     }
 
-    return (S.begin()->second == root);
+    return (S_digests[0] == root);
 }
 
 template<typename FieldT, typename hash_digest_type>
@@ -538,5 +582,124 @@ std::size_t merkle_tree<FieldT, hash_digest_type>::num_total_bytes() const
     return (this->digest_len_bytes_ * (2 * this->num_leaves() - 1));
 }
 
+/* All digests of a tree have the same size, so they are written as one flat array. */
+inline void write_digests(std::ostream &out,
+                          const binary_hash_digest *digests,
+                          const std::size_t num_digests,
+                          const std::size_t digest_size)
+{
+    write_padding(out, binary_array_alignment);
+    for (std::size_t i = 0; i < num_digests; i++)
+    {
+        if (digests[i].size() != digest_size)
+        {
+            throw std::logic_error("Attempting to write digests of differing sizes.");
+        }
+        out.write(digests[i].data(), digest_size);
+    }
+}
+
+template<typename FieldT>
+void write_digests(std::ostream &out,
+                   const FieldT *digests,
+                   const std::size_t num_digests,
+                   const std::size_t digest_size)
+{
+    write_aligned_array<FieldT>(out, digests, num_digests);
+}
+
+/* Binary digests are strings, so they are always copied out of the input */
+inline void read_digests(byte_reader &in,
+                         const std::shared_ptr<const void> &,
+                         shared_buffer<binary_hash_digest> &digests,
+                         const std::size_t num_digests,
+                         const std::size_t digest_size)
+{
+    in.align(binary_array_alignment);
+    const char *data = reinterpret_cast<const char*>(in.advance(num_digests * digest_size));
+    std::vector<binary_hash_digest> contents;
+    contents.reserve(num_digests);
+    for (std::size_t i = 0; i < num_digests; i++)
+    {
+        contents.emplace_back(data + i * digest_size, digest_size);
+    }
+    digests = shared_buffer<binary_hash_digest>(std::move(contents));
+}
+
+template<typename FieldT>
+void read_digests(byte_reader &in,
+                  const std::shared_ptr<const void> &owner,
+                  shared_buffer<FieldT> &digests,
+                  const std::size_t num_digests,
+                  const std::size_t digest_size)
+{
+    if (digest_size != sizeof(FieldT))
+    {
+        throw std::invalid_argument("Serialized digests have the wrong size.");
+    }
+    digests = read_aligned_array<FieldT>(in, owner, num_digests);
+}
+
+inline std::size_t stored_digest_size(const binary_hash_digest &d, const std::size_t digest_len_bytes)
+{
+    return digest_len_bytes;
+}
+
+template<typename FieldT>
+std::size_t stored_digest_size(const FieldT &d, const std::size_t digest_len_bytes)
+{
+    return sizeof(FieldT);
+}
+
+template<typename FieldT, typename hash_digest_type>
+void merkle_tree<FieldT, hash_digest_type>::write_binary(std::ostream &out) const
+{
+    if (!this->constructed_)
+    {
+        throw std::logic_error("Attempting to serialize a Merkle tree without constructing the tree first.");
+    }
+    const std::uint64_t digest_size = stored_digest_size(hash_digest_type(), this->digest_len_bytes_);
+    write_value<std::uint64_t>(out, this->num_leaves_);
+    write_value<std::uint64_t>(out, this->digest_len_bytes_);
+    write_value<std::uint64_t>(out, digest_size);
+    write_value<std::uint8_t>(out, this->make_zk_ ? 1 : 0);
+    write_value<std::uint64_t>(out, this->num_zk_bytes_);
+    write_digests(out, this->inner_nodes_.data(), this->inner_nodes_.size(), digest_size);
+    if (this->make_zk_)
+    {
+        write_aligned_array<std::uint8_t>(out, this->zk_leaf_salts_.data(), this->zk_leaf_salts_.size());
+    }
+}
+
+template<typename FieldT, typename hash_digest_type>
+void merkle_tree<FieldT, hash_digest_type>::read_binary(byte_reader &in,
+                                                      const std::shared_ptr<const void> &owner)
+{
+    if (this->constructed_)
+    {
+        throw std::logic_error("Attempting to double-construct a Merkle tree.");
+    }
+    const std::size_t digest_size = stored_digest_size(hash_digest_type(), this->digest_len_bytes_);
+    const std::uint64_t num_leaves = in.read_value<std::uint64_t>();
+    const std::uint64_t digest_len_bytes = in.read_value<std::uint64_t>();
+    const std::uint64_t stored_size = in.read_value<std::uint64_t>();
+    const bool make_zk = (in.read_value<std::uint8_t>() != 0);
+    const std::uint64_t num_zk_bytes = in.read_value<std::uint64_t>();
+    if (num_leaves != this->num_leaves_ ||
+        digest_len_bytes != this->digest_len_bytes_ ||
+        stored_size != digest_size ||
+        make_zk != this->make_zk_ ||
+        num_zk_bytes != this->num_zk_bytes_)
+    {
+        throw std::invalid_argument("Serialized Merkle tree does not match this tree's configuration.");
+    }
+    read_digests(in, owner, this->inner_nodes_, 2 * this->num_leaves_ - 1, digest_size);
+    if (this->make_zk_)
+    {
+        this->zk_leaf_salts_ = read_aligned_array<std::uint8_t>(
+            in, owner, this->num_leaves_ * this->num_zk_bytes_);
+    }
+    this->constructed_ = true;
+}
 
 } // libiop
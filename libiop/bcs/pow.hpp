@@ -32,6 +32,7 @@ public:
     size_t pow_bitlen() const;
     size_t pow_upperbound() const;
     size_t work_parameter() const;
+    size_t cost_per_hash() const;
 
     void print() const;
 };
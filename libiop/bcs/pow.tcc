@@ -3,6 +3,7 @@
 
 #include <libff/common/profiling.hpp>
 #include "libiop/common/cpp17_bits.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 
 #include <sodium/randombytes.h>
@@ -43,6 +44,11 @@ size_t pow_parameters::work_parameter() const
     return this->work_parameter_;
 }
 
+size_t pow_parameters::cost_per_hash() const
+{
+    return this->cost_per_hash_;
+}
+
 
 void pow_parameters::print() const
 {
@@ -108,6 +114,7 @@ bool pow<FieldT, hash_digest_type>::verify_pow(
     const hash_digest_type &pow) const
 {
     hash_digest_type hash = node_hasher(challenge, pow, this->digest_len_bytes_);
+    LIBIOP_TRACE_COUNT(hashes, 1);
     return this->verify_pow_internal(hash);
 }
 
@@ -4,6 +4,7 @@
 #include <libff/algebra/field_utils/field_utils.hpp>
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 
 namespace libiop {
@@ -31,6 +32,26 @@ static void BM_alt_bn128_mul_vec(benchmark::State &state)
 
 BENCHMARK(BM_alt_bn128_mul_vec)->Range(1<<10, 1<<20)->Unit(benchmark::kMicrosecond);
 
+static void BM_alt_bn128_butterfly_vec(benchmark::State &state)
+{
+    libff::alt_bn128_pp::init_public_params();
+    typedef libff::alt_bn128_Fr FieldT;
+    const size_t sz = state.range(0);
+    const std::vector<FieldT> wvec = random_vector<FieldT>(sz);
+    std::vector<FieldT> lo = random_vector<FieldT>(sz);
+    std::vector<FieldT> hi = random_vector<FieldT>(sz);
+
+    for (auto _ : state)
+    {
+        vector_butterfly<FieldT>(wvec.data(), lo.data(), hi.data(), sz);
+        benchmark::DoNotOptimize(lo.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_alt_bn128_butterfly_vec)->Range(1<<10, 1<<20)->Unit(benchmark::kMicrosecond);
+
 static void BM_alt_bn128_mul_vec_data_dependency(benchmark::State &state)
 {
     libff::alt_bn128_pp::init_public_params();
@@ -76,6 +97,44 @@ static void BM_alt_bn128_inverse_vec(benchmark::State& state)
 
 BENCHMARK(BM_alt_bn128_inverse_vec)->Range(1<<10, 1<<16)->Unit(benchmark::kMicrosecond);
 
+static void BM_alt_bn128_random_element(benchmark::State &state)
+{
+    libff::alt_bn128_pp::init_public_params();
+    typedef libff::alt_bn128_Fr FieldT;
+    const size_t sz = state.range(0);
+    std::vector<FieldT> vec(sz);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < sz; ++i)
+        {
+            vec[i] = FieldT::random_element();
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_alt_bn128_random_element)->Range(1<<10, 1<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_alt_bn128_random_vector_bulk(benchmark::State &state)
+{
+    libff::alt_bn128_pp::init_public_params();
+    typedef libff::alt_bn128_Fr FieldT;
+    const size_t sz = state.range(0);
+
+    for (auto _ : state)
+    {
+        const std::vector<FieldT> vec = random_FieldT_vector<FieldT>(sz);
+        benchmark::DoNotOptimize(vec.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_alt_bn128_random_vector_bulk)->Range(1<<10, 1<<20)->Unit(benchmark::kMicrosecond);
+
 }
 
 BENCHMARK_MAIN();
@@ -59,6 +59,30 @@ static void BM_additive_FFT(benchmark::State &state)
 
 BENCHMARK(BM_additive_FFT)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
 
+/* Low degree extension with a blowup of 2^4, the common shape for an LDE. */
+static void BM_additive_FFT_degree_aware(benchmark::State &state)
+{
+    typedef libff::gf64 FieldT;
+
+    const size_t sz = state.range(0);
+    const size_t log_sz = libff::log2(sz);
+    const size_t log_blowup = 4;
+
+    const std::vector<FieldT> poly_coeffs = random_vector<FieldT>(sz >> log_blowup);
+
+    const affine_subspace<FieldT> domain =
+        affine_subspace<FieldT>::random_affine_subspace(log_sz);
+
+    for (auto _ : state)
+    {
+        const std::vector<FieldT> result = additive_FFT<FieldT>(poly_coeffs, domain);
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_additive_FFT_degree_aware)->Range(1ull<<6, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
 static void BM_additive_IFFT(benchmark::State &state)
 {
     typedef libff::gf64 FieldT;
@@ -0,0 +1,491 @@
+/**@file
+ *****************************************************************************
+ End-to-end benchmarks of the Aurora, Fractal, Ligero and FRI SNARKs.
+
+ Each SNARK's prover and verifier (and Fractal's indexer) are timed on the
+ R1CS examples used by profiling/instrument_*_snark.cpp, over a binary field
+ (gf64) and a prime field (alt_bn128), with Blake2b and, over the prime field,
+ Poseidon. Every benchmark is parameterized by log_n, whether the argument is
+ zero knowledge, and the number of OpenMP threads. Without MULTICORE, only
+ one thread is run.
+
+ Besides the time, each benchmark reports the proof size in bytes, and the
+ peak resident set size of the benchmarked code. When built with
+ MEMORY_ACCOUNTING, the peak heap bytes are reported too. To track regressions, write
+ the results as JSON with:
+
+   ./benchmark_snarks --benchmark_out=snarks.json --benchmark_out_format=json
+
+ and select a subset with, e.g., --benchmark_filter='BM_aurora_prover<.*gf64'.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+#include <sys/resource.h>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+#include <libff/algebra/field_utils/field_utils.hpp>
+#include <libff/algebra/fields/binary/gf64.hpp>
+#include <libff/common/profiling.hpp>
+#include <libff/common/utils.hpp>
+#include "libiop/algebra/polynomials/polynomial.hpp"
+#include "libiop/bcs/bcs_common.hpp"
+#include "libiop/common/memory_accounting.hpp"
+#include "libiop/relations/examples/r1cs_examples.hpp"
+#include "libiop/snark/aurora_snark.hpp"
+#include "libiop/snark/fractal_snark.hpp"
+#include "libiop/snark/fri_snark.hpp"
+#include "libiop/snark/ligero_snark.hpp"
+
+namespace libiop {
+
+const size_t benchmark_security_level = 128;
+
+/* Argument order of every benchmark: log_n, make_zk (except FRI), threads */
+static void snark_arguments(benchmark::internal::Benchmark *benchmark, const bool sweep_zk)
+{
+    std::vector<int> thread_counts = { 1 };
+#ifdef MULTICORE
+    for (int threads = 2; threads <= omp_get_max_threads(); threads *= 2)
+    {
+        thread_counts.emplace_back(threads);
+    }
+    if (thread_counts.back() != omp_get_max_threads())
+    {
+        thread_counts.emplace_back(omp_get_max_threads());
+    }
+#endif
+    if (sweep_zk)
+    {
+        benchmark->ArgNames({ "log_n", "zk", "threads" });
+    }
+    else
+    {
+        benchmark->ArgNames({ "log_n", "threads" });
+    }
+    for (int log_n = 10; log_n <= 16; log_n += 2)
+    {
+        for (const int threads : thread_counts)
+        {
+            if (sweep_zk)
+            {
+                benchmark->Args({ log_n, 0, threads });
+                benchmark->Args({ log_n, 1, threads });
+            }
+            else
+            {
+                benchmark->Args({ log_n, threads });
+            }
+        }
+    }
+}
+
+static void r1cs_snark_arguments(benchmark::internal::Benchmark *benchmark)
+{
+    snark_arguments(benchmark, true);
+}
+
+static void FRI_snark_arguments(benchmark::internal::Benchmark *benchmark)
+{
+    snark_arguments(benchmark, false);
+}
+
+static void set_benchmark_threads(const int64_t threads)
+{
+#ifdef MULTICORE
+    omp_set_num_threads((int)threads);
+#else
+    libff::UNUSED(threads);
+#endif
+}
+
+/** Resets the peak resident set size of the process, where the kernel supports it
+ *  (Linux 4.0 onwards), so that it only covers the code benchmarked after this call.
+ *  Elsewhere the reported peak is the high-water mark of the whole run. */
+static void reset_peak_memory()
+{
+    reset_peak_heap_bytes();
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs)
+    {
+        clear_refs << "5";
+    }
+}
+
+static size_t peak_memory_bytes()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return std::stoull(line.substr(6)) * 1024;
+        }
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (size_t)usage.ru_maxrss * 1024;
+}
+
+static void report_snark_metrics(benchmark::State &state, const size_t proof_size_in_bytes)
+{
+    state.counters["proof_bytes"] = (double)proof_size_in_bytes;
+    state.counters["peak_RSS_bytes"] = (double)peak_memory_bytes();
+    if (memory_accounting_enabled())
+    {
+        state.counters["peak_heap_bytes"] = (double)peak_heap_bytes();
+    }
+}
+
+template<typename FieldT>
+static void init_benchmark_field()
+{
+    /* The proving phases would otherwise print their profiling output on every iteration */
+    libff::inhibit_profiling_info = true;
+    if (std::is_same<FieldT, libff::alt_bn128_Fr>::value)
+    {
+        libff::alt_bn128_pp::init_public_params();
+    }
+}
+
+template<typename FieldT>
+static field_subset_type benchmark_domain_type()
+{
+    return libff::get_field_type<FieldT>(FieldT::zero()) == libff::multiplicative_field_type ?
+        multiplicative_coset_type : affine_subspace_type;
+}
+
+/* Poseidon hashes to field elements, so the hash type identifies the hash */
+template<typename FieldT, typename hash_type>
+static bcs_hash_type benchmark_hash_enum()
+{
+    return std::is_same<hash_type, binary_hash_digest>::value ? blake2b_type : starkware_poseidon_type;
+}
+
+template<typename FieldT>
+static r1cs_example<FieldT> benchmark_r1cs_example(const size_t log_n, const size_t k)
+{
+    const size_t n = 1ul << log_n;
+    return generate_r1cs_example<FieldT>(n, k, n - 1);
+}
+
+/* Aurora */
+
+template<typename FieldT, typename hash_type>
+static aurora_snark_parameters<FieldT, hash_type> aurora_benchmark_parameters(
+    const r1cs_example<FieldT> &example, const bool make_zk)
+{
+    return aurora_snark_parameters<FieldT, hash_type>(
+        benchmark_security_level,
+        LDT_reducer_soundness_type::optimistic_heuristic,
+        FRI_soundness_type::heuristic,
+        benchmark_hash_enum<FieldT, hash_type>(),
+        2,
+        3 + (make_zk ? 0 : 2),
+        make_zk,
+        benchmark_domain_type<FieldT>(),
+        example.constraint_system_.num_constraints(),
+        example.constraint_system_.num_variables());
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_aurora_prover(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(state.range(0), 15);
+    const aurora_snark_parameters<FieldT, hash_type> parameters =
+        aurora_benchmark_parameters<FieldT, hash_type>(example, state.range(1));
+
+    size_t proof_size = 0;
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const aurora_snark_argument<FieldT, hash_type> proof = aurora_snark_prover<FieldT, hash_type>(
+            example.constraint_system_, example.primary_input_, example.auxiliary_input_, parameters);
+        proof_size = proof.size_in_bytes();
+    }
+    report_snark_metrics(state, proof_size);
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_aurora_verifier(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(state.range(0), 15);
+    const aurora_snark_parameters<FieldT, hash_type> parameters =
+        aurora_benchmark_parameters<FieldT, hash_type>(example, state.range(1));
+    const aurora_snark_argument<FieldT, hash_type> proof = aurora_snark_prover<FieldT, hash_type>(
+        example.constraint_system_, example.primary_input_, example.auxiliary_input_, parameters);
+
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const bool verified = aurora_snark_verifier<FieldT, hash_type>(
+            example.constraint_system_, example.primary_input_, proof, parameters);
+        if (!verified)
+        {
+            state.SkipWithError("Aurora proof was rejected");
+            break;
+        }
+    }
+    report_snark_metrics(state, proof.size_in_bytes());
+}
+
+/* Fractal */
+
+template<typename FieldT, typename hash_type>
+static fractal_snark_parameters<FieldT, hash_type> fractal_benchmark_parameters(
+    const r1cs_example<FieldT> &example, const bool make_zk)
+{
+    return fractal_snark_parameters<FieldT, hash_type>(
+        benchmark_security_level,
+        LDT_reducer_soundness_type::optimistic_heuristic,
+        FRI_soundness_type::heuristic,
+        benchmark_hash_enum<FieldT, hash_type>(),
+        2,
+        3,
+        make_zk,
+        benchmark_domain_type<FieldT>(),
+        std::make_shared<r1cs_constraint_system<FieldT>>(example.constraint_system_));
+}
+
+/* k + 1 must be a power of 2 over binary fields, while Fractal over prime fields needs k = 0 */
+template<typename FieldT>
+static size_t fractal_benchmark_primary_input_size()
+{
+    return benchmark_domain_type<FieldT>() == multiplicative_coset_type ? 0 : 15;
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_fractal_indexer(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(
+        state.range(0), fractal_benchmark_primary_input_size<FieldT>());
+    const fractal_snark_parameters<FieldT, hash_type> parameters =
+        fractal_benchmark_parameters<FieldT, hash_type>(example, state.range(1));
+
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
+            fractal_snark_indexer(parameters);
+        benchmark::DoNotOptimize(&index);
+    }
+    report_snark_metrics(state, 0);
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_fractal_prover(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(
+        state.range(0), fractal_benchmark_primary_input_size<FieldT>());
+    const fractal_snark_parameters<FieldT, hash_type> parameters =
+        fractal_benchmark_parameters<FieldT, hash_type>(example, state.range(1));
+    const std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
+        fractal_snark_indexer(parameters);
+
+    size_t proof_size = 0;
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const fractal_snark_argument<FieldT, hash_type> proof = fractal_snark_prover<FieldT, hash_type>(
+            index.first, example.primary_input_, example.auxiliary_input_, parameters);
+        proof_size = proof.size_in_bytes();
+    }
+    report_snark_metrics(state, proof_size);
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_fractal_verifier(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(
+        state.range(0), fractal_benchmark_primary_input_size<FieldT>());
+    const fractal_snark_parameters<FieldT, hash_type> parameters =
+        fractal_benchmark_parameters<FieldT, hash_type>(example, state.range(1));
+    const std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
+        fractal_snark_indexer(parameters);
+    const fractal_snark_argument<FieldT, hash_type> proof = fractal_snark_prover<FieldT, hash_type>(
+        index.first, example.primary_input_, example.auxiliary_input_, parameters);
+
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const bool verified = fractal_snark_verifier<FieldT, hash_type>(
+            index.second, example.primary_input_, proof, parameters);
+        if (!verified)
+        {
+            state.SkipWithError("Fractal proof was rejected");
+            break;
+        }
+    }
+    report_snark_metrics(state, proof.size_in_bytes());
+}
+
+/* Ligero */
+
+template<typename FieldT, typename hash_type>
+static ligero_snark_parameters<FieldT, hash_type> ligero_benchmark_parameters(
+    const size_t log_n, const bool make_zk)
+{
+    ligero_snark_parameters<FieldT, hash_type> parameters;
+    parameters.security_level_ = benchmark_security_level;
+    parameters.LDT_reducer_soundness_type_ = LDT_reducer_soundness_type::optimistic_heuristic;
+    parameters.height_width_ratio_ = 0.1;
+    parameters.RS_extra_dimensions_ = 2;
+    parameters.make_zk_ = make_zk;
+    parameters.domain_type_ = benchmark_domain_type<FieldT>();
+    parameters.bcs_params_ = default_bcs_params<FieldT, hash_type>(
+        benchmark_hash_enum<FieldT, hash_type>(), benchmark_security_level, log_n);
+    return parameters;
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_ligero_prover(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(state.range(0), 15);
+    const ligero_snark_parameters<FieldT, hash_type> parameters =
+        ligero_benchmark_parameters<FieldT, hash_type>(state.range(0), state.range(1));
+
+    size_t proof_size = 0;
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const ligero_snark_argument<FieldT, hash_type> proof = ligero_snark_prover<FieldT, hash_type>(
+            example.constraint_system_, example.primary_input_, example.auxiliary_input_, parameters);
+        proof_size = proof.size_in_bytes();
+    }
+    report_snark_metrics(state, proof_size);
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_ligero_verifier(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(2));
+    const r1cs_example<FieldT> example = benchmark_r1cs_example<FieldT>(state.range(0), 15);
+    const ligero_snark_parameters<FieldT, hash_type> parameters =
+        ligero_benchmark_parameters<FieldT, hash_type>(state.range(0), state.range(1));
+    const ligero_snark_argument<FieldT, hash_type> proof = ligero_snark_prover<FieldT, hash_type>(
+        example.constraint_system_, example.primary_input_, example.auxiliary_input_, parameters);
+
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const bool verified = ligero_snark_verifier<FieldT, hash_type>(
+            example.constraint_system_, example.primary_input_, proof, parameters);
+        if (!verified)
+        {
+            state.SkipWithError("Ligero proof was rejected");
+            break;
+        }
+    }
+    report_snark_metrics(state, proof.size_in_bytes());
+}
+
+/* FRI, on a random polynomial of degree less than 2^{log_n} */
+
+template<typename FieldT, typename hash_type>
+static FRI_snark_parameters<FieldT> FRI_benchmark_parameters(const size_t log_n)
+{
+    const size_t RS_extra_dimensions = 2;
+    FRI_snark_parameters<FieldT> parameters;
+    parameters.codeword_domain_dim_ = log_n + RS_extra_dimensions;
+    parameters.security_level_ = benchmark_security_level;
+    parameters.hash_enum_ = benchmark_hash_enum<FieldT, hash_type>();
+    parameters.RS_extra_dimensions_ = RS_extra_dimensions;
+    parameters.localization_parameter_ = 2;
+    parameters.num_interactive_repetitions_ = 1;
+    parameters.num_query_repetitions_ = 64;
+    parameters.num_oracles_ = 1;
+    parameters.field_type_ = libff::get_field_type<FieldT>(FieldT::zero());
+    return parameters;
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_FRI_prover(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(1));
+    const FRI_snark_parameters<FieldT> parameters = FRI_benchmark_parameters<FieldT, hash_type>(state.range(0));
+
+    size_t proof_size = 0;
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const FRI_snark_proof<FieldT, hash_type> proof = FRI_snark_prover<FieldT, hash_type>(parameters);
+        proof_size = proof.size_in_bytes();
+    }
+    report_snark_metrics(state, proof_size);
+}
+
+template<typename FieldT, typename hash_type>
+static void BM_FRI_verifier(benchmark::State &state)
+{
+    init_benchmark_field<FieldT>();
+    set_benchmark_threads(state.range(1));
+    const FRI_snark_parameters<FieldT> parameters = FRI_benchmark_parameters<FieldT, hash_type>(state.range(0));
+    const FRI_snark_proof<FieldT, hash_type> proof = FRI_snark_prover<FieldT, hash_type>(parameters);
+
+    reset_peak_memory();
+    for (auto _ : state)
+    {
+        const bool verified = FRI_snark_verifier<FieldT, hash_type>(proof, parameters);
+        if (!verified)
+        {
+            state.SkipWithError("FRI proof was rejected");
+            break;
+        }
+    }
+    report_snark_metrics(state, proof.size_in_bytes());
+}
+
+/* The provers are multithreaded, so wall clock time is what matters */
+#define LIBIOP_BENCHMARK_SNARK(benchmark_function, arguments, FieldT, hash_type) \
+    BENCHMARK_TEMPLATE(benchmark_function, FieldT, hash_type) \
+        ->Apply(arguments)->UseRealTime()->Unit(benchmark::kMillisecond)
+
+#define LIBIOP_BENCHMARK_R1CS_SNARK(benchmark_function) \
+    LIBIOP_BENCHMARK_SNARK(benchmark_function, r1cs_snark_arguments, libff::gf64, binary_hash_digest); \
+    LIBIOP_BENCHMARK_SNARK(benchmark_function, r1cs_snark_arguments, libff::alt_bn128_Fr, binary_hash_digest); \
+    LIBIOP_BENCHMARK_SNARK(benchmark_function, r1cs_snark_arguments, libff::alt_bn128_Fr, libff::alt_bn128_Fr)
+
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_aurora_prover);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_aurora_verifier);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_fractal_indexer);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_fractal_prover);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_fractal_verifier);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_ligero_prover);
+LIBIOP_BENCHMARK_R1CS_SNARK(BM_ligero_verifier);
+
+LIBIOP_BENCHMARK_SNARK(BM_FRI_prover, FRI_snark_arguments, libff::gf64, binary_hash_digest);
+LIBIOP_BENCHMARK_SNARK(BM_FRI_prover, FRI_snark_arguments, libff::alt_bn128_Fr, binary_hash_digest);
+LIBIOP_BENCHMARK_SNARK(BM_FRI_verifier, FRI_snark_arguments, libff::gf64, binary_hash_digest);
+LIBIOP_BENCHMARK_SNARK(BM_FRI_verifier, FRI_snark_arguments, libff::alt_bn128_Fr, binary_hash_digest);
+
+}
+
+BENCHMARK_MAIN();
@@ -6,6 +6,7 @@
 #include <libff/algebra/fields/binary/gf64.hpp>
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
 
 namespace libiop {
 
@@ -41,6 +42,147 @@ static void BM_random_gf64_vector(benchmark::State &state)
 
 BENCHMARK(BM_random_gf64_vector)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
 
+/* The *_scalar benchmarks call the generic loops explicitly, while the
+   others go through the gf64 overloads. */
+
+static void BM_gf64_axpy_scalar(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const libff::gf64 a = libff::gf64::random_element();
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        vector_axpy<libff::gf64>(a, x.data(), y.data(), sz);
+        benchmark::DoNotOptimize(y.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_axpy_scalar)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_axpy(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const libff::gf64 a = libff::gf64::random_element();
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        vector_axpy(a, x.data(), y.data(), sz);
+        benchmark::DoNotOptimize(y.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_axpy)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_pointwise_multiply_scalar(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    const std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+    std::vector<libff::gf64> z(sz);
+
+    for (auto _ : state)
+    {
+        vector_pointwise_multiply<libff::gf64>(x.data(), y.data(), z.data(), sz);
+        benchmark::DoNotOptimize(z.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_pointwise_multiply_scalar)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_pointwise_multiply(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    const std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+    std::vector<libff::gf64> z(sz);
+
+    for (auto _ : state)
+    {
+        vector_pointwise_multiply(x.data(), y.data(), z.data(), sz);
+        benchmark::DoNotOptimize(z.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_pointwise_multiply)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_scale_scalar(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const libff::gf64 a = libff::gf64::random_element();
+    std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        vector_scale<libff::gf64>(a, x.data(), sz);
+        benchmark::DoNotOptimize(x.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_scale_scalar)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_scale(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const libff::gf64 a = libff::gf64::random_element();
+    std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        vector_scale(a, x.data(), sz);
+        benchmark::DoNotOptimize(x.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_scale)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_dot_product_scalar(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    const std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(vector_dot_product<libff::gf64>(x.data(), y.data(), sz));
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_dot_product_scalar)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
+static void BM_gf64_dot_product(benchmark::State &state)
+{
+    const size_t sz = state.range(0);
+    const std::vector<libff::gf64> x = random_vector<libff::gf64>(sz);
+    const std::vector<libff::gf64> y = random_vector<libff::gf64>(sz);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(vector_dot_product(x.data(), y.data(), sz));
+    }
+
+    state.SetItemsProcessed(state.iterations() * sz);
+}
+
+BENCHMARK(BM_gf64_dot_product)->Range(1ull<<4, 1ull<<20)->Unit(benchmark::kMicrosecond);
+
 }
 
 BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+#include "libiop/common/binary_io.hpp"
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace libiop {
+
+#ifndef _WIN32
+
+mapped_file::mapped_file(const std::string &path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Could not open " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("Could not stat " + path);
+    }
+    this->size_ = (std::size_t)st.st_size;
+    if (this->size_ == 0)
+    {
+        close(fd);
+        return;
+    }
+    void *mapping = mmap(NULL, this->size_, PROT_READ, MAP_SHARED, fd, 0);
+    /* The mapping stays valid after the descriptor is closed */
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Could not mmap " + path);
+    }
+    this->data_ = static_cast<const std::uint8_t*>(mapping);
+}
+
+mapped_file::~mapped_file()
+{
+    if (this->data_ != nullptr)
+    {
+        munmap(const_cast<std::uint8_t*>(this->data_), this->size_);
+    }
+}
+
+#else
+
+mapped_file::mapped_file(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+    {
+        throw std::runtime_error("Could not open " + path);
+    }
+    this->size_ = (std::size_t)in.tellg();
+    in.seekg(0);
+    this->fallback_buffer_.resize(this->size_);
+    in.read(reinterpret_cast<char*>(this->fallback_buffer_.data()), this->size_);
+    this->data_ = this->fallback_buffer_.data();
+}
+
+mapped_file::~mapped_file()
+{
+}
+
+#endif
+
+} // namespace libiop
@@ -0,0 +1,154 @@
+/**@file
+ *****************************************************************************
+ Read-only memory mapped files, and helpers for reading and writing
+ flat binary data.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_BINARY_IO_HPP_
+#define LIBIOP_COMMON_BINARY_IO_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "libiop/common/shared_buffer.hpp"
+
+namespace libiop {
+
+/** Maps an entire file into memory, read only.
+ *  Pages are loaded by the OS on first access, and are shared between all
+ *  processes mapping the same file. The file must not be truncated while it is
+ *  mapped. On platforms without mmap, the file is read into memory instead.
+ *  Throws std::runtime_error if the file cannot be opened or mapped. */
+class mapped_file {
+protected:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+    std::vector<std::uint8_t> fallback_buffer_;
+public:
+    explicit mapped_file(const std::string &path);
+    ~mapped_file();
+
+    mapped_file(const mapped_file &other) = delete;
+    mapped_file &operator=(const mapped_file &other) = delete;
+
+    const std::uint8_t *data() const { return this->data_; }
+    std::size_t size() const { return this->size_; }
+};
+
+/* Arrays which are read in place are aligned to this many bytes from the start of the file */
+const std::size_t binary_array_alignment = 64;
+
+/** Sequential reader over a range of bytes.
+ *  Throws std::runtime_error when reading past the end of the range. */
+class byte_reader {
+protected:
+    const std::uint8_t *begin_;
+    const std::uint8_t *cur_;
+    const std::uint8_t *end_;
+public:
+    byte_reader(const std::uint8_t *begin, const std::uint8_t *end) :
+        begin_(begin), cur_(begin), end_(end) {};
+
+    /* Returns a pointer to the next num_bytes bytes, and skips over them */
+    const std::uint8_t *advance(const std::size_t num_bytes)
+    {
+        if (num_bytes > (std::size_t)(this->end_ - this->cur_))
+        {
+            throw std::runtime_error("Attempted to read past the end of the input.");
+        }
+        const std::uint8_t *result = this->cur_;
+        this->cur_ += num_bytes;
+        return result;
+    }
+
+    void read(void *out, const std::size_t num_bytes)
+    {
+        std::memcpy(out, this->advance(num_bytes), num_bytes);
+    }
+
+    template<typename T>
+    T read_value()
+    {
+        T result;
+        this->read(&result, sizeof(T));
+        return result;
+    }
+
+    /* Skips the padding written by write_padding */
+    void align(const std::size_t alignment)
+    {
+        const std::size_t offset = (std::size_t)(this->cur_ - this->begin_);
+        this->advance((alignment - offset % alignment) % alignment);
+    }
+
+    bool at_end() const { return this->cur_ == this->end_; }
+};
+
+template<typename T>
+void write_value(std::ostream &out, const T &value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/* Pads the output with zeros to a multiple of alignment bytes from the start of the stream */
+inline void write_padding(std::ostream &out, const std::size_t alignment)
+{
+    const std::streamoff offset = out.tellp();
+    if (offset < 0)
+    {
+        throw std::runtime_error("Cannot align output to a stream without a position.");
+    }
+    std::size_t padding = (alignment - (std::size_t)offset % alignment) % alignment;
+    const char zeros[binary_array_alignment] = {};
+    while (padding > 0)
+    {
+        const std::size_t chunk = std::min(padding, sizeof(zeros));
+        out.write(zeros, chunk);
+        padding -= chunk;
+    }
+}
+
+/* Writes an array so that read_aligned_array can read it in place */
+template<typename T>
+void write_aligned_array(std::ostream &out, const T *data, const std::size_t size)
+{
+    write_padding(out, binary_array_alignment);
+    out.write(reinterpret_cast<const char*>(data), size * sizeof(T));
+}
+
+/** Reads an array of size elements written by write_aligned_array.
+ *  If owner keeps the bytes under in alive, e.g. as the mapped_file they are in,
+ *  and they are suitably aligned in memory, the result views them in place.
+ *  Otherwise, e.g. if owner is null, they are copied. */
+template<typename T>
+shared_buffer<T> read_aligned_array(byte_reader &in,
+                                    const std::shared_ptr<const void> &owner,
+                                    const std::size_t size)
+{
+    if (size > (std::size_t)(-1) / sizeof(T))
+    {
+        throw std::runtime_error("Attempted to read past the end of the input.");
+    }
+    in.align(binary_array_alignment);
+    const std::uint8_t *data = in.advance(size * sizeof(T));
+    if (owner != nullptr && reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0)
+    {
+        return shared_buffer<T>(owner, reinterpret_cast<const T*>(data), size);
+    }
+    std::vector<T> contents(size);
+    std::memcpy(contents.data(), data, size * sizeof(T));
+    return shared_buffer<T>(std::move(contents));
+}
+
+} // namespace libiop
+
+#endif // LIBIOP_COMMON_BINARY_IO_HPP_
@@ -0,0 +1,95 @@
+#include "libiop/common/huge_pages.hpp"
+
+#include <cstdint>
+
+#include <libff/common/utils.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace libiop {
+
+namespace {
+
+thread_local oracle_page_policy current_policy = oracle_page_policy::default_pages;
+
+std::size_t base_page_size()
+{
+#ifdef __linux__
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size > 0)
+    {
+        return static_cast<std::size_t>(page_size);
+    }
+#endif
+    return 4096;
+}
+
+} // namespace
+
+const char* oracle_page_policy_to_string(oracle_page_policy policy)
+{
+    if (policy == oracle_page_policy::default_pages)
+    {
+        return "default pages";
+    }
+    else if (policy == oracle_page_policy::transparent_huge_pages)
+    {
+        return "transparent huge pages";
+    }
+    return "Invalid oracle page policy";
+}
+
+bool huge_pages_enabled()
+{
+    return current_policy == oracle_page_policy::transparent_huge_pages;
+}
+
+scoped_oracle_page_policy::scoped_oracle_page_policy(const oracle_page_policy policy) :
+    enclosing_policy_(current_policy)
+{
+    current_policy = policy;
+}
+
+scoped_oracle_page_policy::~scoped_oracle_page_policy()
+{
+    current_policy = this->enclosing_policy_;
+}
+
+void prepare_huge_pages(void *data, const std::size_t num_bytes, const bool parallel_first_touch)
+{
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(data);
+    const std::uintptr_t end = begin + num_bytes;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    /* Only whole huge pages can be promoted. The advice may be refused,
+       e.g. when transparent huge pages are disabled, which is harmless. */
+    const std::uintptr_t aligned_begin = (begin + huge_page_size - 1) & ~(huge_page_size - 1);
+    const std::uintptr_t aligned_end = end & ~(huge_page_size - 1);
+    if (aligned_begin < aligned_end)
+    {
+        madvise(reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MADV_HUGEPAGE);
+    }
+#endif
+
+    /* Touch every base page, so that pages which are not promoted are placed too.
+       In parallel, the static schedule hands each thread the same contiguous
+       share of the buffer as it gets in a statically scheduled loop filling it. */
+    const std::size_t page_size = base_page_size();
+    const std::uintptr_t first_page = begin & ~(page_size - 1);
+    const std::size_t num_pages = (end - first_page + page_size - 1) / page_size;
+    volatile char *bytes = static_cast<volatile char*>(data);
+    libff::UNUSED(parallel_first_touch);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static) if(parallel_first_touch)
+#endif
+    for (std::size_t i = 0; i < num_pages; ++i)
+    {
+        const std::uintptr_t page = first_page + i * page_size;
+        const std::uintptr_t address = (page < begin) ? begin : page;
+        bytes[address - begin] = 0;
+    }
+}
+
+} // namespace libiop
@@ -0,0 +1,83 @@
+/**@file
+ *****************************************************************************
+ Huge page backing for codeword-sized buffers.
+
+ Oracles over the codeword domain, and the FFT and FRI folding buffers which
+ produce them, can each span gigabytes, and are walked with large strides by
+ the FFT butterflies and the coset-wise leaf gathering of the Merkle trees.
+ With 4 KB pages, much of that walk misses the TLB.
+
+ When the transparent_huge_pages policy is in force, reserve_oracle_buffer
+ advises the kernel to back a fresh buffer with 2 MB transparent huge pages
+ (madvise(MADV_HUGEPAGE)), and then first touches it, so that its pages are
+ placed on the NUMA node of the thread that will fill it. By default that is
+ the calling thread, as the FFT and low degree extension loops that fill these
+ buffers run on it, or write to the whole buffer from every thread. Only a
+ buffer filled by an omp for schedule(static) loop over its elements, such as
+ the next FRI codeword, which is folded coset by coset, should be touched in
+ parallel, so that each thread touches the same contiguous share as it later
+ fills. The buffers remain plain std::vectors.
+
+ The policy is chosen by the oracle_page_policy_ of the BCS transformation
+ parameters. Like scoped_proof_arena, it is installed per thread by the
+ prover or indexer that asks for it, so other provers, verifiers and
+ unrelated FFTs are unaffected. OpenMP worker threads use default pages.
+ It is only advice: where transparent huge pages are disabled, or off
+ Linux, buffers are backed as usual.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_HUGE_PAGES_HPP_
+#define LIBIOP_COMMON_HUGE_PAGES_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libiop {
+
+enum class oracle_page_policy {
+    /** Buffers are backed by whatever the allocator and kernel choose */
+    default_pages = 1,
+    /** Codeword-sized buffers are advised as transparent huge pages */
+    transparent_huge_pages = 2,
+};
+
+const char* oracle_page_policy_to_string(oracle_page_policy policy);
+
+/** Size of a transparent huge page on x86-64 and (with 4 KB base pages) AArch64 */
+static const std::size_t huge_page_size = 1ull << 21;
+
+/** Whether the policy in force on the calling thread requests huge pages */
+bool huge_pages_enabled();
+
+/** Puts the given policy in force on the calling thread for the lifetime of
+ *  this object, after which the enclosing policy is restored. */
+class scoped_oracle_page_policy {
+protected:
+    oracle_page_policy enclosing_policy_;
+public:
+    explicit scoped_oracle_page_policy(const oracle_page_policy policy);
+    ~scoped_oracle_page_policy();
+
+    scoped_oracle_page_policy(const scoped_oracle_page_policy &other) = delete;
+    scoped_oracle_page_policy &operator=(const scoped_oracle_page_policy &other) = delete;
+};
+
+/** Advises the huge-page-aligned interior of [data, data + num_bytes) as huge pages,
+ *  and first touches every page of the range: on the calling thread, or with
+ *  parallel_first_touch under MULTICORE, in an omp for schedule(static) loop.
+ *  The range must be allocated, but must not yet hold any live objects. */
+void prepare_huge_pages(void *data, const std::size_t num_bytes, const bool parallel_first_touch = false);
+
+/** Reserves room for n elements in v. If v is empty, huge pages are enabled,
+ *  and the buffer spans at least one huge page, the fresh buffer is prepared
+ *  with prepare_huge_pages before any elements are written to it. */
+template<typename T>
+void reserve_oracle_buffer(std::vector<T> &v, const std::size_t n, const bool parallel_first_touch = false);
+
+} // namespace libiop
+
+#include "libiop/common/huge_pages.tcc"
+
+#endif // LIBIOP_COMMON_HUGE_PAGES_HPP_
@@ -0,0 +1,14 @@
+namespace libiop {
+
+template<typename T>
+void reserve_oracle_buffer(std::vector<T> &v, const std::size_t n, const bool parallel_first_touch)
+{
+    const bool fresh_buffer = v.empty() && v.capacity() < n;
+    v.reserve(n);
+    if (fresh_buffer && huge_pages_enabled() && n * sizeof(T) >= huge_page_size)
+    {
+        prepare_huge_pages(v.data(), n * sizeof(T), parallel_first_touch);
+    }
+}
+
+} // namespace libiop
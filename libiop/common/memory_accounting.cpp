@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#include <libff/common/profiling.hpp>
+
+#include "libiop/common/memory_accounting.hpp"
+
+namespace libiop {
+
+namespace {
+
+/* Constant initialized, so they may be used by allocations during static initialization */
+std::atomic<std::size_t> live_bytes(0);
+std::atomic<std::size_t> peak_bytes(0);
+
+void raise_peak(const std::size_t bytes)
+{
+    std::size_t peak = peak_bytes.load(std::memory_order_relaxed);
+    while (peak < bytes &&
+           !peak_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct memory_phase_registry {
+    std::mutex mutex;
+    std::vector<memory_phase> phases;
+    std::unordered_map<std::string, std::size_t> index;
+};
+
+memory_phase_registry &phase_registry()
+{
+    static memory_phase_registry registry;
+    return registry;
+}
+
+#ifdef MEMORY_ACCOUNTING
+
+/** Every allocation is preceded by a header, at least as large as its alignment,
+ *  whose last word holds the allocation's size. */
+const std::size_t min_header_size = alignof(std::max_align_t);
+
+void *accounted_allocate(const std::size_t size, const std::size_t alignment)
+{
+    const std::size_t header_size = std::max(alignment, min_header_size);
+    void *base;
+    if (alignment <= min_header_size)
+    {
+        base = std::malloc(size + header_size);
+    }
+    else
+    {
+        /* aligned_alloc requires a multiple of the alignment */
+        const std::size_t total_size = (size + header_size + alignment - 1) / alignment * alignment;
+        base = std::aligned_alloc(alignment, total_size);
+    }
+    if (base == nullptr)
+    {
+        return nullptr;
+    }
+
+    char *allocation = static_cast<char*>(base) + header_size;
+    reinterpret_cast<std::size_t*>(allocation)[-1] = size;
+    const std::size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    raise_peak(live);
+    return allocation;
+}
+
+void accounted_deallocate(void *ptr, const std::size_t alignment)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    const std::size_t header_size = std::max(alignment, min_header_size);
+    char *allocation = static_cast<char*>(ptr);
+    live_bytes.fetch_sub(reinterpret_cast<std::size_t*>(allocation)[-1], std::memory_order_relaxed);
+    std::free(allocation - header_size);
+}
+
+void *accounted_allocate_or_throw(std::size_t size, const std::size_t alignment)
+{
+    if (size == 0)
+    {
+        size = 1;
+    }
+    while (true)
+    {
+        void *allocation = accounted_allocate(size, alignment);
+        if (allocation != nullptr)
+        {
+            return allocation;
+        }
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void *accounted_allocate_nothrow(const std::size_t size, const std::size_t alignment) noexcept
+{
+    try
+    {
+        return accounted_allocate_or_throw(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+#endif // MEMORY_ACCOUNTING
+
+} // namespace
+
+bool memory_accounting_enabled()
+{
+#ifdef MEMORY_ACCOUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::size_t live_heap_bytes()
+{
+    return live_bytes.load(std::memory_order_relaxed);
+}
+
+std::size_t peak_heap_bytes()
+{
+    return peak_bytes.load(std::memory_order_relaxed);
+}
+
+void reset_peak_heap_bytes()
+{
+    peak_bytes.store(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::size_t begin_heap_phase()
+{
+    return peak_bytes.exchange(live_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+std::size_t end_heap_phase(const std::size_t enclosing_peak)
+{
+    const std::size_t phase_peak = peak_bytes.load(std::memory_order_relaxed);
+    raise_peak(enclosing_peak);
+    return phase_peak;
+}
+
+void record_memory_phase(const char *name,
+                         const std::size_t bytes_at_start,
+                         const std::size_t phase_peak_bytes)
+{
+    memory_phase_registry &registry = phase_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const auto inserted = registry.index.emplace(name, registry.phases.size());
+    if (inserted.second)
+    {
+        registry.phases.push_back({ name, 0, 0, 0 });
+    }
+    memory_phase &phase = registry.phases[inserted.first->second];
+    phase.calls += 1;
+    phase.peak_bytes = std::max(phase.peak_bytes, phase_peak_bytes);
+    phase.peak_growth_bytes = std::max(phase.peak_growth_bytes,
+                                       phase_peak_bytes > bytes_at_start ? phase_peak_bytes - bytes_at_start : 0);
+}
+
+std::vector<memory_phase> memory_phase_report()
+{
+    memory_phase_registry &registry = phase_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.phases;
+}
+
+void clear_memory_phase_report()
+{
+    memory_phase_registry &registry = phase_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.phases.clear();
+    registry.index.clear();
+}
+
+void print_memory_phase_report()
+{
+    if (!memory_accounting_enabled())
+    {
+        return;
+    }
+    const std::vector<memory_phase> phases = memory_phase_report();
+    libff::print_indent(); printf("* Peak heap memory in bytes (total): %zu\n", peak_heap_bytes());
+    libff::print_indent(); printf("* Peak heap memory in bytes, by phase (peak, growth over start, calls):\n");
+    for (const memory_phase &phase : phases)
+    {
+        libff::print_indent(); printf("  * %s: %zu, %zu, %zu\n",
+                                      phase.name.c_str(), phase.peak_bytes, phase.peak_growth_bytes, phase.calls);
+    }
+}
+
+} // namespace libiop
+
+#ifdef MEMORY_ACCOUNTING
+
+void *operator new(std::size_t size)
+{
+    return libiop::accounted_allocate_or_throw(size, 0);
+}
+
+void *operator new[](std::size_t size)
+{
+    return libiop::accounted_allocate_or_throw(size, 0);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return libiop::accounted_allocate_nothrow(size, 0);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return libiop::accounted_allocate_nothrow(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+    return libiop::accounted_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return libiop::accounted_allocate_or_throw(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return libiop::accounted_allocate_nothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    return libiop::accounted_allocate_nothrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    libiop::accounted_deallocate(ptr, 0);
+}
+
+void operator delete(void *ptr, std::align_val_t alignment) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *ptr, std::align_val_t alignment) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void *ptr, std::align_val_t alignment, const std::nothrow_t &) noexcept
+{
+    libiop::accounted_deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+#endif // MEMORY_ACCOUNTING
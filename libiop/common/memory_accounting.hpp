@@ -0,0 +1,76 @@
+/**@file
+ *****************************************************************************
+ Accounting of heap memory by protocol phase.
+
+ When MEMORY_ACCOUNTING is defined (the CMake option of the same name, off
+ by default), the global operator new and delete are replaced by versions
+ that keep a count of the live heap bytes, and its high-water mark. Each
+ allocation costs two relaxed atomic updates, which is cheap enough to
+ leave on outside of production.
+
+ The phases are the trace spans of libiop/common/tracing.hpp, e.g.
+ "Construct Merkle tree" or the FRI rounds. For every span opened outside
+ of parallel regions, the high-water mark of the live heap bytes while it
+ was open is recorded, and aggregated by span name in a per-phase report.
+ Allocations made by worker threads within the span are included.
+
+ The byte counts are process-wide, so the report is only meaningful with a
+ single prover (or verifier) running at a time. A phase's peak includes
+ whatever any other thread has allocated meanwhile. Heap phases nest, so
+ while one thread has spans with heap phases open, spans that other threads
+ open outside of parallel regions record no heap figures at all.
+
+ Without MEMORY_ACCOUNTING, all of the counts below are zero and the
+ report is empty.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_MEMORY_ACCOUNTING_HPP_
+#define LIBIOP_COMMON_MEMORY_ACCOUNTING_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace libiop {
+
+bool memory_accounting_enabled();
+
+/** Bytes currently allocated through operator new */
+std::size_t live_heap_bytes();
+/** High-water mark of live_heap_bytes since the last reset */
+std::size_t peak_heap_bytes();
+void reset_peak_heap_bytes();
+
+/** Starts a nested high-water mark at the current live bytes.
+ *  Returns the enclosing high-water mark, to be passed to end_heap_phase. */
+std::size_t begin_heap_phase();
+/** Returns the high-water mark since the matching begin_heap_phase,
+ *  and folds it back into the enclosing one. Phases must nest. */
+std::size_t end_heap_phase(const std::size_t enclosing_peak);
+
+struct memory_phase {
+    std::string name;
+    /* Number of times a span of this name was closed */
+    std::size_t calls;
+    /* Largest high-water mark of the live heap bytes while a span of this name was open */
+    std::size_t peak_bytes;
+    /* Largest growth of that high-water mark over the live bytes when the span opened */
+    std::size_t peak_growth_bytes;
+};
+
+void record_memory_phase(const char *name,
+                         const std::size_t bytes_at_start,
+                         const std::size_t peak_bytes);
+
+/** Phases in the order they were first closed */
+std::vector<memory_phase> memory_phase_report();
+void clear_memory_phase_report();
+
+/** Prints the report with libff's indentation, if memory accounting is enabled */
+void print_memory_phase_report();
+
+} // namespace libiop
+
+#endif // LIBIOP_COMMON_MEMORY_ACCOUNTING_HPP_
@@ -0,0 +1,51 @@
+#include "libiop/common/proof_arena.hpp"
+
+namespace libiop {
+
+namespace {
+
+thread_local proof_arena *current_arena = nullptr;
+
+std::pmr::pool_options arena_pool_options()
+{
+    std::pmr::pool_options options;
+    options.largest_required_pool_block = proof_arena::largest_pooled_allocation;
+    return options;
+}
+
+} // namespace
+
+const std::size_t proof_arena::largest_pooled_allocation;
+
+proof_arena::proof_arena() :
+    pool_(arena_pool_options(), std::pmr::new_delete_resource())
+{
+}
+
+scoped_proof_arena::scoped_proof_arena()
+{
+    if (current_arena == nullptr)
+    {
+        this->arena_.reset(new proof_arena());
+        current_arena = this->arena_.get();
+    }
+}
+
+scoped_proof_arena::~scoped_proof_arena()
+{
+    if (this->arena_)
+    {
+        current_arena = nullptr;
+    }
+}
+
+std::pmr::memory_resource *temporary_resource()
+{
+    if (current_arena != nullptr)
+    {
+        return current_arena->resource();
+    }
+    return std::pmr::get_default_resource();
+}
+
+} // namespace libiop
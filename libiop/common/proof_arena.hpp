@@ -0,0 +1,84 @@
+/**@file
+ *****************************************************************************
+ Per-proof arena for short-lived temporaries.
+
+ A proof makes many small, short-lived allocations: position sets, per coset
+ interpolation coefficients, authentication path frontiers, and the like.
+ With many provers running per host, these contend on the global allocator.
+
+ A proof_arena serves them instead from large chunks which it carves up
+ itself, keeping freed blocks for reuse, and which are all released at once
+ when the arena is destroyed. Temporaries draw from temporary_resource(),
+ e.g. as a temporary_vector, which is the arena installed on the calling
+ thread by a scoped_proof_arena, and the default resource otherwise.
+
+ The SNARK provers and indexers each install an arena for the duration of
+ the proof. Arenas are not thread safe, and so are only used by the thread
+ which installed them; OpenMP worker threads use the default resource.
+ Accordingly, temporaries drawn from the arena must not outlive the proof,
+ nor be handed to another thread.
+
+ Per query containers are temporaries too: the positions and evaluations
+ passed through iop_protocol::get_oracle_evaluations_at_points and the
+ batched virtual oracle interface, the seed positions given to deterministic
+ query positions, and the position sets the BCS prover collects per round.
+ Some allocations stay on the default resource:
+ - containers owned by iop_protocol, such as its query position maps and
+   evaluation caches, because they outlive the query and reach the transcript;
+ - the per point virtual oracle interface, evaluation_at_point and
+   evaluated_contents, which every oracle implements with std::vector;
+ - hash digests, whose type is the public hash_type.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_PROOF_ARENA_HPP_
+#define LIBIOP_COMMON_PROOF_ARENA_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace libiop {
+
+class proof_arena {
+protected:
+    std::pmr::unsynchronized_pool_resource pool_;
+public:
+    /** Allocations larger than this are codeword sized,
+     *  and so are passed straight through to the default resource. */
+    static const std::size_t largest_pooled_allocation = 1ull << 20;
+
+    proof_arena();
+
+    proof_arena(const proof_arena &other) = delete;
+    proof_arena &operator=(const proof_arena &other) = delete;
+
+    std::pmr::memory_resource *resource() { return &this->pool_; }
+    /** Frees everything allocated from the arena, which must no longer be in use */
+    void release() { this->pool_.release(); }
+};
+
+/** Installs a fresh arena on the calling thread for the lifetime of this object,
+ *  unless the thread already has one, in which case that one is kept. */
+class scoped_proof_arena {
+protected:
+    std::unique_ptr<proof_arena> arena_;
+public:
+    scoped_proof_arena();
+    ~scoped_proof_arena();
+
+    scoped_proof_arena(const scoped_proof_arena &other) = delete;
+    scoped_proof_arena &operator=(const scoped_proof_arena &other) = delete;
+};
+
+/** The arena installed on the calling thread, or the default resource if there is none */
+std::pmr::memory_resource *temporary_resource();
+
+template<typename T>
+using temporary_vector = std::pmr::vector<T>;
+
+} // namespace libiop
+
+#endif // LIBIOP_COMMON_PROOF_ARENA_HPP_
@@ -0,0 +1,51 @@
+/**@file
+ *****************************************************************************
+ Read-only arrays which keep their storage alive.
+
+ A shared_buffer is a view of a contiguous array together with shared
+ ownership of whatever holds the array. That is usually a std::vector, but
+ may be anything else, e.g. a mapped_file from which the array is read in
+ place. Copies of a shared_buffer share the array.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_SHARED_BUFFER_HPP_
+#define LIBIOP_COMMON_SHARED_BUFFER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace libiop {
+
+template<typename T>
+class shared_buffer {
+protected:
+    std::shared_ptr<const void> owner_;
+    const T *data_ = nullptr;
+    std::size_t size_ = 0;
+public:
+    shared_buffer() = default;
+    /* Shares the storage of the vector, which must not be modified afterwards */
+    shared_buffer(const std::shared_ptr<std::vector<T>> &contents) :
+        owner_(contents), data_(contents->data()), size_(contents->size()) {};
+    shared_buffer(const std::shared_ptr<const std::vector<T>> &contents) :
+        owner_(contents), data_(contents->data()), size_(contents->size()) {};
+    explicit shared_buffer(std::vector<T> &&contents) :
+        shared_buffer(std::make_shared<const std::vector<T>>(std::move(contents))) {};
+    /* Views size elements at data, which stay valid as long as owner is alive */
+    shared_buffer(const std::shared_ptr<const void> &owner, const T *data, const std::size_t size) :
+        owner_(owner), data_(data), size_(size) {};
+
+    const T *data() const { return this->data_; }
+    std::size_t size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+    const T &operator[](const std::size_t i) const { return this->data_[i]; }
+    const T *begin() const { return this->data_; }
+    const T *end() const { return this->data_ + this->size_; }
+};
+
+} // namespace libiop
+
+#endif // LIBIOP_COMMON_SHARED_BUFFER_HPP_
@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+#include <libff/common/profiling.hpp>
+
+#include "libiop/common/memory_accounting.hpp"
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+namespace {
+
+struct trace_event {
+    const char *name;
+    std::uint64_t timestamp_ns;
+    bool is_begin;
+};
+
+struct open_span {
+    const char *name;
+    std::uint64_t start_ns;
+    trace_counters counters_at_start;
+    bool tracks_heap;
+    std::size_t heap_bytes_at_start;
+    std::size_t enclosing_heap_peak;
+};
+
+/** Only the owning thread writes to its state. The counters are atomics, so that
+ *  total_trace_counters can read them from another thread while they are updated;
+ *  as there is a single writer, plain relaxed loads and stores suffice. */
+struct thread_trace_state {
+    std::size_t thread_id;
+    std::vector<trace_event> events;
+    std::vector<open_span> open_spans;
+    std::size_t open_heap_phases = 0;
+    std::atomic<std::uint64_t> counters[num_trace_counters];
+
+    explicit thread_trace_state(const std::size_t id) : thread_id(id)
+    {
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            this->counters[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    trace_counters snapshot() const
+    {
+        trace_counters result;
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            result.values[i] = this->counters[i].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+};
+
+const std::uint64_t process_start_ns = (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+std::uint64_t now_ns()
+{
+    const std::uint64_t now = (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return now - process_start_ns;
+}
+
+std::atomic<bool> recording_enabled(false);
+trace_metrics_callback metrics_callback;
+std::atomic<bool> has_metrics_callback(false);
+
+/* Thread states are kept alive by the registry, so spans outlive the threads that recorded them */
+std::mutex registry_mutex;
+std::vector<std::shared_ptr<thread_trace_state>> registry;
+
+thread_trace_state &current_thread_state()
+{
+    thread_local std::shared_ptr<thread_trace_state> state;
+    if (!state)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        state = std::make_shared<thread_trace_state>(registry.size());
+        registry.emplace_back(state);
+    }
+    return *state;
+}
+
+/** libff's profiling and the heap high-water marks are global state,
+ *  so only spans opened in the serial parts of the code use them */
+bool in_serial_region()
+{
+#ifdef MULTICORE
+    return !omp_in_parallel();
+#else
+    return true;
+#endif
+}
+
+/** The heap high-water marks nest, so only one thread at a time may have heap
+ *  phases open: the first to open one, until it has closed them all. This holds
+ *  the owner's thread_id + 1, or 0 when no thread has one open. */
+std::atomic<std::size_t> heap_phase_owner(0);
+
+#ifdef MEMORY_ACCOUNTING
+bool acquire_heap_phases(thread_trace_state &state)
+{
+    const std::size_t owner = state.thread_id + 1;
+    std::size_t expected = 0;
+    return heap_phase_owner.compare_exchange_strong(expected, owner, std::memory_order_acq_rel) ||
+        expected == owner;
+}
+#endif
+
+void write_json_string(std::ostream &out, const char *str)
+{
+    out << '"';
+    for (const char *c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            out << '\\';
+        }
+        out << *c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+const char* trace_counter_to_string(const trace_counter counter)
+{
+    switch (counter)
+    {
+        case trace_counter::allocated_bytes: return "allocated bytes";
+        case trace_counter::hashes: return "hashes";
+        case trace_counter::FFT_points: return "FFT points";
+        case trace_counter::field_multiplications: return "field multiplications";
+    }
+    return "unknown";
+}
+
+void trace_begin(const char *name)
+{
+    thread_trace_state &state = current_thread_state();
+    const std::uint64_t timestamp = now_ns();
+    const bool serial = in_serial_region();
+    open_span span = { name, timestamp, state.snapshot(), false, 0, 0 };
+#ifdef MEMORY_ACCOUNTING
+    if (serial && acquire_heap_phases(state))
+    {
+        ++state.open_heap_phases;
+        span.tracks_heap = true;
+        span.heap_bytes_at_start = live_heap_bytes();
+        span.enclosing_heap_peak = begin_heap_phase();
+    }
+#endif
+    state.open_spans.push_back(span);
+    if (recording_enabled.load(std::memory_order_relaxed))
+    {
+        state.events.push_back({ name, timestamp, true });
+    }
+    if (serial)
+    {
+        libff::enter_block(name);
+    }
+}
+
+void trace_end(const char *name)
+{
+    thread_trace_state &state = current_thread_state();
+    const std::uint64_t timestamp = now_ns();
+    if (in_serial_region())
+    {
+        libff::leave_block(name);
+    }
+    if (recording_enabled.load(std::memory_order_relaxed))
+    {
+        state.events.push_back({ name, timestamp, false });
+    }
+    if (state.open_spans.empty())
+    {
+        return;
+    }
+    const open_span span = state.open_spans.back();
+    state.open_spans.pop_back();
+    std::size_t peak_heap = 0;
+    if (span.tracks_heap)
+    {
+        peak_heap = end_heap_phase(span.enclosing_heap_peak);
+        record_memory_phase(span.name, span.heap_bytes_at_start, peak_heap);
+        if (--state.open_heap_phases == 0)
+        {
+            heap_phase_owner.store(0, std::memory_order_release);
+        }
+    }
+    if (has_metrics_callback.load(std::memory_order_acquire))
+    {
+        trace_span_metrics metrics;
+        metrics.name = span.name;
+        metrics.thread = state.thread_id;
+        metrics.depth = state.open_spans.size();
+        metrics.start_ns = span.start_ns;
+        metrics.duration_ns = timestamp - span.start_ns;
+        const trace_counters counters_at_end = state.snapshot();
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            metrics.counters.values[i] = counters_at_end.values[i] - span.counters_at_start.values[i];
+        }
+        metrics.heap_bytes_at_start = span.heap_bytes_at_start;
+        metrics.peak_heap_bytes = peak_heap;
+        metrics_callback(metrics);
+    }
+}
+
+void trace_count(const trace_counter counter, const std::uint64_t amount)
+{
+    std::atomic<std::uint64_t> &value = current_thread_state().counters[static_cast<std::size_t>(counter)];
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+void enable_trace_recording(const bool enable)
+{
+    recording_enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool trace_recording_enabled()
+{
+    return recording_enabled.load(std::memory_order_relaxed);
+}
+
+void set_trace_metrics_callback(const trace_metrics_callback &callback)
+{
+    has_metrics_callback.store(false, std::memory_order_release);
+    metrics_callback = callback;
+    has_metrics_callback.store(static_cast<bool>(callback), std::memory_order_release);
+}
+
+trace_counters total_trace_counters()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    trace_counters total;
+    for (const std::shared_ptr<thread_trace_state> &state : registry)
+    {
+        const trace_counters counters = state->snapshot();
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            total.values[i] += counters.values[i];
+        }
+    }
+    return total;
+}
+
+void write_chrome_trace(std::ostream &out)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    std::uint64_t last_timestamp_ns = 0;
+    trace_counters total;
+    for (const std::shared_ptr<thread_trace_state> &state : registry)
+    {
+        for (const trace_event &event : state->events)
+        {
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            write_json_string(out, event.name);
+            /* Chrome trace timestamps are in microseconds */
+            out << ",\"ph\":\"" << (event.is_begin ? 'B' : 'E') << "\",\"ts\":"
+                << event.timestamp_ns / 1000 << '.' << (event.timestamp_ns % 1000) / 100
+                << (event.timestamp_ns % 100) / 10 << event.timestamp_ns % 10
+                << ",\"pid\":0,\"tid\":" << state->thread_id << "}";
+            first = false;
+            last_timestamp_ns = std::max(last_timestamp_ns, event.timestamp_ns);
+        }
+        const trace_counters counters = state->snapshot();
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            total.values[i] += counters.values[i];
+        }
+    }
+    /* The counter totals, as one counter event at the end of the trace */
+    out << (first ? "\n" : ",\n") << "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":"
+        << last_timestamp_ns / 1000 << ",\"pid\":0,\"tid\":0,\"args\":{";
+    for (std::size_t i = 0; i < num_trace_counters; ++i)
+    {
+        out << (i == 0 ? "" : ",");
+        write_json_string(out, trace_counter_to_string(static_cast<trace_counter>(i)));
+        out << ":" << total.values[i];
+    }
+    out << "}}\n]}\n";
+}
+
+void write_chrome_trace(const std::string &path)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Could not open " + path + " for writing.");
+    }
+    write_chrome_trace(out);
+}
+
+void clear_trace()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (const std::shared_ptr<thread_trace_state> &state : registry)
+    {
+        state->events.clear();
+        for (std::size_t i = 0; i < num_trace_counters; ++i)
+        {
+            state->counters[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    clear_memory_phase_report();
+}
+
+} // namespace libiop
@@ -0,0 +1,139 @@
+/**@file
+ *****************************************************************************
+ Structured tracing of prover and verifier phases.
+
+ A span marks a named phase, e.g. "Construct Merkle tree". Spans are opened
+ and closed with LIBIOP_TRACE_BEGIN / LIBIOP_TRACE_END, or for a whole scope
+ with LIBIOP_TRACE_SCOPE, and nest per thread. Each thread appends its span
+ events, with nanosecond timestamps, to its own buffer, so spans may be
+ opened from inside parallel regions.
+
+ Alongside the spans, each thread keeps counters of the work done
+ (see trace_counter), which are bumped with LIBIOP_TRACE_COUNT.
+
+ Recorded spans can be exported as Chrome trace JSON (chrome://tracing,
+ Perfetto), and a metrics callback can be notified as each span closes.
+ Both are off until enabled at runtime. Spans opened outside of parallel
+ regions are also forwarded to libff::enter_block / leave_block, so the
+ familiar indented profiling output is unchanged.
+
+ All of this is compiled in when TRACING is defined (the CMake option of the
+ same name, on by default). Otherwise the macros expand to nothing, and
+ their arguments are not evaluated.
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_COMMON_TRACING_HPP_
+#define LIBIOP_COMMON_TRACING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace libiop {
+
+enum class trace_counter {
+    /* Bytes of codewords and Merkle trees allocated by the prover */
+    allocated_bytes = 0,
+    /* Leaf, two to one and proof of work hashes */
+    hashes = 1,
+    /* Output points of FFTs and IFFTs */
+    FFT_points = 2,
+    /* Field multiplications in FFTs and low degree extensions, counted once per call */
+    field_multiplications = 3,
+};
+
+const std::size_t num_trace_counters = 4;
+
+const char* trace_counter_to_string(const trace_counter counter);
+
+struct trace_counters {
+    std::uint64_t values[num_trace_counters] = {};
+
+    std::uint64_t operator[](const trace_counter counter) const
+    {
+        return this->values[static_cast<std::size_t>(counter)];
+    }
+};
+
+/** Reported to the metrics callback when a span closes */
+struct trace_span_metrics {
+    const char *name;
+    /* Small integer, assigned to threads in the order they first trace */
+    std::size_t thread;
+    /* Number of spans this one is nested in, on the same thread */
+    std::size_t depth;
+    std::uint64_t start_ns;
+    std::uint64_t duration_ns;
+    /* Work counted by this thread while the span was open */
+    trace_counters counters;
+    /* Live heap bytes when the span opened, and their high-water mark while it was open.
+       Only tracked with MEMORY_ACCOUNTING, for spans opened outside of parallel regions
+       while no other thread's spans are tracking it; zero otherwise. The bytes are
+       process-wide, so they are only meaningful with a single prover running.
+       See libiop/common/memory_accounting.hpp. */
+    std::size_t heap_bytes_at_start;
+    std::size_t peak_heap_bytes;
+};
+
+typedef std::function<void(const trace_span_metrics&)> trace_metrics_callback;
+
+/** Span names must outlive the trace; all names in libiop are string literals. */
+void trace_begin(const char *name);
+void trace_end(const char *name);
+void trace_count(const trace_counter counter, const std::uint64_t amount);
+
+/** Opens a span for the lifetime of this object */
+class trace_span {
+protected:
+    const char *name_;
+public:
+    explicit trace_span(const char *name) : name_(name) { trace_begin(name); }
+    ~trace_span() { trace_end(this->name_); }
+
+    trace_span(const trace_span &) = delete;
+    trace_span &operator=(const trace_span &) = delete;
+};
+
+/** Span events are only buffered while recording is enabled */
+void enable_trace_recording(const bool enable);
+bool trace_recording_enabled();
+
+/** The callback is run on the thread closing the span, and so must be thread safe.
+ *  It should only be replaced while no spans are open. Pass nullptr to remove it. */
+void set_trace_metrics_callback(const trace_metrics_callback &callback);
+
+/** The sum of every thread's counters */
+trace_counters total_trace_counters();
+
+/** Writes the recorded spans, and the counter totals, in the Chrome trace event format.
+ *  Neither this nor clear_trace may run while other threads are tracing. */
+void write_chrome_trace(std::ostream &out);
+void write_chrome_trace(const std::string &path);
+
+/** Discards the recorded spans, zeroes all counters and clears the memory phase report */
+void clear_trace();
+
+} // namespace libiop
+
+#define LIBIOP_TRACE_CONCAT_INNER(a, b) a##b
+#define LIBIOP_TRACE_CONCAT(a, b) LIBIOP_TRACE_CONCAT_INNER(a, b)
+
+#ifdef TRACING
+#define LIBIOP_TRACE_BEGIN(name) ::libiop::trace_begin(name)
+#define LIBIOP_TRACE_END(name) ::libiop::trace_end(name)
+#define LIBIOP_TRACE_SCOPE(name) \
+    const ::libiop::trace_span LIBIOP_TRACE_CONCAT(libiop_trace_span_, __LINE__)(name)
+#define LIBIOP_TRACE_COUNT(counter, amount) \
+    ::libiop::trace_count(::libiop::trace_counter::counter, (amount))
+#else
+#define LIBIOP_TRACE_BEGIN(name) ((void)0)
+#define LIBIOP_TRACE_END(name) ((void)0)
+#define LIBIOP_TRACE_SCOPE(name) ((void)0)
+#define LIBIOP_TRACE_COUNT(counter, amount) ((void)0)
+#endif // TRACING
+
+#endif // LIBIOP_COMMON_TRACING_HPP_
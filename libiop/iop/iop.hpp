@@ -19,7 +19,9 @@ IOP interfaces.
 #include "libiop/algebra/field_subset/field_subset.hpp"
 #include "libiop/algebra/polynomials/polynomial.hpp"
 #include "libiop/algebra/field_subset/subspace.hpp"
+#include "libiop/common/proof_arena.hpp"
 #include "libiop/iop/oracles.hpp"
+#include "libiop/iop/utilities/evaluation_cache.hpp"
 
 namespace libiop {
 
@@ -227,7 +229,7 @@ public:
     domain_handle domain() const { return this->domain_; }
 };
 
-typedef std::function<std::size_t(const std::vector<std::size_t>&)> deterministic_position_calculator;
+typedef std::function<std::size_t(const temporary_vector<std::size_t>&)> deterministic_position_calculator;
 
 class deterministic_query_position_registration {
 protected:
@@ -290,7 +292,9 @@ public:
 template<typename FieldT>
 struct iop_prover_index
 {
-    std::vector<std::vector<FieldT>> all_oracle_evals_;
+    /* Shared with the IOP of every proof made from this index, which only reads them.
+     * A loaded index views them in the index file. */
+    std::vector<shared_buffer<FieldT>> all_oracle_evals_;
     std::vector<std::vector<FieldT>> prover_messages_;
 };
 
@@ -330,13 +334,15 @@ protected:
     std::vector<deterministic_query_position_registration> deterministic_query_position_registrations_;
     std::vector<query_registration> query_registrations_;
 
-    std::vector<std::map<std::size_t, FieldT> > virtual_oracle_evaluation_cache_;
+    std::vector<oracle_evaluation_cache<FieldT> > virtual_oracle_evaluation_cache_;
     std::vector<bool> virtual_oracle_should_cache_evaluated_contents_; // TODO: Is there a better name for this
 
     std::map<std::size_t, std::size_t> random_query_positions_;
     std::map<std::size_t, std::size_t> deterministic_query_positions_;
 
-    std::map<std::size_t, FieldT> query_responses_;
+    /* Indexed by query id, sized when query registrations are sealed */
+    std::vector<FieldT> query_responses_;
+    std::vector<bool> query_responses_present_;
     std::map<std::size_t, std::vector<FieldT> > verifier_random_messages_;
     /* This cache doesn't clear since it is used within the multi_ldt,
      * which is at the end of the protocols */
@@ -401,7 +407,7 @@ public:
     const oracle<FieldT>& submit_oracle(const oracle_handle_ptr &handle, oracle<FieldT> &&contents);
     const oracle<FieldT>& submit_oracle(const oracle_handle &handle, oracle<FieldT> &&contents);
     void submit_prover_message(const prover_message_handle &handle, std::vector<FieldT> &&contents);
-    void submit_prover_index(iop_prover_index<FieldT> &index);
+    void submit_prover_index(const iop_prover_index<FieldT> &index);
     void signal_index_registrations_done();
     virtual void signal_index_submissions_done();
     virtual void signal_prover_round_done();
@@ -420,11 +426,25 @@ public:
 
     std::size_t get_oracle_degree(const oracle_handle_ptr &handle) const;
     domain_handle get_oracle_domain(const oracle_handle_ptr &handle) const;
+    /* Copies the evaluations of index oracles which were loaded from a file, see oracle */
     std::shared_ptr<std::vector<FieldT>> get_oracle_evaluations(const oracle_handle_ptr &handle);
     virtual FieldT get_oracle_evaluation_at_point(
         const oracle_handle_ptr &handle,
         const std::size_t evaluation_position,
         const bool record=false);
+    /** Evaluates the oracle at every given position. A virtual oracle makes one
+     *  evaluations_at_points call for all positions not already cached, after
+     *  evaluating each constituent at those positions in a single batch.
+     *  The positions and the result are per query temporaries, see proof_arena. */
+    temporary_vector<FieldT> get_oracle_evaluations_at_points(
+        const oracle_handle_ptr &handle,
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const bool record=false);
+    /** Obtains the response to every registered query. All query positions are
+     *  resolved first, so each virtual oracle is evaluated at all of its queried
+     *  positions together. Every oracle must have been submitted, and every
+     *  virtual oracle must be ready to evaluate. */
+    void evaluate_all_queries();
     std::vector<oracle_registration> get_oracle_registrations_by_round(int round) const;
 
     std::size_t num_symbols_across_all_oracles() const;
@@ -439,8 +459,14 @@ protected:
     /** Each domain has one Merkle tree containing all oracles, so this is also the number of
      *  Merkle trees per round. */
     std::size_t num_domains_in_round(const std::size_t round) const;
-
-    std::map<std::size_t, std::set<std::size_t> > oracle_id_to_query_positions_; /* HACK */
+    /* As get_oracle_evaluations, without copying evaluations which are not held in a vector */
+    shared_buffer<FieldT> get_oracle_evaluation_buffer(const oracle_handle_ptr &handle);
+
+    /* Positions at which each oracle was evaluated with record set, indexed by oracle id.
+     * Used by the BCS prover to find the positions it has to open. */
+    std::vector<std::vector<std::size_t> > recorded_query_positions_;
+    /** Sorted, without duplicates */
+    std::vector<std::size_t> recorded_query_positions(const std::size_t oracle_id) const;
 };
 
 } // namespace libiop
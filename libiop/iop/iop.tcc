@@ -3,6 +3,8 @@
 #include <stdexcept>
 #include <iostream>
 
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -97,6 +99,7 @@ oracle_handle iop_protocol<FieldT>::register_oracle(std::string name, const doma
     oracle_registration registration(name, domain, degree, make_zk);
     this->oracle_registrations_.emplace_back(std::move(registration));
     this->oracles_.emplace_back(oracle<FieldT>()); /* prepare an empty slot */
+    this->recorded_query_positions_.emplace_back(std::vector<std::size_t>());
     this->oracles_present_.push_back(false);
     this->next_oracle_uid_ += 1;
 
@@ -118,6 +121,7 @@ oracle_handle iop_protocol<FieldT>::register_index_oracle(const domain_handle &d
     oracle_registration registration(domain, degree, make_zk, indexed);
     this->oracle_registrations_.emplace_back(std::move(registration));
     this->oracles_.emplace_back(oracle<FieldT>()); /* prepare an empty slot */
+    this->recorded_query_positions_.emplace_back(std::vector<std::size_t>());
     this->oracles_present_.push_back(false);
     this->next_oracle_uid_ += 1;
 
@@ -139,7 +143,7 @@ virtual_oracle_handle iop_protocol<FieldT>::register_virtual_oracle(
                                              constituent_oracles);
     this->virtual_oracle_registrations_.emplace_back(std::move(registration));
     this->virtual_oracles_.emplace_back(contents);
-    this->virtual_oracle_evaluation_cache_.emplace_back(std::map<std::size_t, FieldT>());
+    this->virtual_oracle_evaluation_cache_.emplace_back(oracle_evaluation_cache<FieldT>());
     this->virtual_oracle_should_cache_evaluated_contents_.push_back(cache_evaluated_contents);
     this->next_oracle_uid_ += 1;
 
@@ -258,6 +262,8 @@ void iop_protocol<FieldT>::seal_query_registrations()
         throw std::logic_error("attempted to seal query registrations "
                                "while not in query registration state");
     }
+    this->query_responses_.resize(this->query_registrations_.size());
+    this->query_responses_present_.resize(this->query_registrations_.size(), false);
     this->registration_state_ = registration_state_done;
     return;
 }
@@ -295,11 +301,12 @@ const oracle<FieldT>& iop_protocol<FieldT>::submit_oracle(const oracle_handle &h
     }
 
     if (this->domains_[this->oracle_registrations_[handle.id()].domain().id()].num_elements() !=
-        contents.evaluated_contents()->size())
+        contents.evaluations().size())
     {
         throw std::invalid_argument("oracle evaluations don't match the domain size");
     }
 
+    LIBIOP_TRACE_COUNT(allocated_bytes, contents.evaluations().size() * sizeof(FieldT));
     this->oracles_[handle.id()] = contents;
     this->oracles_present_[handle.id()] = true;
 
@@ -307,7 +314,7 @@ const oracle<FieldT>& iop_protocol<FieldT>::submit_oracle(const oracle_handle &h
 }
 
 template<typename FieldT>
-void iop_protocol<FieldT>::submit_prover_index(iop_prover_index<FieldT> &index)
+void iop_protocol<FieldT>::submit_prover_index(const iop_prover_index<FieldT> &index)
 {
     if (this->num_prover_rounds_done_ != 0)
     {
@@ -325,8 +332,7 @@ void iop_protocol<FieldT>::submit_prover_index(iop_prover_index<FieldT> &index)
     for (size_t i = oracle_id_begin; i < oracle_id_end; i++)
     {
         oracle_handle ith_handle(i);
-        this->submit_oracle(ith_handle, oracle<FieldT>(std::move(index.all_oracle_evals_[i])));
-        std::vector<FieldT>().swap(index.all_oracle_evals_[i]);
+        this->submit_oracle(ith_handle, oracle<FieldT>::shared(index.all_oracle_evals_[i]));
     }
 
     const size_t prover_message_id_begin = 0;
@@ -510,7 +516,7 @@ std::size_t iop_protocol<FieldT>::obtain_query_position(const query_position_han
             const deterministic_query_position_registration& reg =
                 this->deterministic_query_position_registrations_[position.id()];
 
-            std::vector<std::size_t> seed_position_values;
+            temporary_vector<std::size_t> seed_position_values(temporary_resource());
             for (query_position_handle &seed_handle : reg.seed_positions())
             {
                 seed_position_values.emplace_back(this->obtain_query_position(seed_handle));
@@ -542,9 +548,12 @@ FieldT iop_protocol<FieldT>::obtain_query_response(const query_handle &query)
         throw std::logic_error("attempting to obtain query response while prover interactions in progress (did you forget to call signal_prover_round_done?)");
     }
 #endif
+    if (this->registration_state_ != registration_state_done)
+    {
+        throw std::logic_error("attempted to obtain query response without finishing all registrations");
+    }
 
-    auto it = this->query_responses_.find(query.id());
-    if (it == this->query_responses_.end())
+    if (!this->query_responses_present_[query.id()])
     {
         const oracle_handle_ptr oracle_h =
             this->query_registrations_[query.id()].oracle();
@@ -556,11 +565,47 @@ FieldT iop_protocol<FieldT>::obtain_query_response(const query_handle &query)
         const FieldT result = this->get_oracle_evaluation_at_point(oracle_h, position_idx, true);
 
         this->query_responses_[query.id()] = result;
+        this->query_responses_present_[query.id()] = true;
         return result;
     }
     else
     {
-        return it->second;
+        return this->query_responses_[query.id()];
+    }
+}
+
+template<typename FieldT>
+void iop_protocol<FieldT>::evaluate_all_queries()
+{
+    /* Resolve every query position up front, grouping them by virtual oracle */
+    temporary_vector<oracle_handle_ptr> virtual_handles(this->virtual_oracles_.size(), temporary_resource());
+    temporary_vector<temporary_vector<std::size_t> > virtual_positions(this->virtual_oracles_.size(),
+                                                                       temporary_resource());
+    for (std::size_t query_id = 0; query_id < this->query_registrations_.size(); ++query_id)
+    {
+        const oracle_handle_ptr oracle_h = this->query_registrations_[query_id].oracle();
+        const std::size_t position_idx =
+            this->obtain_query_position(this->query_registrations_[query_id].query_position());
+        if (std::dynamic_pointer_cast<virtual_oracle_handle>(oracle_h))
+        {
+            virtual_handles[oracle_h->id()] = oracle_h;
+            virtual_positions[oracle_h->id()].emplace_back(position_idx);
+        }
+    }
+
+    /* Fill the virtual oracle caches, one batch per virtual oracle */
+    for (std::size_t id = 0; id < this->virtual_oracles_.size(); ++id)
+    {
+        if (!virtual_positions[id].empty())
+        {
+            this->get_oracle_evaluations_at_points(virtual_handles[id], virtual_positions[id], true);
+        }
+    }
+
+    /* The remaining lookups are cache hits or reads from real oracles */
+    for (std::size_t query_id = 0; query_id < this->query_registrations_.size(); ++query_id)
+    {
+        this->obtain_query_response(query_handle(query_id));
     }
 }
 
@@ -645,10 +690,10 @@ std::shared_ptr<std::vector<FieldT>> iop_protocol<FieldT>::get_oracle_evaluation
         const virtual_oracle_registration& reg =
             this->virtual_oracle_registrations_[handle->id()];
 
-        std::vector<std::shared_ptr<std::vector<FieldT>> > constituent_evaluations;
+        std::vector<shared_buffer<FieldT> > constituent_evaluations;
         for (auto &constituent_handle : reg.constituent_oracles())
         {
-            constituent_evaluations.emplace_back(this->get_oracle_evaluations(constituent_handle));
+            constituent_evaluations.emplace_back(this->get_oracle_evaluation_buffer(constituent_handle));
         }
 
         const std::shared_ptr<std::vector<FieldT>> result = this->virtual_oracles_[handle->id()]->evaluated_contents(constituent_evaluations);
@@ -666,6 +711,16 @@ std::shared_ptr<std::vector<FieldT>> iop_protocol<FieldT>::get_oracle_evaluation
     }
 }
 
+template<typename FieldT>
+shared_buffer<FieldT> iop_protocol<FieldT>::get_oracle_evaluation_buffer(const oracle_handle_ptr &handle)
+{
+    if (std::dynamic_pointer_cast<oracle_handle>(handle))
+    {
+        return this->oracles_[handle->id()].evaluations();
+    }
+    return shared_buffer<FieldT>(this->get_oracle_evaluations(handle));
+}
+
 template<typename FieldT>
 FieldT iop_protocol<FieldT>::get_oracle_evaluation_at_point(const oracle_handle_ptr &handle,
                                                             const std::size_t evaluation_position,
@@ -680,31 +735,93 @@ FieldT iop_protocol<FieldT>::get_oracle_evaluation_at_point(const oracle_handle_
 
         if (record)
         {
-            /* HACK */
-            this->oracle_id_to_query_positions_[handle->id()].insert(evaluation_position);
+            std::vector<std::size_t> &recorded = this->recorded_query_positions_[handle->id()];
+            if (recorded.empty() || recorded.back() != evaluation_position)
+            {
+                recorded.emplace_back(evaluation_position);
+            }
         }
 
-        return this->oracles_[handle->id()].evaluated_contents()->operator[](evaluation_position);
+        return this->oracles_[handle->id()].evaluations()[evaluation_position];
     }
     else if (std::dynamic_pointer_cast<virtual_oracle_handle>(handle))
     {
-        std::map<std::size_t, FieldT> &evaluation_cache = this->virtual_oracle_evaluation_cache_[handle->id()];
-        if(evaluation_cache.count(evaluation_position) == 1) {
-            return evaluation_cache[evaluation_position];
+        const FieldT *cached = this->virtual_oracle_evaluation_cache_[handle->id()].find(evaluation_position);
+        if (cached != nullptr)
+        {
+            return *cached;
         }
-        const virtual_oracle_registration& reg =
-            this->virtual_oracle_registrations_[handle->id()];
+        const temporary_vector<std::size_t> evaluation_positions({ evaluation_position }, temporary_resource());
+        return this->get_oracle_evaluations_at_points(handle, evaluation_positions, record)[0];
+    }
+    else
+    {
+        throw std::invalid_argument("oracle type not supported");
+    }
+}
 
-        std::vector<FieldT> constituent_evaluations;
-        for (auto &constituent_handle : reg.constituent_oracles())
+template<typename FieldT>
+temporary_vector<FieldT> iop_protocol<FieldT>::get_oracle_evaluations_at_points(
+    const oracle_handle_ptr &handle,
+    const temporary_vector<std::size_t> &evaluation_positions,
+    const bool record)
+{
+    temporary_vector<FieldT> result(temporary_resource());
+    result.reserve(evaluation_positions.size());
+    if (std::dynamic_pointer_cast<oracle_handle>(handle))
+    {
+        for (const std::size_t position : evaluation_positions)
+        {
+            result.emplace_back(this->get_oracle_evaluation_at_point(handle, position, record));
+        }
+        return result;
+    }
+    else if (std::dynamic_pointer_cast<virtual_oracle_handle>(handle))
+    {
+        oracle_evaluation_cache<FieldT> &evaluation_cache = this->virtual_oracle_evaluation_cache_[handle->id()];
+
+        temporary_vector<std::size_t> missing_positions(temporary_resource());
+        for (const std::size_t position : evaluation_positions)
         {
-            constituent_evaluations.emplace_back(this->get_oracle_evaluation_at_point(constituent_handle, evaluation_position, record));
+            if (evaluation_cache.find(position) == nullptr)
+            {
+                missing_positions.emplace_back(position);
+            }
         }
+        std::sort(missing_positions.begin(), missing_positions.end());
+        missing_positions.erase(std::unique(missing_positions.begin(), missing_positions.end()),
+                                missing_positions.end());
 
-        const FieldT evaluation_point = this->get_domain(reg.domain()).element_by_index(evaluation_position);
+        if (!missing_positions.empty())
+        {
+            const virtual_oracle_registration& reg =
+                this->virtual_oracle_registrations_[handle->id()];
+            const field_subset<FieldT> domain = this->get_domain(reg.domain());
 
-        const FieldT result = this->virtual_oracles_[handle->id()]->evaluation_at_point(evaluation_position, evaluation_point, constituent_evaluations);
-        evaluation_cache[evaluation_position] = result;
+            /* One batch per constituent, indexed [constituent][position] */
+            temporary_vector<temporary_vector<FieldT> > constituent_evaluations(temporary_resource());
+            for (auto &constituent_handle : reg.constituent_oracles())
+            {
+                constituent_evaluations.emplace_back(
+                    this->get_oracle_evaluations_at_points(constituent_handle, missing_positions, record));
+            }
+
+            temporary_vector<FieldT> evaluation_points(temporary_resource());
+            evaluation_points.reserve(missing_positions.size());
+            for (const std::size_t position : missing_positions)
+            {
+                evaluation_points.emplace_back(domain.element_by_index(position));
+            }
+            const temporary_vector<FieldT> missing_evaluations =
+                this->virtual_oracles_[handle->id()]->evaluations_at_points(
+                    missing_positions, evaluation_points, constituent_evaluations);
+            evaluation_cache.insert(missing_positions, missing_evaluations);
+        }
+
+        for (const std::size_t position : evaluation_positions)
+        {
+            result.emplace_back(*evaluation_cache.find(position));
+        }
         return result;
     }
     else
@@ -713,6 +830,15 @@ FieldT iop_protocol<FieldT>::get_oracle_evaluation_at_point(const oracle_handle_
     }
 }
 
+template<typename FieldT>
+std::vector<std::size_t> iop_protocol<FieldT>::recorded_query_positions(const std::size_t oracle_id) const
+{
+    std::vector<std::size_t> result(this->recorded_query_positions_[oracle_id]);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
 template<typename FieldT>
 std::vector<oracle_registration> iop_protocol<FieldT>::get_oracle_registrations_by_round(
         int round) const
@@ -759,7 +885,8 @@ std::size_t iop_protocol<FieldT>::size_in_bytes() const
     const std::size_t prover_messages_size =
         sizeof(FieldT) * prover_messages_length;
 
-    const std::size_t query_responses_length = this->query_responses_.size();
+    const std::size_t query_responses_length =
+        std::count(this->query_responses_present_.begin(), this->query_responses_present_.end(), true);
     const std::size_t query_responses_size =
         sizeof(FieldT) * query_responses_length;
 
@@ -15,39 +15,75 @@ This file defines oracle interfaces
 #include <set>
 #include <vector>
 
+#include "libiop/common/proof_arena.hpp"
+#include "libiop/common/shared_buffer.hpp"
+
 namespace libiop {
 
 /* Oracles */
 template<typename FieldT>
 class oracle {
 protected:
+    /* Null if the evaluations are shared from storage other than a vector,
+       such as an index file mapped into memory. */
     std::shared_ptr<std::vector<FieldT>> evaluated_contents_;
+    shared_buffer<FieldT> evaluations_;
     bool erased_ = false;
 
 public:
     oracle() = default;
     oracle(const std::vector<FieldT> &evaluated_contents) :
         evaluated_contents_(
-            std::make_shared<std::vector<FieldT>>(evaluated_contents)) {}
+            std::make_shared<std::vector<FieldT>>(evaluated_contents)),
+        evaluations_(evaluated_contents_) {}
     oracle(std::vector<FieldT> &&evaluated_contents) :
         evaluated_contents_(
-            std::make_shared<std::vector<FieldT>>(std::move(evaluated_contents))) {}
-    // TODO: Should we make a method where the IOP infrastructure shares ownership
-    // of the provided oracle, instead of making its own copy
+            std::make_shared<std::vector<FieldT>>(std::move(evaluated_contents))),
+        evaluations_(evaluated_contents_) {}
     oracle(const std::shared_ptr<std::vector<FieldT>> &evaluated_contents) :
         evaluated_contents_(
-            std::make_shared<std::vector<FieldT>>(*evaluated_contents.get())) {}
+            std::make_shared<std::vector<FieldT>>(*evaluated_contents.get())),
+        evaluations_(evaluated_contents_) {}
+    /* Shares ownership of the provided evaluations instead of copying them.
+       The IOP infrastructure never writes to oracle contents after submission. */
+    static oracle<FieldT> shared(const std::shared_ptr<std::vector<FieldT>> &evaluated_contents)
+    {
+        oracle<FieldT> result;
+        result.evaluated_contents_ = evaluated_contents;
+        result.evaluations_ = shared_buffer<FieldT>(evaluated_contents);
+        return result;
+    }
+    static oracle<FieldT> shared(const shared_buffer<FieldT> &evaluations)
+    {
+        oracle<FieldT> result;
+        result.evaluations_ = evaluations;
+        return result;
+    }
 
+    /* Evaluations which are not held in a vector are copied into one */
     const std::shared_ptr<std::vector<FieldT>> evaluated_contents() const {
         if (this->erased_)
         {
             throw std::invalid_argument("Oracle has been erased\n");
         }
+        if (this->evaluated_contents_ == nullptr)
+        {
+            return std::make_shared<std::vector<FieldT>>(
+                this->evaluations_.begin(), this->evaluations_.end());
+        }
         return this->evaluated_contents_;
     }
+    const shared_buffer<FieldT> &evaluations() const {
+        if (this->erased_)
+        {
+            throw std::invalid_argument("Oracle has been erased\n");
+        }
+        return this->evaluations_;
+    }
     void erase_contents() {
         this->erased_ = true;
         this->evaluated_contents_.reset();
+        this->evaluations_ = shared_buffer<FieldT>();
     }
 };
 
@@ -55,8 +91,9 @@ public:
 template<typename FieldT>
 class virtual_oracle : public oracle<FieldT> {
 public:
+    /* The constituent evaluations may be views of an index file mapped into memory */
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>>
+        const std::vector<shared_buffer<FieldT>>
         &constituent_oracle_evaluations) const = 0;
 
     virtual FieldT evaluation_at_point(
@@ -64,6 +101,32 @@ public:
         const FieldT evaluation_point,
         const std::vector<FieldT> &constituent_oracle_evaluations) const = 0;
 
+    /* Evaluates the oracle at several points at once.
+       constituent_oracle_evaluations[i][j] is the evaluation of the i-th
+       constituent oracle at evaluation_points[j]. The default calls
+       evaluation_at_point for every point; subclasses override it to share
+       work across points, e.g. by inverting all denominators together.
+       The inputs and the result are per query temporaries, see proof_arena. */
+    virtual temporary_vector<FieldT> evaluations_at_points(
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const temporary_vector<FieldT> &evaluation_points,
+        const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+    {
+        temporary_vector<FieldT> result(temporary_resource());
+        result.reserve(evaluation_points.size());
+        std::vector<FieldT> constituent_evaluations_at_point(constituent_oracle_evaluations.size());
+        for (std::size_t i = 0; i < evaluation_points.size(); ++i)
+        {
+            for (std::size_t j = 0; j < constituent_oracle_evaluations.size(); ++j)
+            {
+                constituent_evaluations_at_point[j] = constituent_oracle_evaluations[j][i];
+            }
+            result.emplace_back(this->evaluation_at_point(
+                evaluation_positions[i], evaluation_points[i], constituent_evaluations_at_point));
+        }
+        return result;
+    }
+
     /* TODO: Move this documentation to the correct spot
        The IOP interface defines
 
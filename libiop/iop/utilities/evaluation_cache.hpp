@@ -0,0 +1,47 @@
+/**@file
+ *****************************************************************************
+ Flat cache of oracle evaluations at queried positions
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_IOP_UTILITIES_EVALUATION_CACHE_HPP_
+#define LIBIOP_IOP_UTILITIES_EVALUATION_CACHE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace libiop {
+
+/** Evaluations of a single oracle at the positions queried so far.
+ *  Positions and values are kept in two arrays sorted by position, and lookups
+ *  are binary searches. Queries touch at most a few thousand positions per oracle,
+ *  where this is much cheaper than a node-based map.
+ *  Inserting a position that is already present overwrites its value. */
+template<typename FieldT>
+class oracle_evaluation_cache {
+protected:
+    std::vector<std::size_t> positions_;
+    std::vector<FieldT> values_;
+public:
+    oracle_evaluation_cache() = default;
+
+    /** Returns nullptr if no value is cached at this position. */
+    const FieldT* find(const std::size_t position) const;
+
+    void insert(const std::size_t position, const FieldT &value);
+    /** The positions may be in any order. If a position repeats, its last value is kept. */
+    template<typename PositionAllocator, typename ValueAllocator>
+    void insert(const std::vector<std::size_t, PositionAllocator> &positions,
+                const std::vector<FieldT, ValueAllocator> &values);
+
+    const std::vector<std::size_t>& positions() const { return this->positions_; }
+    std::size_t size() const { return this->positions_.size(); }
+    void clear();
+};
+
+} // namespace libiop
+
+#include "libiop/iop/utilities/evaluation_cache.tcc"
+
+#endif // LIBIOP_IOP_UTILITIES_EVALUATION_CACHE_HPP_
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "libiop/common/proof_arena.hpp"
+
+namespace libiop {
+
+template<typename FieldT>
+const FieldT* oracle_evaluation_cache<FieldT>::find(const std::size_t position) const
+{
+    const auto it = std::lower_bound(this->positions_.begin(), this->positions_.end(), position);
+    if (it == this->positions_.end() || *it != position)
+    {
+        return nullptr;
+    }
+    return &this->values_[it - this->positions_.begin()];
+}
+
+template<typename FieldT>
+void oracle_evaluation_cache<FieldT>::insert(const std::size_t position, const FieldT &value)
+{
+    const auto it = std::lower_bound(this->positions_.begin(), this->positions_.end(), position);
+    const std::size_t index = it - this->positions_.begin();
+    if (it != this->positions_.end() && *it == position)
+    {
+        this->values_[index] = value;
+        return;
+    }
+    this->positions_.insert(it, position);
+    this->values_.insert(this->values_.begin() + index, value);
+}
+
+template<typename FieldT>
+template<typename PositionAllocator, typename ValueAllocator>
+void oracle_evaluation_cache<FieldT>::insert(const std::vector<std::size_t, PositionAllocator> &positions,
+                                             const std::vector<FieldT, ValueAllocator> &values)
+{
+    if (positions.size() != values.size())
+    {
+        throw std::invalid_argument("Number of positions and values must match.");
+    }
+
+    /* Sort the new entries, then merge them with the cached ones in a single pass. */
+    temporary_vector<std::size_t> order(positions.size(), temporary_resource());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&positions](const std::size_t a, const std::size_t b) {
+                         return positions[a] < positions[b];
+                     });
+
+    std::vector<std::size_t> merged_positions;
+    std::vector<FieldT> merged_values;
+    merged_positions.reserve(this->positions_.size() + positions.size());
+    merged_values.reserve(this->positions_.size() + positions.size());
+
+    std::size_t i = 0;
+    std::size_t k = 0;
+    while (i < this->positions_.size() || k < order.size())
+    {
+        if (k == order.size() ||
+            (i < this->positions_.size() && this->positions_[i] < positions[order[k]]))
+        {
+            merged_positions.emplace_back(this->positions_[i]);
+            merged_values.emplace_back(this->values_[i]);
+            i++;
+            continue;
+        }
+
+        const std::size_t position = positions[order[k]];
+        while (k + 1 < order.size() && positions[order[k + 1]] == position)
+        {
+            k++;
+        }
+        merged_positions.emplace_back(position);
+        merged_values.emplace_back(values[order[k]]);
+        k++;
+        if (i < this->positions_.size() && this->positions_[i] == position)
+        {
+            i++;
+        }
+    }
+
+    this->positions_ = std::move(merged_positions);
+    this->values_ = std::move(merged_values);
+}
+
+template<typename FieldT>
+void oracle_evaluation_cache<FieldT>::clear()
+{
+    this->positions_.clear();
+    this->values_.clear();
+}
+
+} // namespace libiop
@@ -13,7 +13,7 @@ std::vector<query_position_handle> query_position_to_queries_for_entire_coset(
         query_pos[i] = IOP.register_deterministic_query_position(
             { initial_query },
             [domain, coset_size, i]
-            (const std::vector<std::size_t> &seed_positions)
+            (const temporary_vector<std::size_t> &seed_positions)
             -> std::size_t {
                 const std::size_t index = seed_positions[0];
                 const size_t coset_index = domain.coset_index(index, coset_size);
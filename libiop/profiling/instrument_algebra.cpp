@@ -15,6 +15,7 @@
 #include <libff/algebra/fields/binary/gf192.hpp>
 #include <libff/algebra/fields/binary/gf256.hpp>
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "boost_profile.cpp"
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/field_subset/subspace.hpp"
@@ -82,32 +83,32 @@ void instrument_algebra(std::size_t log_n_min,
 
         /* FFT(n) */
         std::vector<FieldT> n_vec;
-        libff::enter_block("n");
+        LIBIOP_TRACE_BEGIN("n");
         for (size_t i = 0; i < n; ++i)
         {
             n_vec.push_back(FieldT::random_element());
         }
-        libff::leave_block("n");
+        LIBIOP_TRACE_END("n");
         affine_subspace<FieldT> n_subspace = linear_subspace<FieldT>::standard_basis(libff::log2(n));
-        libff::enter_block("FFT(n)");
+        LIBIOP_TRACE_BEGIN("FFT(n)");
         std::vector<FieldT> fft_results = additive_FFT<FieldT>(n_vec, n_subspace);
-        libff::leave_block("FFT(n)");
+        LIBIOP_TRACE_END("FFT(n)");
 
         /* sqrt(n) * FFT(sqrt(n)) */
         std::vector<FieldT> sqrt_n_vec;
-        libff::enter_block("sqrt(n)");
+        LIBIOP_TRACE_BEGIN("sqrt(n)");
         for (size_t i = 0; i < sqrt_n; ++i)
         {
             sqrt_n_vec.push_back(FieldT::random_element());
         }
-        libff::leave_block("sqrt(n)");
+        LIBIOP_TRACE_END("sqrt(n)");
         affine_subspace<FieldT> sqrt_n_subspace = linear_subspace<FieldT>::standard_basis(libff::log2(sqrt_n));
-        libff::enter_block("sqrt(n) * FFT(sqrt(n))");
+        LIBIOP_TRACE_BEGIN("sqrt(n) * FFT(sqrt(n))");
         for (size_t i = 0; i < sqrt_n; ++i)
         {
             std::vector<FieldT> sqrt_results = additive_FFT<FieldT>(sqrt_n_vec, sqrt_n_subspace);
         }
-        libff::leave_block("sqrt(n) * FFT(sqrt(n))");
+        LIBIOP_TRACE_END("sqrt(n) * FFT(sqrt(n))");
     }
 }
 
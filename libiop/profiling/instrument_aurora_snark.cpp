@@ -18,6 +18,8 @@
 
 #include "boost_profile.cpp"
 #include "libiop/snark/aurora_snark.hpp"
+#include "libiop/common/memory_accounting.hpp"
+#include "libiop/common/tracing.hpp"
 #include "libiop/bcs/bcs_common.hpp"
 #include "libiop/protocols/aurora_iop.hpp"
 #include "libiop/protocols/ldt/fri/argument_size_optimizer.hpp"
@@ -102,6 +104,8 @@ void instrument_aurora_snark(options &options,
     for (std::size_t log_n = options.log_n_min; log_n <= options.log_n_max; ++log_n)
     {
         libff::print_separator();
+        clear_memory_phase_report();
+        reset_peak_heap_bytes();
 
         const std::size_t n = 1ul << log_n;
         /* k+1 needs to be a power of 2 (proof system artifact) so we just fix it to 15 here */
@@ -147,11 +151,11 @@ void instrument_aurora_snark(options &options,
             parameters.reset_fri_localization_parameters(localization_parameter_array);
         }
 
-        libff::enter_block("Check satisfiability of R1CS example");
+        LIBIOP_TRACE_BEGIN("Check satisfiability of R1CS example");
         const bool is_satisfied = example.constraint_system_.is_satisfied(
             example.primary_input_, example.auxiliary_input_);
         assert(is_satisfied);
-        libff::leave_block("Check satisfiability of R1CS example");
+        LIBIOP_TRACE_END("Check satisfiability of R1CS example");
         printf("\n");
         libff::print_indent(); printf("* R1CS number of constraints: %zu\n", example.constraint_system_.num_constraints());
         libff::print_indent(); printf("* R1CS number of variables: %zu\n", example.constraint_system_.num_variables());
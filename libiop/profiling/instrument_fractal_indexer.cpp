@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+
+#ifndef CPPDEBUG /* Ubuntu's Boost does not provide binaries compatible with libstdc++'s debug mode so we just reduce functionality here */
+#include <boost/program_options.hpp>
+#endif
+
+#include "boost_profile.cpp"
+#include <libff/algebra/fields/binary/gf64.hpp>
+#include <libff/algebra/fields/binary/gf128.hpp>
+#include <libff/algebra/fields/binary/gf192.hpp>
+#include <libff/algebra/fields/binary/gf256.hpp>
+#include <libff/algebra/curves/edwards/edwards_pp.hpp>
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+#include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
+
+#include "libiop/snark/fractal_snark.hpp"
+#include "libiop/bcs/bcs_common.hpp"
+#include "libiop/protocols/fractal_hiop.hpp"
+#include "libiop/relations/examples/r1cs_examples.hpp"
+
+#ifndef CPPDEBUG
+bool process_indexer_command_line(const int argc, const char** argv, options &options)
+{
+    namespace po = boost::program_options;
+
+    try
+    {
+        po::options_description desc = gen_options(options);
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << desc << "\n";
+            return false;
+        }
+
+        po::notify(vm);
+        options.hash_enum = static_cast<libiop::bcs_hash_type>(options.hash_enum_val);
+    }
+    catch(std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n";
+        return false;
+    }
+
+    return true;
+}
+#endif
+
+using namespace libiop;
+
+/** Times only the Fractal indexer, so that indexing large circuits can be
+ *  profiled without paying for the prover and verifier. */
+template<typename FieldT, typename hash_type>
+void instrument_fractal_indexer(options &options)
+{
+    const size_t RS_extra_dimensions = 3;
+    const size_t fri_localization_parameter = 2;
+    field_subset_type domain_type = affine_subspace_type;
+    if (options.is_multiplicative) {
+        domain_type = multiplicative_coset_type;
+    }
+
+    for (std::size_t log_n = options.log_n_min; log_n <= options.log_n_max; ++log_n)
+    {
+        libff::print_separator();
+
+        const std::size_t n = 1ul << log_n;
+        /* k+1 needs to be a power of 2 (proof system artifact) so we just fix it to 15 here */
+        size_t k = 15;
+        if (domain_type == multiplicative_coset_type)
+        {
+            k = 0;
+        }
+        const std::size_t m = n - 1;
+        r1cs_example<FieldT> example = generate_r1cs_example<FieldT>(n, k, m);
+
+        const fractal_snark_parameters<FieldT, hash_type> parameters(
+            options.security_level,
+            LDT_reducer_soundness_type::optimistic_heuristic,
+            FRI_soundness_type::heuristic,
+            options.hash_enum,
+            fri_localization_parameter,
+            RS_extra_dimensions,
+            options.make_zk,
+            domain_type,
+            std::make_shared<r1cs_constraint_system<FieldT>>(example.constraint_system_));
+
+        printf("\n");
+        libff::print_indent(); printf("* R1CS number of constraints: %zu\n", example.constraint_system_.num_constraints());
+        libff::print_indent(); printf("* R1CS number of variables: %zu\n", example.constraint_system_.num_variables());
+        printf("\n");
+
+        LIBIOP_TRACE_BEGIN("Fractal indexer");
+        const std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
+            fractal_snark_indexer(parameters);
+        LIBIOP_TRACE_END("Fractal indexer");
+
+        libff::print_indent(); printf("* Number of index Merkle trees: %zu\n", index.first.index_MTs_.size());
+        libff::print_indent(); printf("* Number of indexed oracles: %zu\n", index.first.iop_index_.all_oracle_evals_.size());
+    }
+}
+
+int main(int argc, const char * argv[])
+{
+    options default_vals;
+
+#ifdef CPPDEBUG
+    /* set reasonable defaults */
+    if (argc > 1)
+    {
+        printf("There is no argument parsing in CPPDEBUG mode.");
+        exit(1);
+    }
+    libff::UNUSED(argv);
+
+#else
+    if (!process_indexer_command_line(argc, argv, default_vals))
+    {
+        return 1;
+    }
+#endif
+    libff::start_profiling();
+
+    printf("Selected parameters:\n");
+    printf("- log_n_min = %zu\n", default_vals.log_n_min);
+    printf("- log_n_max = %zu\n", default_vals.log_n_max);
+    printf("- security_level = %zu\n", default_vals.security_level);
+    printf("- is_multiplicative = %s\n", default_vals.is_multiplicative ? "true" : "false");
+    printf("- field_size = %zu\n", default_vals.field_size);
+    printf("- make_zk = %s\n", default_vals.make_zk ? "true" : "false");
+    printf("- hash_enum = %s\n", bcs_hash_type_names[default_vals.hash_enum]);
+
+    if (default_vals.is_multiplicative) {
+        switch (default_vals.field_size) {
+            case 181:
+                libff::edwards_pp::init_public_params();
+                instrument_fractal_indexer<libff::edwards_Fr, binary_hash_digest>(default_vals);
+                break;
+            case 256:
+                libff::alt_bn128_pp::init_public_params();
+                if (default_vals.hash_enum == libiop::blake2b_type)
+                {
+                    instrument_fractal_indexer<libff::alt_bn128_Fr, binary_hash_digest>(default_vals);
+                }
+                else
+                {
+                    instrument_fractal_indexer<libff::alt_bn128_Fr, libff::alt_bn128_Fr>(default_vals);
+                }
+                break;
+            default:
+                throw std::invalid_argument("Field size not supported.");
+        }
+    } else {
+        switch (default_vals.field_size)
+        {
+            case 64:
+                instrument_fractal_indexer<libff::gf64, binary_hash_digest>(default_vals);
+                break;
+            case 128:
+                instrument_fractal_indexer<libff::gf128, binary_hash_digest>(default_vals);
+                break;
+            case 192:
+                instrument_fractal_indexer<libff::gf192, binary_hash_digest>(default_vals);
+                break;
+            case 256:
+                instrument_fractal_indexer<libff::gf256, binary_hash_digest>(default_vals);
+                break;
+            default:
+                throw std::invalid_argument("Field size not supported.");
+        }
+    }
+}
@@ -21,6 +21,7 @@
 
 #include "libiop/algebra/field_subset/subgroup.hpp"
 #include "libiop/algebra/fft.hpp"
+#include "libiop/common/memory_accounting.hpp"
 
 #include <libff/common/utils.hpp>
 #include "libiop/iop/iop.hpp"
@@ -81,6 +82,8 @@ void instrument_FRI(options &options,
     for (std::size_t log_n = options.log_n_min; log_n <= options.log_n_max; ++log_n)
     {
         libff::print_separator();
+        clear_memory_phase_report();
+        reset_peak_heap_bytes();
         const std::size_t poly_degree_bound = 1ull << log_n;
         const std::size_t RS_extra_dimensions = 2; /* \rho = 2^{-RS_extra_dimensions} */
         const std::size_t codeword_domain_dim = log_n + RS_extra_dimensions;
@@ -129,6 +132,7 @@ void instrument_FRI(options &options,
                "the argument would have the following sizes:\n");
         libff::print_indent(); printf("* Argument size in bytes (BCS, no pruning): %zu\n", proof.BCS_size_in_bytes_without_pruning());
         libff::print_indent(); printf("* Argument size in bytes (total, no pruning): %zu\n", proof.size_in_bytes_without_pruning());
+        print_memory_phase_report();
         printf("\n");
 
         const bool bit = FRI_snark_verifier<FieldT, hash_type>(proof, params);
@@ -19,6 +19,8 @@
 #include <libff/algebra/fields/binary/gf256.hpp>
 
 #include "libiop/snark/ligero_snark.hpp"
+#include "libiop/common/memory_accounting.hpp"
+#include "libiop/common/tracing.hpp"
 #include "libiop/bcs/bcs_common.hpp"
 #include "libiop/bcs/common_bcs_parameters.hpp"
 #include "libiop/relations/examples/r1cs_examples.hpp"
@@ -82,6 +84,8 @@ void instrument_ligero_snark(options &options,
     for (std::size_t log_n = options.log_n_min; log_n <= options.log_n_max; ++log_n)
     {
         libff::print_separator();
+        clear_memory_phase_report();
+        reset_peak_heap_bytes();
         const std::size_t n = 1ul << log_n;
         /* k+1 needs to be a power of 2 (proof system artifact) and k <= n+2 (example generation artifact) so we just fix it to 15 here */
         const std::size_t k = 15;
@@ -89,11 +93,11 @@ void instrument_ligero_snark(options &options,
         r1cs_example<FieldT> example = generate_r1cs_example<FieldT>(n, k, m);
         parameters.bcs_params_ = default_bcs_params<FieldT, hash_type>(options.hash_enum, options.security_level, log_n);
 
-        libff::enter_block("Check satisfiability of R1CS example");
+        LIBIOP_TRACE_BEGIN("Check satisfiability of R1CS example");
         const bool is_satisfied = example.constraint_system_.is_satisfied(
             example.primary_input_, example.auxiliary_input_);
         assert(is_satisfied);
-        libff::leave_block("Check satisfiability of R1CS example");
+        LIBIOP_TRACE_END("Check satisfiability of R1CS example");
         printf("\n");
         libff::print_indent(); printf("* R1CS number of constraints: %zu\n", example.constraint_system_.num_constraints());
         libff::print_indent(); printf("* R1CS number of variables: %zu\n", example.constraint_system_.num_variables());
@@ -119,6 +123,7 @@ void instrument_ligero_snark(options &options,
                "the argument would have the following sizes:\n");
         libff::print_indent(); printf("* Argument size in bytes (BCS, no pruning): %zu\n", proof.BCS_size_in_bytes_without_pruning());
         libff::print_indent(); printf("* Argument size in bytes (total, no pruning): %zu\n", proof.size_in_bytes_without_pruning());
+        print_memory_phase_report();
 
         printf("\n");
 
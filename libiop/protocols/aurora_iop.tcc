@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -183,6 +185,10 @@ increasing codeword domain dimension\n",
         }
         this->query_bound_ = estimated_num_queries + 1;
     }
+    /* The verifier evaluates the lincheck polynomials at every query to the input oracles */
+    this->encoded_aurora_params_.multi_lincheck_params_.set_use_lagrange(
+        basic_lincheck_parameters<FieldT>::lagrange_is_cheaper(
+            this->summation_domain_dim_, this->FRI_params_.queries_to_input_oracles()));
 }
 
 template<typename FieldT>
@@ -346,13 +352,13 @@ void aurora_iop<FieldT>::produce_proof(const r1cs_primary_input<FieldT> &primary
 template<typename FieldT>
 bool aurora_iop<FieldT>::verifier_predicate(const r1cs_primary_input<FieldT> &primary_input)
 {
-    libff::enter_block("Construct R1CS verifier state");
+    LIBIOP_TRACE_BEGIN("Construct R1CS verifier state");
     this->protocol_->construct_verifier_state(primary_input);
-    libff::leave_block("Construct R1CS verifier state");
+    LIBIOP_TRACE_END("Construct R1CS verifier state");
 
-    libff::enter_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_BEGIN("Check LDT verifier predicate");
     const bool decision = this->LDT_reducer_->verifier_predicate();
-    libff::leave_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_END("Check LDT verifier predicate");
 
     return decision;
 }
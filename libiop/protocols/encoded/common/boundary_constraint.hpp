@@ -44,11 +44,15 @@ public:
     single_boundary_constraint(const field_subset<FieldT> &codeword_domain);
     void set_evaluation_point_and_eval(const FieldT eval_point, const FieldT oracle_eval);
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
         const std::vector<FieldT> &constituent_oracle_evaluations) const;
+    virtual temporary_vector<FieldT> evaluations_at_points(
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const temporary_vector<FieldT> &evaluation_points,
+        const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const;
 };
 
 } // libiop
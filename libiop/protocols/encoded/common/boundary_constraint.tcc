@@ -18,7 +18,7 @@ void single_boundary_constraint<FieldT>::set_evaluation_point_and_eval(
 /* Multiplies each oracle evaluation vector by the corresponding random coefficient */
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> single_boundary_constraint<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != 1)
     {
@@ -51,7 +51,7 @@ std::shared_ptr<std::vector<FieldT>> single_boundary_constraint<FieldT>::evaluat
     result->reserve(this->codeword_domain_.num_elements());
     for (std::size_t i = 0; i < this->codeword_domain_.num_elements(); ++i) {
         result->emplace_back(
-            (constituent_oracle_evaluations[0]->operator[](i) - this->oracle_evaluation_)
+            (constituent_oracle_evaluations[0][i] - this->oracle_evaluation_)
             * all_inverted_shifted_elems[i]);
     }
 
@@ -79,4 +79,32 @@ FieldT single_boundary_constraint<FieldT>::evaluation_at_point(
     return result;
 }
 
+template<typename FieldT>
+temporary_vector<FieldT> single_boundary_constraint<FieldT>::evaluations_at_points(
+    const temporary_vector<std::size_t> &evaluation_positions,
+    const temporary_vector<FieldT> &evaluation_points,
+    const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+{
+    libff::UNUSED(evaluation_positions);
+
+    if (constituent_oracle_evaluations.size() != 1)
+    {
+        throw std::invalid_argument("Single Boundary Constraint: "
+            "Expected exactly 1 constituent oracle.");
+    }
+
+    temporary_vector<FieldT> shifted_points(temporary_resource());
+    shifted_points.reserve(evaluation_points.size());
+    for (const FieldT &X : evaluation_points)
+    {
+        shifted_points.emplace_back(X - this->eval_point_);
+    }
+    temporary_vector<FieldT> result = batch_inverse(shifted_points);
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        result[i] *= constituent_oracle_evaluations[0][i] - this->oracle_evaluation_;
+    }
+    return result;
+}
+
 } // libiop
@@ -27,7 +27,7 @@ public:
     random_linear_combination_oracle(const std::size_t num_oracles);
     void set_random_coefficients(const std::vector<FieldT>& random_coefficients);
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
@@ -1,5 +1,6 @@
 #include "libiop/algebra/lagrange.hpp"
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
 
 namespace libiop {
 
@@ -25,31 +26,28 @@ void random_linear_combination_oracle<FieldT>::set_random_coefficients(const std
 /* Multiplies each oracle evaluation vector by the corresponding random coefficient */
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> random_linear_combination_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != this->num_oracles_)
     {
         throw std::invalid_argument("Random Linear Combination Oracle: "
             "Expected same number of evaluations as in registration.");
     }
-    const size_t codeword_size = constituent_oracle_evaluations[0]->size();
-    std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>();
-    result->reserve(codeword_size);
-    for (std::size_t j = 0; j < codeword_size; ++j) {
-        result->emplace_back(this->random_coefficients_[0] *
-            constituent_oracle_evaluations[0]->operator[](j));
-    }
+    const size_t codeword_size = constituent_oracle_evaluations[0].size();
+    std::shared_ptr<std::vector<FieldT>> result =
+        std::make_shared<std::vector<FieldT>>(
+            constituent_oracle_evaluations[0].begin(), constituent_oracle_evaluations[0].end());
+    vector_scale(this->random_coefficients_[0], result->data(), codeword_size);
     for (std::size_t i = 1; i < constituent_oracle_evaluations.size(); ++i)
     {
-        if (constituent_oracle_evaluations[i]->size() != codeword_size)
+        if (constituent_oracle_evaluations[i].size() != codeword_size)
         {
             throw std::invalid_argument("Vectors of mismatched size.");
         }
-        for (std::size_t j = 0; j < codeword_size; ++j)
-        {
-            result->operator[](j) +=
-                this->random_coefficients_[i] * constituent_oracle_evaluations[i]->operator[](j);
-        }
+        vector_axpy(this->random_coefficients_[i],
+                    constituent_oracle_evaluations[i].data(),
+                    result->data(),
+                    codeword_size);
     }
 
     return result;
@@ -70,14 +68,9 @@ FieldT random_linear_combination_oracle<FieldT>::evaluation_at_point(
         throw std::invalid_argument("Expected same number of evaluations as in registration.");
     }
 
-    FieldT result = FieldT::zero();
-
-    for (std::size_t i = 0; i < constituent_oracle_evaluations.size(); ++i)
-    {
-        result += this->random_coefficients_[i] * constituent_oracle_evaluations[i];
-    }
-
-    return result;
+    return vector_dot_product(this->random_coefficients_.data(),
+                              constituent_oracle_evaluations.data(),
+                              constituent_oracle_evaluations.size());
 }
 
 } // libiop
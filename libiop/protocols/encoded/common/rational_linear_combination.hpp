@@ -8,6 +8,7 @@ Virtual oracle for linear combinations of rational oracles
 #ifndef LIBIOP_PROTOCOLS_ENCODED_COMMON_RATIONAL_LINEAR_COMBINATION_HPP_
 #define LIBIOP_PROTOCOLS_ENCODED_COMMON_RATIONAL_LINEAR_COMBINATION_HPP_
 
+#include <algorithm>
 #include <cstring>
 #include <cstddef>
 #include <map>
@@ -26,7 +27,7 @@ protected:
 public:
     combined_denominator(const std::size_t num_rationals);
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
@@ -46,7 +47,7 @@ public:
      *      (r_1 * N_1 * D_2 * D_3) + (r_2 * N_2 * D_1 * D_3) + (r_3 * N_3 * D_1 * D_2)
      */
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
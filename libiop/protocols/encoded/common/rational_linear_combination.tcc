@@ -1,4 +1,5 @@
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
 
 namespace libiop {
 
@@ -11,7 +12,7 @@ combined_denominator<FieldT>::combined_denominator(const std::size_t num_rationa
 /* Returns the product of all the denominators */
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> combined_denominator<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != this->num_rationals_)
     {
@@ -19,17 +20,18 @@ std::shared_ptr<std::vector<FieldT>> combined_denominator<FieldT>::evaluated_con
     }
 
     std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>(
-        *constituent_oracle_evaluations[0].get());
+        constituent_oracle_evaluations[0].begin(),
+        constituent_oracle_evaluations[0].end());
     for (std::size_t i = 1; i < constituent_oracle_evaluations.size(); ++i)
     {
-        if (constituent_oracle_evaluations[i]->size() != result->size())
+        if (constituent_oracle_evaluations[i].size() != result->size())
         {
             throw std::invalid_argument("Vectors of mismatched size.");
         }
-        for (std::size_t j = 0; j < result->size(); ++j)
-        {
-            result->operator[](j) *= constituent_oracle_evaluations[i]->operator[](j);
-        }
+        vector_pointwise_multiply(result->data(),
+                                  constituent_oracle_evaluations[i].data(),
+                                  result->data(),
+                                  result->size());
     }
 
     return result;
@@ -79,22 +81,28 @@ void combined_numerator<FieldT>::set_coefficients(const std::vector<FieldT>& coe
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> combined_numerator<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const{
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const{
     if (constituent_oracle_evaluations.size() != 2*this->num_rationals_)
     {
         throw std::invalid_argument("Expected same number of evaluations as in registration.");
     }
 
-    const size_t codeword_domain_size = constituent_oracle_evaluations[0]->size();
+    const size_t codeword_domain_size = constituent_oracle_evaluations[0].size();
     std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>(
         codeword_domain_size, FieldT::zero());
-    for (size_t j = 0; j < codeword_domain_size; j++)
+    /** Build the terms a block of positions at a time, so that every step is
+     *  a vector kernel while the only scratch space is one small block. */
+    const size_t block_size = std::min<size_t>(256, codeword_domain_size);
+    std::vector<FieldT> cur(block_size);
+    for (size_t start = 0; start < codeword_domain_size; start += block_size)
     {
+        const size_t len = std::min(block_size, codeword_domain_size - start);
         for (size_t i = 0; i < this->num_rationals_; i++)
         {
-            FieldT cur = this->coefficients_[i];
-            /** Multiply by numerator */
-            cur *= constituent_oracle_evaluations[i]->operator[](j);
+            /** Numerator */
+            std::copy(constituent_oracle_evaluations[i].begin() + start,
+                      constituent_oracle_evaluations[i].begin() + start + len,
+                      cur.begin());
             /** Multiply by all other denominators */
             for (size_t k = this->num_rationals_; k < 2 * this->num_rationals_; k++)
             {
@@ -102,9 +110,13 @@ std::shared_ptr<std::vector<FieldT>> combined_numerator<FieldT>::evaluated_conte
                 {
                     continue;
                 }
-                cur *= constituent_oracle_evaluations[k]->operator[](j);
+                vector_pointwise_multiply(cur.data(),
+                                          constituent_oracle_evaluations[k].data() + start,
+                                          cur.data(),
+                                          len);
             }
-            result->operator[](j) += cur;
+            /** Scale by the coefficient while accumulating */
+            vector_axpy(this->coefficients_[i], cur.data(), result->data() + start, len);
         }
     }
 
@@ -202,12 +214,14 @@ std::vector<FieldT> rational_linear_combination<FieldT>::evaluated_contents(
     const std::vector<std::shared_ptr<std::vector<FieldT>>> &numerator_evals,
     const std::vector<std::shared_ptr<std::vector<FieldT>>> &denominator_evals) const
 {
+    std::vector<shared_buffer<FieldT>> all_evals;
+    all_evals.insert(all_evals.end(), denominator_evals.begin(), denominator_evals.end());
     std::vector<FieldT> combined_denominator_evals =
-        *this->denominator_->evaluated_contents(denominator_evals).get();
+        *this->denominator_->evaluated_contents(all_evals).get();
     const bool denominator_can_contain_zeroes = false;
     combined_denominator_evals = batch_inverse<FieldT>(
         combined_denominator_evals, denominator_can_contain_zeroes);
-    std::vector<std::shared_ptr<std::vector<FieldT>>> all_evals;
+    all_evals.clear();
     for (size_t i = 0; i < this->num_rationals_; i++)
     {
         all_evals.emplace_back(numerator_evals[i]);
@@ -217,10 +231,10 @@ std::vector<FieldT> rational_linear_combination<FieldT>::evaluated_contents(
         all_evals.emplace_back(denominator_evals[i]);
     }
     std::vector<FieldT> result = *this->numerator_->evaluated_contents(all_evals).get();
-    for (size_t i = 0; i < numerator_evals[0]->size(); i++)
-    {
-        result[i] *= combined_denominator_evals[i];
-    }
+    vector_pointwise_multiply(result.data(),
+                              combined_denominator_evals.data(),
+                              result.data(),
+                              numerator_evals[0]->size());
     return result;
 }
 
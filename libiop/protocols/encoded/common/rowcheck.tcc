@@ -1,5 +1,6 @@
 #include "libiop/algebra/utils.hpp"
 #include "libiop/algebra/lagrange.hpp"
+#include "libiop/common/tracing.hpp"
 
 namespace libiop {
 
@@ -16,17 +17,17 @@ rowcheck_ABC_virtual_oracle<FieldT>::rowcheck_ABC_virtual_oracle(
 /** Takes as input oracles Az, Bz, Cz. */
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> rowcheck_ABC_virtual_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>> > &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
-    libff::enter_block("rowcheck evaluated contents");
+    LIBIOP_TRACE_BEGIN("rowcheck evaluated contents");
     if (constituent_oracle_evaluations.size() != 3)
     {
         throw std::invalid_argument("rowcheck_ABC has three constituent oracles.");
     }
 
-    const std::shared_ptr<std::vector<FieldT>> &Az = constituent_oracle_evaluations[0];
-    const std::shared_ptr<std::vector<FieldT>> &Bz = constituent_oracle_evaluations[1];
-    const std::shared_ptr<std::vector<FieldT>> &Cz = constituent_oracle_evaluations[2];
+    const shared_buffer<FieldT> &Az = constituent_oracle_evaluations[0];
+    const shared_buffer<FieldT> &Bz = constituent_oracle_evaluations[1];
+    const shared_buffer<FieldT> &Cz = constituent_oracle_evaluations[2];
     /** Since evaluations of Z_H repeat, we evaluate Z over its unique evaluations
      *  Invert those evaluations, and use those within building the final codeword.
      *  These evaluations are the same for every coset of H in L.
@@ -59,7 +60,7 @@ std::shared_ptr<std::vector<FieldT>> rowcheck_ABC_virtual_oracle<FieldT>::evalua
             {
                 const size_t cur_pos = i*num_cosets_of_H + j;
                 result->emplace_back(Z_inv[j] * (
-                    Az->operator[](cur_pos) * Bz->operator[](cur_pos) - Cz->operator[](cur_pos)));
+                    Az[cur_pos] * Bz[cur_pos] - Cz[cur_pos]));
             }
         }
     }
@@ -78,11 +79,11 @@ std::shared_ptr<std::vector<FieldT>> rowcheck_ABC_virtual_oracle<FieldT>::evalua
                 cur_pos < coset_pos_upper_bound; cur_pos++)
             {
                 result->emplace_back(Z_inv_val *
-                    (Az->operator[](cur_pos) * Bz->operator[](cur_pos) - Cz->operator[](cur_pos)));
+                    (Az[cur_pos] * Bz[cur_pos] - Cz[cur_pos]));
             }
         }
     }
-    libff::leave_block("rowcheck evaluated contents");
+    LIBIOP_TRACE_END("rowcheck evaluated contents");
     return result;
 }
 
@@ -107,4 +108,37 @@ FieldT rowcheck_ABC_virtual_oracle<FieldT>::evaluation_at_point(
     return (Z_X_inv*(A_X*B_X-C_X));
 }
 
+template<typename FieldT>
+temporary_vector<FieldT> rowcheck_ABC_virtual_oracle<FieldT>::evaluations_at_points(
+    const temporary_vector<std::size_t> &evaluation_positions,
+    const temporary_vector<FieldT> &evaluation_points,
+    const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+{
+    libff::UNUSED(evaluation_positions);
+
+    if (constituent_oracle_evaluations.size() != 3)
+    {
+        throw std::invalid_argument("rowcheck_ABC has three constituent oracles.");
+    }
+
+    /* The codeword domain is disjoint from the constraint domain, so Z has no zeroes here */
+    temporary_vector<FieldT> Z_X_inv(temporary_resource());
+    Z_X_inv.reserve(evaluation_points.size());
+    for (const FieldT &X : evaluation_points)
+    {
+        Z_X_inv.emplace_back(this->Z_.evaluation_at_point(X));
+    }
+    Z_X_inv = batch_inverse(Z_X_inv);
+
+    const temporary_vector<FieldT> &A = constituent_oracle_evaluations[0];
+    const temporary_vector<FieldT> &B = constituent_oracle_evaluations[1];
+    const temporary_vector<FieldT> &C = constituent_oracle_evaluations[2];
+    temporary_vector<FieldT> result(evaluation_points.size(), temporary_resource());
+    for (std::size_t i = 0; i < evaluation_points.size(); ++i)
+    {
+        result[i] = Z_X_inv[i] * (A[i] * B[i] - C[i]);
+    }
+    return result;
+}
+
 } // libiop
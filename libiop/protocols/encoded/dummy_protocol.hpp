@@ -26,7 +26,7 @@ protected:
 public:
     dummy_oracle(const std::size_t num_oracles);
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
@@ -14,7 +14,7 @@ dummy_oracle<FieldT>::dummy_oracle(const std::size_t num_oracles) :
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> dummy_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != this->num_oracles_)
     {
@@ -22,7 +22,7 @@ std::shared_ptr<std::vector<FieldT>> dummy_oracle<FieldT>::evaluated_contents(
     }
 
     std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>();
-    result->reserve(constituent_oracle_evaluations[0]->size());
+    result->reserve(constituent_oracle_evaluations[0].size());
     for (size_t i = 0; i < result->size(); ++i)
     {
         result->emplace_back(FieldT::zero());
@@ -93,12 +93,7 @@ void dummy_protocol<FieldT>::calculate_and_submit_response()
 {
     for (size_t i = 0; i < this->num_oracles_; ++i)
     {
-        std::vector<FieldT> random_coefficients;
-        random_coefficients.reserve(this->degree_);
-        for (size_t j = 0; j < this->degree_; ++j)
-        {
-            random_coefficients.emplace_back(FieldT::random_element());
-        }
+        const std::vector<FieldT> random_coefficients = random_FieldT_vector<FieldT>(this->degree_);
         std::vector<FieldT> random_codeword =
             FFT_over_field_subset<FieldT>(random_coefficients, this->codeword_domain_);
         oracle<FieldT> random_oracle(random_codeword);
@@ -19,6 +19,7 @@ Test-Linear-Constraints from Ligero protocol [ACIV17], section 4.2.
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/iop/iop.hpp"
 #include "libiop/relations/r1cs.hpp"
+#include "libiop/relations/sparse_matrix.hpp"
 
 namespace libiop {
 
@@ -47,7 +48,7 @@ protected:
     bool make_zk_;
     field_subset_type field_subset_type_;
 
-    const naive_sparse_matrix<FieldT> constraint_matrix_;
+    const compressed_column_matrix<FieldT> constraint_matrix_;
     const std::vector<FieldT> target_vector_;
 
     std::vector<verifier_random_message_handle> random_linear_combination_handles_;
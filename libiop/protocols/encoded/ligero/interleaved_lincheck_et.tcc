@@ -2,6 +2,7 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/lagrange.hpp"
 namespace libiop {
@@ -28,7 +29,8 @@ interleaved_lincheck_et_protocol<FieldT>::interleaved_lincheck_et_protocol(
     num_interactions_(num_interactions),
     make_zk_(make_zk),
     field_subset_type_(domain_type),
-    constraint_matrix_(constraint_matrix),
+    constraint_matrix_(constraint_matrix,
+                       num_oracles * IOP.get_domain(systematic_domain_handle).num_elements()),
     target_vector_(target_vector)
 {
     this->codeword_domain_ = this->IOP_.get_domain(this->codeword_domain_handle_);
@@ -66,7 +68,7 @@ void interleaved_lincheck_et_protocol<FieldT>::register_linear_combinations()
     this->random_linear_combination_handles_.resize(this->num_interactions_);
     for (size_t i = 0; i < this->num_interactions_; ++i)
     {
-        this->random_linear_combination_handles_[i] = this->IOP_.register_verifier_random_message(this->constraint_matrix_.size());
+        this->random_linear_combination_handles_[i] = this->IOP_.register_verifier_random_message(this->constraint_matrix_.num_rows());
     }
 }
 
@@ -142,27 +144,22 @@ void interleaved_lincheck_et_protocol<FieldT>::calculate_and_submit_responses()
        dot product of the random linear combination and the target vector, in the equality test.)
        Then the prover interpolates the polynomial's coefficients, and sends them. */
 
+    std::vector<std::vector<FieldT>> random_linear_combinations(this->num_interactions_);
     for (size_t i = 0; i < this->num_interactions_; ++i)
     {
-        const std::vector<FieldT> random_linear_combination =
+        random_linear_combinations[i] =
             this->IOP_.obtain_verifier_random_message(this->random_linear_combination_handles_[i]);
+    }
+    /** Multiply constraint matrix by random values, to build a
+     * vector of s_i evaluations for every repetition, in one pass over the matrix. */
+    const std::vector<std::vector<FieldT>> row_vectors =
+        this->constraint_matrix_.transpose_multiply(random_linear_combinations);
 
+    for (size_t i = 0; i < this->num_interactions_; ++i)
+    {
         std::vector<FieldT> evals_of_response_poly(this->codeword_domain_size_, FieldT(0));
 
-        /** Multiply constraint matrix by random values, to build a
-         * vector of s_i evaluations */
-        std::vector<FieldT> row_vector(this->num_oracles_ * this->systematic_domain_size_, FieldT(0));
-        for (size_t j = 0; j < this->constraint_matrix_.size(); ++j)
-        {
-            std::map<std::size_t, FieldT> row = this->constraint_matrix_[j];
-            typename std::map<std::size_t, FieldT>::iterator it;
-            for (it = row.begin(); it != row.end(); it++)
-            {
-                const std::size_t idx = it->first;
-                const FieldT val = it->second;
-                row_vector[idx] += random_linear_combination[j] * val;
-            }
-        }
+        const std::vector<FieldT> &row_vector = row_vectors[i];
 
         for (size_t j = 0; j < this->num_oracles_; ++j)
         {
@@ -212,15 +209,24 @@ bool interleaved_lincheck_et_protocol<FieldT>::verifier_predicate()
 {
     const std::vector<FieldT> codeword_elements = this->codeword_domain_.all_elements(); // eta
 
+    std::vector<std::vector<FieldT>> random_linear_combinations(this->num_interactions_);
     for (size_t h = 0; h < this->num_interactions_; ++h)
     {
-        const std::vector<FieldT> random_linear_combination =
+        random_linear_combinations[h] =
             this->IOP_.obtain_verifier_random_message(this->random_linear_combination_handles_[h]);
+    }
+    /* Multiply matrix by random values, for all repetitions at once. */
+    const std::vector<std::vector<FieldT>> randomized_constraint_matrices =
+        this->constraint_matrix_.transpose_multiply(random_linear_combinations);
+
+    for (size_t h = 0; h < this->num_interactions_; ++h)
+    {
+        const std::vector<FieldT> &random_linear_combination = random_linear_combinations[h];
 
         /* EQUALITY TEST: does the polynomial that was sent sum to the value that it should if the
            claimed statement is true? */
 
-        libff::enter_block("Lincheck: equality test (polynomial matches randomized vector)");
+        LIBIOP_TRACE_BEGIN("Lincheck: equality test (polynomial matches randomized vector)");
         std::vector<FieldT> response = this->IOP_.receive_prover_message(this->response_handles_[h]); // coefficients of p_0
         const std::vector<FieldT> evaluations = FFT_over_field_subset<FieldT>(response, this->extended_systematic_domain_);
         const polynomial<FieldT> response_poly(std::move(response));
@@ -259,25 +265,13 @@ bool interleaved_lincheck_et_protocol<FieldT>::verifier_predicate()
 #endif // DEBUG
             return false;
         }
-        libff::leave_block("Lincheck: equality test (polynomial matches randomized vector)");
+        LIBIOP_TRACE_END("Lincheck: equality test (polynomial matches randomized vector)");
 
         /* Preparation for consistency test. */
 
         std::vector<polynomial<FieldT>> randomized_matrix_row_polys;
 
-        /* Multiply matrix by random values. */
-        std::vector<FieldT> randomized_constraint_matrix(this->num_oracles_ * this->systematic_domain_size_, FieldT(0));
-        for (size_t j = 0; j < this->constraint_matrix_.size(); ++j)
-        {
-            std::map<std::size_t, FieldT> row = this->constraint_matrix_[j];
-            typename std::map<std::size_t, FieldT>::iterator it;
-            for (it = row.begin(); it != row.end(); it++)
-            {
-                const std::size_t idx = it->first;
-                const FieldT val = it->second;
-                randomized_constraint_matrix[idx] += random_linear_combination[j] * val;
-            }
-        }
+        const std::vector<FieldT> &randomized_constraint_matrix = randomized_constraint_matrices[h];
 
         /* Split vector into rows over the systematic domain, to interpolate into polynomials (for
            the consistency test). */
@@ -298,7 +292,7 @@ bool interleaved_lincheck_et_protocol<FieldT>::verifier_predicate()
 
         /* CONSISTENCY TEST: do the polynomial's values match those of the oracles? */
 
-        libff::enter_block("Lincheck: querying and performing consistency tests");
+        LIBIOP_TRACE_BEGIN("Lincheck: querying and performing consistency tests");
         for (size_t k = 0; k < this->num_queries_; ++k)
         {
             const random_query_position_handle this_position_handle = this->query_position_handles_[k];
@@ -334,7 +328,7 @@ bool interleaved_lincheck_et_protocol<FieldT>::verifier_predicate()
                 return false;
             }
         }
-        libff::leave_block("Lincheck: querying and performing consistency tests");
+        LIBIOP_TRACE_END("Lincheck: querying and performing consistency tests");
     }
 
     return true;
@@ -20,6 +20,7 @@
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/iop/iop.hpp"
 #include "libiop/relations/r1cs.hpp"
+#include "libiop/relations/sparse_matrix.hpp"
 
 namespace libiop {
 
@@ -47,7 +48,7 @@ protected:
     const bool make_zk_;
     const field_subset_type field_subset_type_;
 
-    const naive_sparse_matrix<FieldT> constraint_matrix_;
+    const compressed_column_matrix<FieldT> constraint_matrix_;
 
     std::vector<verifier_random_message_handle> random_linear_combination_handles_;
     std::vector<prover_message_handle> response_handles_;
@@ -3,6 +3,7 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/lagrange.hpp"
 
@@ -30,7 +31,8 @@ interleaved_lincheck_ot_protocol<FieldT>::interleaved_lincheck_ot_protocol(
     num_interactions_(num_interactions),
     make_zk_(make_zk),
     field_subset_type_(domain_type),
-    constraint_matrix_(constraint_matrix)
+    constraint_matrix_(constraint_matrix,
+                       num_oracles_input * IOP.get_domain(systematic_domain_handle).num_elements())
 {
     this->codeword_domain_ = this->IOP_.get_domain(this->codeword_domain_handle_);
     this->codeword_domain_size_ = this->codeword_domain_.num_elements();
@@ -76,7 +78,7 @@ void interleaved_lincheck_ot_protocol<FieldT>::register_linear_combinations()
     this->random_linear_combination_handles_.resize(this->num_interactions_);
     for (size_t i = 0; i < this->num_interactions_; ++i)
     {
-        this->random_linear_combination_handles_[i] = this->IOP_.register_verifier_random_message(this->constraint_matrix_.size());
+        this->random_linear_combination_handles_[i] = this->IOP_.register_verifier_random_message(this->constraint_matrix_.num_rows());
     }
 }
 
@@ -202,7 +204,7 @@ void interleaved_lincheck_ot_protocol<FieldT>::calculate_and_submit_responses(co
        0s) as an argument, encode it, and add it to the encoded (hidden) input, which should start
        with 0s. By linearity, this will give the right result iff the correct overall input begins
        with the public prefix. */
-    libff::enter_block("Input consistency");
+    LIBIOP_TRACE_BEGIN("Input consistency");
     std::vector<std::vector<FieldT>> supplementary_input_vectors;
     supplementary_input_vectors.resize(this->num_oracles_input_);
     const std::size_t num_supplementary_input_vectors = (std::size_t) ceil((supplementary_input_size + 0.0) / this->systematic_domain_size_);
@@ -242,7 +244,7 @@ void interleaved_lincheck_ot_protocol<FieldT>::calculate_and_submit_responses(co
     {
         supplementary_target_vectors[i] = std::vector<FieldT>(this->codeword_domain_size_, FieldT(0));
     }
-    libff::leave_block("Input consistency");
+    LIBIOP_TRACE_END("Input consistency");
 
     /* We accept values for the random linear combinations as a parameter, to ensure consistency.
        If none are given, we use the actual random values sent by the verifier. */
@@ -256,28 +258,21 @@ void interleaved_lincheck_ot_protocol<FieldT>::calculate_and_submit_responses(co
         }
     }
 
+    /** Row vector h is the concatenation of evaluations of s_i in the systematic domain,
+     * for the h-th random linear combination. It can be thought of as a flattened matrix
+     * with num_oracles_input rows, and systematic_domain_size columns, where each row is
+     * the evaluations for a given s_i. All repetitions are computed in one pass over the matrix. */
+    const std::vector<std::vector<FieldT>> row_vectors =
+        this->constraint_matrix_.transpose_multiply(random_linear_combinations);
+
     for (size_t h = 0; h < this->num_interactions_; ++h)
     {
         /* each interaction will have a different random linear combination */
-        const std::vector<FieldT> random_linear_combination = random_linear_combinations[h];
+        const std::vector<FieldT> &random_linear_combination = random_linear_combinations[h];
 
         std::vector<FieldT> evals_of_response_poly(this->codeword_domain_size_, FieldT(0));
 
-        /** Set row vector to be the concatenation of evaluations of s_i in the systematic domain.
-         * It can be thought of as a flattened matrix with num_oracles_input rows, and
-         * systematic_domain_size columns, where each row is the evaluations for a given s_i. */
-        std::vector<FieldT> row_vector(this->num_oracles_input_ * this->systematic_domain_size_, FieldT(0));
-        for (size_t j = 0; j < this->constraint_matrix_.size(); ++j)
-        {
-            std::map<std::size_t, FieldT> row = this->constraint_matrix_[j];
-            typename std::map<std::size_t, FieldT>::iterator it;
-            for (it = row.begin(); it != row.end(); it++)
-            {
-                const std::size_t idx = it->first;
-                const FieldT val = it->second;
-                row_vector[idx] += random_linear_combination[j] * val;
-            }
-        }
+        const std::vector<FieldT> &row_vector = row_vectors[h];
 
         /** handles creating the component of p for
          *  the sum over all output oracles: r_i * f_{x,i} */
@@ -400,7 +395,7 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
                                                                   std::vector<std::vector<FieldT>> random_linear_combinations,
                                                                   std::vector<std::vector<FieldT>> lagrange_coefficients)
 {
-    libff::enter_block("Input consistency");
+    LIBIOP_TRACE_BEGIN("Input consistency");
     std::vector<std::vector<FieldT>> supplementary_input_vectors;
     supplementary_input_vectors.resize(this->num_oracles_input_);
     const std::size_t num_supplementary_input_vectors = (std::size_t) ceil((supplementary_input_size + 0.0) / this->systematic_domain_size_);
@@ -440,7 +435,7 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
     {
         supplementary_target_vectors[i] = std::vector<FieldT>(this->codeword_domain_size_, FieldT(0));
     }
-    libff::leave_block("Input consistency");
+    LIBIOP_TRACE_END("Input consistency");
 
     if (random_linear_combinations.size() == 0)
     {
@@ -462,12 +457,16 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
 
     const std::vector<FieldT> codeword_elements = this->codeword_domain_.all_elements(); // eta
 
+    /* Multiply matrix by random values, for all repetitions at once. (building s_i) */
+    const std::vector<std::vector<FieldT>> randomized_matrix_vectors =
+        this->constraint_matrix_.transpose_multiply(random_linear_combinations);
+
     for (size_t h = 0; h < this->num_interactions_; ++h)
     {
         /* EQUALITY TEST: does the polynomial that was sent sum to 0 over the systematic domain, as
            it should if the claimed statement is true? */
 
-        libff::enter_block("Lincheck: equality test (p_0 sums to 0 over systematic domain)");
+        LIBIOP_TRACE_BEGIN("Lincheck: equality test (p_0 sums to 0 over systematic domain)");
         std::vector<FieldT> response = this->IOP_.receive_prover_message(this->response_handles_[h]); // coefficients of p_0
         const std::vector<FieldT> evaluations = FFT_over_field_subset<FieldT>(response, this->extended_systematic_domain_);
         polynomial<FieldT> response_poly(std::move(response));
@@ -492,11 +491,11 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
 #endif // DEBUG
             return false;
         }
-        libff::leave_block("Lincheck: equality test (p_0 sums to 0 over systematic domain)");
+        LIBIOP_TRACE_END("Lincheck: equality test (p_0 sums to 0 over systematic domain)");
 
         /* Preparation for consistency test. */
 
-        const std::vector<FieldT> random_linear_combination = random_linear_combinations[h];
+        const std::vector<FieldT> &random_linear_combination = random_linear_combinations[h];
 
         /* Split vector into rows over the systematic domain, to interpolate into polynomials (for
            the consistency test). */
@@ -512,19 +511,7 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
             random_linear_combination_row_vectors.emplace_back(std::move(random_linear_combination_row_vector));
         }
 
-        /* Multiply matrix by random values. (building s_i) */
-        std::vector<FieldT> randomized_matrix_vector(this->num_oracles_input_ * this->systematic_domain_size_, FieldT(0));
-        for (size_t j = 0; j < this->constraint_matrix_.size(); ++j)
-        {
-            std::map<std::size_t, FieldT> row = this->constraint_matrix_[j];
-            typename std::map<std::size_t, FieldT>::iterator it;
-            for (it = row.begin(); it != row.end(); it++)
-            {
-                const std::size_t idx = it->first;
-                const FieldT val = it->second;
-                randomized_matrix_vector[idx] += random_linear_combination[j] * val;
-            }
-        }
+        const std::vector<FieldT> &randomized_matrix_vector = randomized_matrix_vectors[h];
 
         /* Split vector into rows over the systematic domain, to interpolate into polynomials (for
            the consistency test). */
@@ -572,7 +559,7 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
         {
             /* TODO: efficiency running FFTs to evaluate here vs saving polynomials and evaluating them
             in tests depends on parameters */
-            libff::enter_block("Precomputing for consistency tests");
+            LIBIOP_TRACE_BEGIN("Precomputing for consistency tests");
             random_linear_combination_row_evals.reserve(this->num_oracles_target_);
             for (size_t i = 0; i < this->num_oracles_target_; ++i)
             {
@@ -593,10 +580,10 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
                                                                                 this->codeword_domain_);
                 randomized_matrix_row_vector_evals.emplace_back(std::move(row_vector_poly_evals));
             }
-            libff::leave_block("Precomputing for consistency tests");
+            LIBIOP_TRACE_END("Precomputing for consistency tests");
         }
 
-        libff::enter_block("Lincheck: querying and performing consistency tests");
+        LIBIOP_TRACE_BEGIN("Lincheck: querying and performing consistency tests");
         for (size_t k = 0; k < this->num_queries_; ++k)
         {
             const random_query_position_handle this_position_handle = this->query_position_handles_[k];
@@ -689,7 +676,7 @@ bool interleaved_lincheck_ot_protocol<FieldT>::verifier_predicate(const std::vec
                 return false;
             }
         }
-        libff::leave_block("Lincheck: querying and performing consistency tests");
+        LIBIOP_TRACE_END("Lincheck: querying and performing consistency tests");
     }
 
     return true;
@@ -1,6 +1,7 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/fft.hpp"
 
 namespace libiop {
@@ -216,7 +217,7 @@ bool interleaved_rowcheck_protocol<FieldT>::verifier_predicate()
         /* EQUALITY TEST: does the polynomial that was sent equal 0 over the entire systematic
            domain, as it should if the claimed statement is true? */
 
-        libff::enter_block("Rowcheck: equality test (p_0 equals 0 within systematic domain)");
+        LIBIOP_TRACE_BEGIN("Rowcheck: equality test (p_0 equals 0 within systematic domain)");
         std::vector<FieldT> response = this->IOP_.receive_prover_message(this->response_handles_[h]); // coefficients of p_0
         const std::vector<FieldT> evaluations = FFT_over_field_subset<FieldT>(response, this->extended_systematic_domain_);
         const polynomial<FieldT> response_poly(std::move(response));
@@ -238,14 +239,14 @@ bool interleaved_rowcheck_protocol<FieldT>::verifier_predicate()
                 return false;
             }
         }
-        libff::leave_block("Rowcheck: equality test (p_0 equals 0 within systematic domain)");
+        LIBIOP_TRACE_END("Rowcheck: equality test (p_0 equals 0 within systematic domain)");
 
         const std::vector<FieldT> random_linear_combination =
             this->IOP_.obtain_verifier_random_message(this->random_linear_combination_handles_[h]);
 
         /* CONSISTENCY TEST: do the polynomial's values match those of the oracles? */
 
-        libff::enter_block("Rowcheck: querying and performing consistency tests");
+        LIBIOP_TRACE_BEGIN("Rowcheck: querying and performing consistency tests");
         for (size_t k = 0; k < this->num_queries_; ++k)
         {
             const random_query_position_handle this_position_handle = this->query_position_handles_[k];
@@ -287,7 +288,7 @@ bool interleaved_rowcheck_protocol<FieldT>::verifier_predicate()
                 return false;
             }
         }
-        libff::leave_block("Rowcheck: querying and performing consistency tests");
+        LIBIOP_TRACE_END("Rowcheck: querying and performing consistency tests");
     }
 
     return true;
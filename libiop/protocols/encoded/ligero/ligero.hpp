@@ -118,8 +118,15 @@ public:
     bool verifier_predicate(const r1cs_primary_input<FieldT> &primary_input);
 
 protected:
-    void submit_zero_sum_blinding_vector(const oracle_handle_ptr &handle);
-    void submit_zero_blinding_vector(const oracle_handle_ptr &handle);
+    /* Evaluations over the systematic domain which sum to zero */
+    std::vector<FieldT> sample_zero_sum_blinding_vector() const;
+    /* Evaluations over the extended systematic domain which are zero on the systematic domain */
+    std::vector<FieldT> sample_zero_blinding_vector() const;
+
+    /** Low degree extends every row from row_domain onto the codeword domain.
+     *  The rows are independent, so under MULTICORE they are encoded in parallel. */
+    std::vector<std::vector<FieldT> > encode_rows(const std::vector<std::vector<FieldT> > &rows,
+                                                  const field_subset<FieldT> &row_domain) const;
 };
 
 } // namespace libiop
@@ -2,8 +2,11 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/lagrange.hpp"
 #include "libiop/algebra/fft.hpp"
+#include "libiop/algebra/low_degree_extension.hpp"
+#include "libiop/algebra/randomness.hpp"
 #include <libff/common/utils.hpp>
 
 namespace libiop {
@@ -218,9 +221,9 @@ template<typename FieldT>
 void interleaved_r1cs_protocol<FieldT>::submit_witness_oracles(const r1cs_primary_input<FieldT> &primary_input,
                                                                const r1cs_auxiliary_input<FieldT> &auxiliary_input)
 {
-    libff::enter_block("Submit witness oracles");
+    LIBIOP_TRACE_BEGIN("Submit witness oracles");
 
-    libff::enter_block("Generate extended witness and auxiliary witness");
+    LIBIOP_TRACE_BEGIN("Generate extended witness and auxiliary witness");
     /* construct z = (1, v, w) */
     std::vector<FieldT> extended_witness = std::vector<FieldT>(1, FieldT(1));
     extended_witness.insert(extended_witness.end(),
@@ -241,9 +244,9 @@ void interleaved_r1cs_protocol<FieldT>::submit_witness_oracles(const r1cs_primar
     auxiliary_only_witness.insert(auxiliary_only_witness.end(),
                                   auxiliary_input.begin(),
                                   auxiliary_input.end());
-    libff::leave_block("Generate extended witness and auxiliary witness");
+    LIBIOP_TRACE_END("Generate extended witness and auxiliary witness");
 
-    libff::enter_block("Perform matrix multiplications");
+    LIBIOP_TRACE_BEGIN("Perform matrix multiplications");
     std::vector<FieldT> a_result_vector;
     for (size_t i = 0; i < this->matrix_height_; ++i)
     {
@@ -288,84 +291,89 @@ void interleaved_r1cs_protocol<FieldT>::submit_witness_oracles(const r1cs_primar
         }
         c_result_vector.push_back(sum);
     }
-    libff::leave_block("Perform matrix multiplications");
-
-    libff::enter_block("Submit input oracles");
+    LIBIOP_TRACE_END("Perform matrix multiplications");
+
+    /** All rows are encoded as one batch, and then submitted serially
+     *  in the same order as before, so the transcript does not change. */
+    LIBIOP_TRACE_BEGIN("Encode witness rows");
+    std::vector<std::vector<FieldT> > rows;
+    std::vector<oracle_handle_ptr> handles;
+    rows.reserve(this->num_oracles_input_ + 3 * this->num_oracles_vectors_);
+    handles.reserve(this->num_oracles_input_ + 3 * this->num_oracles_vectors_);
     for (size_t i = 0; i < this->num_oracles_input_; ++i)
     {
         const std::size_t start = i * this->systematic_domain_size_;
         const std::size_t end = start + this->systematic_domain_size_;
 
-        const std::vector<FieldT> w_row(&auxiliary_only_witness[start], &auxiliary_only_witness[end]);
-        const std::vector<FieldT> w_row_coefficients =
-            IFFT_over_field_subset<FieldT>(w_row, this->systematic_domain_);
-        oracle<FieldT> w_row_oracle(FFT_over_field_subset(w_row_coefficients, this->codeword_domain_));
-        this->IOP_.submit_oracle(this->w_vector_handles_[i], std::move(w_row_oracle));
+        rows.emplace_back(&auxiliary_only_witness[start], &auxiliary_only_witness[end]);
+        handles.emplace_back(this->w_vector_handles_[i]);
     }
-    libff::leave_block("Submit input oracles");
-
-    libff::enter_block("Submit vector oracles");
     for (size_t i = 0; i < this->num_oracles_vectors_; ++i)
     {
         const std::size_t start = i * this->systematic_domain_size_;
         const std::size_t end = start + this->systematic_domain_size_;
 
-        const std::vector<FieldT> a_row(&a_result_vector[start], &a_result_vector[end]);
-        const std::vector<FieldT> a_row_coefficients =
-            IFFT_over_field_subset<FieldT>(a_row, this->systematic_domain_);
-        oracle<FieldT> a_row_oracle(FFT_over_field_subset(a_row_coefficients, this->codeword_domain_));
-        this->IOP_.submit_oracle(this->a_vector_handles_[i], std::move(a_row_oracle));
-
-        const std::vector<FieldT> b_row(&b_result_vector[start], &b_result_vector[end]);
-        const std::vector<FieldT> b_row_coefficients =
-            IFFT_over_field_subset<FieldT>(b_row, this->systematic_domain_);
-        oracle<FieldT> b_row_oracle(FFT_over_field_subset(b_row_coefficients, this->codeword_domain_));
-        this->IOP_.submit_oracle(this->b_vector_handles_[i], std::move(b_row_oracle));
-
-        const std::vector<FieldT> c_row(&c_result_vector[start], &c_result_vector[end]);
-        const std::vector<FieldT> c_row_coefficients =
-            IFFT_over_field_subset<FieldT>(c_row, this->systematic_domain_);
-        oracle<FieldT> c_row_oracle(FFT_over_field_subset(c_row_coefficients, this->codeword_domain_));
-        this->IOP_.submit_oracle(this->c_vector_handles_[i], std::move(c_row_oracle));
+        rows.emplace_back(&a_result_vector[start], &a_result_vector[end]);
+        handles.emplace_back(this->a_vector_handles_[i]);
+        rows.emplace_back(&b_result_vector[start], &b_result_vector[end]);
+        handles.emplace_back(this->b_vector_handles_[i]);
+        rows.emplace_back(&c_result_vector[start], &c_result_vector[end]);
+        handles.emplace_back(this->c_vector_handles_[i]);
+    }
+    std::vector<std::vector<FieldT> > encoded_rows = this->encode_rows(rows, this->systematic_domain_);
+    LIBIOP_TRACE_END("Encode witness rows");
+
+    LIBIOP_TRACE_BEGIN("Submit witness row oracles");
+    for (size_t i = 0; i < encoded_rows.size(); ++i)
+    {
+        this->IOP_.submit_oracle(handles[i], oracle<FieldT>(std::move(encoded_rows[i])));
     }
-    libff::leave_block("Submit vector oracles");
-    libff::leave_block("Submit witness oracles");
+    LIBIOP_TRACE_END("Submit witness row oracles");
+    LIBIOP_TRACE_END("Submit witness oracles");
 }
 
 template<typename FieldT>
-void interleaved_r1cs_protocol<FieldT>::submit_zero_sum_blinding_vector(const oracle_handle_ptr &handle)
+std::vector<std::vector<FieldT> > interleaved_r1cs_protocol<FieldT>::encode_rows(
+    const std::vector<std::vector<FieldT> > &rows,
+    const field_subset<FieldT> &row_domain) const
 {
-    std::vector<FieldT> elems;
-    elems.resize(this->systematic_domain_size_);
+    std::vector<std::vector<FieldT> > encoded_rows(rows.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        encoded_rows[i] = low_degree_extend<FieldT>(rows[i], row_domain, this->codeword_domain_);
+    }
+    return encoded_rows;
+}
+
+template<typename FieldT>
+std::vector<FieldT> interleaved_r1cs_protocol<FieldT>::sample_zero_sum_blinding_vector() const
+{
+    std::vector<FieldT> elems(this->systematic_domain_size_);
+    random_field_elements(elems.data(), this->systematic_domain_size_ - 1);
     FieldT sum(0);
     for (size_t i = 0; i < this->systematic_domain_size_ - 1; ++i)
     {
-        elems[i] = FieldT::random_element();
         sum += elems[i];
     }
     elems[this->systematic_domain_size_ - 1] = -sum;
-
-    const std::vector<FieldT> coeffs = IFFT_over_field_subset<FieldT>(elems, this->systematic_domain_);
-    const std::vector<FieldT> vector = FFT_over_field_subset<FieldT>(coeffs, this->codeword_domain_);
-    oracle<FieldT> vector_oracle(vector);
-    this->IOP_.submit_oracle(handle, std::move(vector_oracle));
+    return elems;
 }
 
 template<typename FieldT>
-void interleaved_r1cs_protocol<FieldT>::submit_zero_blinding_vector(const oracle_handle_ptr &handle)
+std::vector<FieldT> interleaved_r1cs_protocol<FieldT>::sample_zero_blinding_vector() const
 {
     std::vector<FieldT> elems(this->extended_systematic_domain_size_, FieldT(0));
-    for (size_t i = this->systematic_domain_size_; i < this->systematic_domain_size_ + this->encoding_independence_; ++i)
+    const std::vector<FieldT> blinding = random_FieldT_vector<FieldT>(this->encoding_independence_);
+    for (size_t i = 0; i < this->encoding_independence_; ++i)
     {
         const std::size_t index = this->extended_systematic_domain_.reindex_by_subset(
-            this->systematic_domain_.dimension(), i);
-        elems[index] = FieldT::random_element();
+            this->systematic_domain_.dimension(), this->systematic_domain_size_ + i);
+        elems[index] = blinding[i];
     }
-
-    const std::vector<FieldT> coeffs = IFFT_over_field_subset<FieldT>(elems, this->extended_systematic_domain_);
-    const std::vector<FieldT> vector = FFT_over_field_subset<FieldT>(coeffs, this->codeword_domain_);
-    oracle<FieldT> vector_oracle(vector);
-    this->IOP_.submit_oracle(handle, std::move(vector_oracle));
+    return elems;
 }
 
 template<typename FieldT>
@@ -373,19 +381,41 @@ void interleaved_r1cs_protocol<FieldT>::submit_blinding_vector_oracles()
 {
     assert(this->make_zk_);
 
+    /** Sample in the original order, so the same randomness gives the same vectors,
+     *  then encode each domain's vectors as one batch. */
+    std::vector<std::vector<FieldT> > zero_sum_vectors;
+    std::vector<std::vector<FieldT> > zero_vectors;
+    zero_sum_vectors.reserve(3 * this->num_interactions_);
+    zero_vectors.reserve(this->num_interactions_);
+    for (size_t i = 0; i < this->num_interactions_; ++i)
+    {
+        zero_sum_vectors.emplace_back(this->sample_zero_sum_blinding_vector());
+        zero_sum_vectors.emplace_back(this->sample_zero_sum_blinding_vector());
+        zero_sum_vectors.emplace_back(this->sample_zero_sum_blinding_vector());
+        zero_vectors.emplace_back(this->sample_zero_blinding_vector());
+    }
+    std::vector<std::vector<FieldT> > encoded_zero_sum_vectors =
+        this->encode_rows(zero_sum_vectors, this->systematic_domain_);
+    std::vector<std::vector<FieldT> > encoded_zero_vectors =
+        this->encode_rows(zero_vectors, this->extended_systematic_domain_);
+
     for (size_t i = 0; i < this->num_interactions_; ++i)
     {
-        this->submit_zero_sum_blinding_vector(this->lincheck_A_blinding_vector_handles_[i]);
-        this->submit_zero_sum_blinding_vector(this->lincheck_B_blinding_vector_handles_[i]);
-        this->submit_zero_sum_blinding_vector(this->lincheck_C_blinding_vector_handles_[i]);
-        this->submit_zero_blinding_vector(this->rowcheck_blinding_vector_handles_[i]);
+        this->IOP_.submit_oracle(this->lincheck_A_blinding_vector_handles_[i],
+                                 oracle<FieldT>(std::move(encoded_zero_sum_vectors[3 * i])));
+        this->IOP_.submit_oracle(this->lincheck_B_blinding_vector_handles_[i],
+                                 oracle<FieldT>(std::move(encoded_zero_sum_vectors[3 * i + 1])));
+        this->IOP_.submit_oracle(this->lincheck_C_blinding_vector_handles_[i],
+                                 oracle<FieldT>(std::move(encoded_zero_sum_vectors[3 * i + 2])));
+        this->IOP_.submit_oracle(this->rowcheck_blinding_vector_handles_[i],
+                                 oracle<FieldT>(std::move(encoded_zero_vectors[i])));
     }
 }
 
 template<typename FieldT>
 void interleaved_r1cs_protocol<FieldT>::calculate_and_submit_proof(const r1cs_primary_input<FieldT> &primary_input)
 {
-    libff::enter_block("Calculating and submitting proof");
+    LIBIOP_TRACE_BEGIN("Calculating and submitting proof");
 
     /* construct additional input as (1,v,0) */
     const std::size_t input_size = this->num_oracles_input_ * this->systematic_domain_size_;
@@ -401,20 +431,20 @@ void interleaved_r1cs_protocol<FieldT>::calculate_and_submit_proof(const r1cs_pr
     std::vector<FieldT> additional_target = std::vector<FieldT>(target_size, FieldT(0));
 
     std::vector<std::vector<FieldT>> random_linear_combinations = this->lincheck_A_->all_random_linear_combinations();
-    libff::enter_block("Calculating and submitting response: Lincheck A");
+    LIBIOP_TRACE_BEGIN("Calculating and submitting response: Lincheck A");
     this->lincheck_A_->calculate_and_submit_responses(additional_input, additional_input_size, additional_target, 0, random_linear_combinations);
-    libff::leave_block("Calculating and submitting response: Lincheck A");
-    libff::enter_block("Calculating and submitting response: Lincheck B");
+    LIBIOP_TRACE_END("Calculating and submitting response: Lincheck A");
+    LIBIOP_TRACE_BEGIN("Calculating and submitting response: Lincheck B");
     this->lincheck_B_->calculate_and_submit_responses(additional_input, additional_input_size, additional_target, 0, random_linear_combinations);
-    libff::leave_block("Calculating and submitting response: Lincheck B");
-    libff::enter_block("Calculating and submitting response: Lincheck C");
+    LIBIOP_TRACE_END("Calculating and submitting response: Lincheck B");
+    LIBIOP_TRACE_BEGIN("Calculating and submitting response: Lincheck C");
     this->lincheck_C_->calculate_and_submit_responses(additional_input, additional_input_size, additional_target, 0, random_linear_combinations);
-    libff::leave_block("Calculating and submitting response: Lincheck C");
+    LIBIOP_TRACE_END("Calculating and submitting response: Lincheck C");
 
-    libff::enter_block("Calculating and submitting response: Rowcheck");
+    LIBIOP_TRACE_BEGIN("Calculating and submitting response: Rowcheck");
     this->rowcheck_->calculate_and_submit_responses();
-    libff::leave_block("Calculating and submitting response: Rowcheck");
-    libff::leave_block("Calculating and submitting proof");
+    LIBIOP_TRACE_END("Calculating and submitting response: Rowcheck");
+    LIBIOP_TRACE_END("Calculating and submitting proof");
 }
 
 /* Verification */
@@ -433,7 +463,7 @@ bool interleaved_r1cs_protocol<FieldT>::verifier_predicate(const r1cs_primary_in
     const std::size_t target_size = this->num_oracles_vectors_ * this->systematic_domain_size_;
     std::vector<FieldT> additional_target = std::vector<FieldT>(target_size, FieldT(0));
 
-    libff::enter_block("Getting Lagrange coefficients for Lincheck tests");
+    LIBIOP_TRACE_BEGIN("Getting Lagrange coefficients for Lincheck tests");
     const std::vector<FieldT> query_points = this->lincheck_A_->all_query_points();
     std::vector<std::vector<FieldT>> lagrange_coefficients;
     if (this->field_subset_type_ == affine_subspace_type)
@@ -441,40 +471,40 @@ bool interleaved_r1cs_protocol<FieldT>::verifier_predicate(const r1cs_primary_in
         lagrange_coefficients =
             this->lincheck_A_->lagrange_coefficients_for_query_points(query_points);
     }
-    libff::leave_block("Getting Lagrange coefficients for Lincheck tests");
+    LIBIOP_TRACE_END("Getting Lagrange coefficients for Lincheck tests");
 
     const std::vector<std::vector<FieldT>> random_linear_combinations = this->lincheck_A_->all_random_linear_combinations();
-    libff::enter_block("Checking predicate for Lincheck A");
+    LIBIOP_TRACE_BEGIN("Checking predicate for Lincheck A");
     if (!this->lincheck_A_->verifier_predicate(additional_input, additional_input_size, additional_target, 0, random_linear_combinations, lagrange_coefficients))
     {
         libff::print_indent(); printf("Interleaved Lincheck for A matrix failed\n");
         return false;
     }
-    libff::leave_block("Checking predicate for Lincheck A");
+    LIBIOP_TRACE_END("Checking predicate for Lincheck A");
 
-    libff::enter_block("Checking predicate for Lincheck B");
+    LIBIOP_TRACE_BEGIN("Checking predicate for Lincheck B");
     if (!this->lincheck_B_->verifier_predicate(additional_input, additional_input_size, additional_target, 0, random_linear_combinations, lagrange_coefficients))
     {
         libff::print_indent(); printf("Interleaved Lincheck for B matrix failed\n");
         return false;
     }
-    libff::leave_block("Checking predicate for Lincheck B");
+    LIBIOP_TRACE_END("Checking predicate for Lincheck B");
 
-    libff::enter_block("Checking predicate for Lincheck C");
+    LIBIOP_TRACE_BEGIN("Checking predicate for Lincheck C");
     if (!this->lincheck_C_->verifier_predicate(additional_input, additional_input_size, additional_target, 0, random_linear_combinations, lagrange_coefficients))
     {
         libff::print_indent(); printf("Interleaved Lincheck for C matrix failed\n");
         return false;
     }
-    libff::leave_block("Checking predicate for Lincheck C");
+    LIBIOP_TRACE_END("Checking predicate for Lincheck C");
 
-    libff::enter_block("Checking predicate for Rowcheck");
+    LIBIOP_TRACE_BEGIN("Checking predicate for Rowcheck");
     if (!this->rowcheck_->verifier_predicate())
     {
         libff::print_indent(); printf("Interleaved Rowcheck failed\n");
         return false;
     }
-    libff::leave_block("Checking predicate for Rowcheck");
+    LIBIOP_TRACE_END("Checking predicate for Rowcheck");
 
     return true;
 }
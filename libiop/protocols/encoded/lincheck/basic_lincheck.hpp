@@ -36,6 +36,9 @@ protected:
     /** TODO: Eventually parameterize number of separate sumcheck instances separately. */
     size_t multi_lincheck_repetitions_;
     bool override_security_parameter_ = false;
+    /** Whether the lincheck polynomials are evaluated at query points by barycentric
+     *  interpolation over the summation domain, rather than by IFFTing them once. */
+    bool use_lagrange_ = false;
 public:
     basic_lincheck_parameters() {};
     basic_lincheck_parameters(const size_t interactive_security_parameter,
@@ -47,7 +50,14 @@ public:
      *  This is intended to allow experimentation with multi lincheck parameterizations. */
     void override_security_parameter(const size_t multi_lincheck_repetitions);
 
+    void set_use_lagrange(const bool use_lagrange);
+    /** Lagrange evaluation costs about 6|H| multiplications per query point, against 2|H| to
+     *  evaluate the IFFTed polynomials, but it saves the two IFFTs over the summation domain H,
+     *  about |H| log|H| multiplications. So it is cheaper when 4 * num_query_points < log|H|. */
+    static bool lagrange_is_cheaper(const size_t summation_domain_dim, const size_t num_query_points);
+
     size_t multi_lincheck_repetitions() const;
+    bool use_lagrange() const;
     bool make_zk() const;
     field_subset_type domain_type() const;
 
@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -74,6 +76,25 @@ size_t basic_lincheck_parameters<FieldT>::multi_lincheck_repetitions() const
     return this->multi_lincheck_repetitions_;
 }
 
+template<typename FieldT>
+void basic_lincheck_parameters<FieldT>::set_use_lagrange(const bool use_lagrange)
+{
+    this->use_lagrange_ = use_lagrange;
+}
+
+template<typename FieldT>
+bool basic_lincheck_parameters<FieldT>::lagrange_is_cheaper(
+    const size_t summation_domain_dim, const size_t num_query_points)
+{
+    return 4 * num_query_points < summation_domain_dim;
+}
+
+template<typename FieldT>
+bool basic_lincheck_parameters<FieldT>::use_lagrange() const
+{
+    return this->use_lagrange_;
+}
+
 template<typename FieldT>
 void basic_lincheck_parameters<FieldT>::override_security_parameter(const size_t multi_lincheck_repetitions)
 {
@@ -114,6 +135,7 @@ void basic_lincheck_parameters<FieldT>::print() const
     libff::print_indent(); printf("* constraint domain dim = %zu\n", this->constraint_domain_dim_);
     libff::print_indent(); printf("* make zk = %s\n", (this->make_zk_ ? "true" : "false"));
     libff::print_indent(); printf("* domain type = %s\n", field_subset_type_names[this->domain_type_]);
+    libff::print_indent(); printf("* Lagrange evaluation = %s\n", (this->use_lagrange_ ? "true" : "false"));
 }
 
 template<typename FieldT>
@@ -167,13 +189,14 @@ multi_lincheck<FieldT>::multi_lincheck(
     this->sumchecks_.resize(this->params_.multi_lincheck_repetitions());
     this->multi_lincheck_virtual_oracles_.resize(this->params_.multi_lincheck_repetitions());
 
-    /** See multi_lincheck_aux.hpp for explanation of this flag, it is currently unused though. */
-    const bool using_lagrange = false;
-    if (using_lagrange)
+    /** See multi_lincheck_aux.hpp for explanation of this flag.
+     *  One cache over the summation domain is shared by all repetitions. */
+    std::shared_ptr<lagrange_cache<FieldT>> lagrange_coefficients_cache;
+    if (this->params_.use_lagrange())
     {
         /** Only cache across repetitions if there is more than 1 repetition */
         const bool cache_evaluations = this->params_.multi_lincheck_repetitions() > 1;
-        std::shared_ptr<lagrange_cache<FieldT>> lagrange_coefficients_cache =
+        lagrange_coefficients_cache =
             std::make_shared<lagrange_cache<FieldT> >(summation_domain, cache_evaluations);
     }
 
@@ -197,7 +220,8 @@ multi_lincheck<FieldT>::multi_lincheck(
             variable_domain,
             summation_domain,
             input_variable_dim,
-            matrices);
+            matrices,
+            lagrange_coefficients_cache);
     }
 }
 
@@ -247,7 +271,7 @@ void multi_lincheck<FieldT>::submit_sumcheck_masking_polynomials()
 template<typename FieldT>
 void multi_lincheck<FieldT>::calculate_and_submit_proof()
 {
-    libff::enter_block("multi_lincheck: Calculate and submit proof");
+    LIBIOP_TRACE_BEGIN("multi_lincheck: Calculate and submit proof");
     for (size_t i = 0; i < this->params_.multi_lincheck_repetitions(); i++)
     {
         const FieldT alpha = this->IOP_.obtain_verifier_random_message(this->alpha_handles_[i])[0];
@@ -257,7 +281,7 @@ void multi_lincheck<FieldT>::calculate_and_submit_proof()
 
         this->sumchecks_[i]->calculate_and_submit_proof();
     }
-    libff::leave_block("multi_lincheck: Calculate and submit proof");
+    LIBIOP_TRACE_END("multi_lincheck: Calculate and submit proof");
 }
 
 template<typename FieldT>
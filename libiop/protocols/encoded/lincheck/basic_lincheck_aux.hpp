@@ -48,12 +48,14 @@ protected:
      *
      *  As we improve the additive FFT, the speedup of setting this flag to false should further increase.
      *
-     *  The flag cannot currently be set to true with everything working as-is.
-     *  In the code, there are code blocks with if(use_lagrange) that describe what should be done
-     *  in the lagrange case, however some of them require minor refactors to the interface.
+     *  The flag is set by passing a Lagrange cache over the summation domain to the constructor,
+     *  which multi_lincheck does when basic_lincheck_parameters::use_lagrange() is set.
+     *  The cache can be shared by all repetitions. In this mode set_challenge skips the IFFTs,
+     *  and queries are answered by barycentric interpolation of p_alpha_prime and p_alpha_ABC
+     *  from their evaluations over the summation domain.
     */
-    const bool use_lagrange_ = false;
-    std::vector<FieldT> alpha_powers_;
+    const bool use_lagrange_;
+    std::vector<FieldT> p_alpha_prime_evals_;
     std::vector<FieldT> p_alpha_ABC_evals_;
     std::shared_ptr<lagrange_cache<FieldT> > lagrange_coefficients_cache_;
 public:
@@ -63,16 +65,21 @@ public:
         const field_subset<FieldT> &variable_domain,
         const field_subset<FieldT> &summation_domain,
         const std::size_t input_variable_dim,
-        const std::vector<std::shared_ptr<sparse_matrix<FieldT> >> &matrices);
+        const std::vector<std::shared_ptr<sparse_matrix<FieldT> >> &matrices,
+        const std::shared_ptr<lagrange_cache<FieldT> > &lagrange_coefficients_cache = nullptr);
 
     void set_challenge(const FieldT &alpha, const std::vector<FieldT> r_Mz);
 
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
     virtual FieldT evaluation_at_point(
         const std::size_t evaluation_position,
         const FieldT evaluation_point,
         const std::vector<FieldT> &constituent_oracle_evaluations) const;
+    virtual temporary_vector<FieldT> evaluations_at_points(
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const temporary_vector<FieldT> &evaluation_points,
+        const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const;
 };
 
 } // libiop
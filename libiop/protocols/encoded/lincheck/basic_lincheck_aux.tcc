@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -7,23 +9,17 @@ multi_lincheck_virtual_oracle<FieldT>::multi_lincheck_virtual_oracle(
     const field_subset<FieldT> &variable_domain,
     const field_subset<FieldT> &summation_domain,
     const std::size_t input_variable_dim,
-    const std::vector<std::shared_ptr<sparse_matrix<FieldT> >> &matrices) :
+    const std::vector<std::shared_ptr<sparse_matrix<FieldT> >> &matrices,
+    const std::shared_ptr<lagrange_cache<FieldT> > &lagrange_coefficients_cache) :
     codeword_domain_(codeword_domain),
     constraint_domain_(constraint_domain),
     variable_domain_(variable_domain),
     summation_domain_(summation_domain),
     input_variable_dim_(input_variable_dim),
-    matrices_(matrices)
+    matrices_(matrices),
+    use_lagrange_(lagrange_coefficients_cache != nullptr),
+    lagrange_coefficients_cache_(lagrange_coefficients_cache)
 {
-    assert(this->use_lagrange_ == false);
-    // To use lagrange, the lagrange coefficients cache should be passed in as an argument,
-    // with caching set to true.
-    // This amortizes the lagrange coefficient calculation across all repetitions.
-    if (this->use_lagrange_)
-    {
-        std::shared_ptr<lagrange_cache<FieldT>> lagrange_coefficients_cache; /* passed in */
-        this->lagrange_coefficients_cache_ = lagrange_coefficients_cache;
-    }
 }
 
 template<typename FieldT>
@@ -34,7 +30,7 @@ void multi_lincheck_virtual_oracle<FieldT>::set_challenge(const FieldT &alpha, c
     }
     this->r_Mz_ = r_Mz;
 
-    libff::enter_block("multi_lincheck compute alpha powers");
+    LIBIOP_TRACE_BEGIN("multi_lincheck compute alpha powers");
     /** Set alpha powers */
     std::vector<FieldT> alpha_powers;
     alpha_powers.reserve(this->constraint_domain_.num_elements());
@@ -44,9 +40,9 @@ void multi_lincheck_virtual_oracle<FieldT>::set_challenge(const FieldT &alpha, c
         alpha_powers.emplace_back(cur);
         cur *= alpha;
     }
-    libff::leave_block("multi_lincheck compute alpha powers");
+    LIBIOP_TRACE_END("multi_lincheck compute alpha powers");
 
-    libff::enter_block("multi_lincheck compute p_alpha_prime");
+    LIBIOP_TRACE_BEGIN("multi_lincheck compute p_alpha_prime");
     /** This essentially places alpha powers into the correct spots,
      *  such that the zeroes when the |constraint domain| < summation domain
      *  are placed correctly. */
@@ -57,10 +53,10 @@ void multi_lincheck_virtual_oracle<FieldT>::set_challenge(const FieldT &alpha, c
             this->constraint_domain_.dimension(), i);
         p_alpha_prime_over_summation_domain[element_index] = alpha_powers[i];
     }
-    libff::leave_block("multi_lincheck compute p_alpha_prime");
+    LIBIOP_TRACE_END("multi_lincheck compute p_alpha_prime");
 
     /* Set p_alpha_ABC_evals */
-    libff::enter_block("multi_lincheck compute p_alpha_ABC");
+    LIBIOP_TRACE_BEGIN("multi_lincheck compute p_alpha_ABC");
     std::vector<FieldT> p_alpha_ABC_evals(
         this->summation_domain_.num_elements(), FieldT::zero());
     for (std::size_t m_index = 0; m_index < this->matrices_.size(); m_index++)
@@ -69,7 +65,7 @@ void multi_lincheck_virtual_oracle<FieldT>::set_challenge(const FieldT &alpha, c
         // M is cons_domain X var_domain
         for (std::size_t i = 0; i < this->constraint_domain_.num_elements(); i++)
         {
-            const linear_combination<FieldT> row = M->get_row(i);
+            const linear_combination<FieldT> &row = M->get_row(i);
 
             for (auto &term : row.terms)
             {
@@ -83,47 +79,62 @@ void multi_lincheck_virtual_oracle<FieldT>::set_challenge(const FieldT &alpha, c
             }
         }
     }
-    libff::leave_block("multi_lincheck compute p_alpha_ABC");
-    // To use lagrange, the following IFFTs must also be moved to evaluated contents
+    LIBIOP_TRACE_END("multi_lincheck compute p_alpha_ABC");
     if (this->use_lagrange_)
     {
-        this->alpha_powers_ = alpha_powers;
-        this->p_alpha_ABC_evals_ = p_alpha_ABC_evals;
+        /* The IFFTs are only needed by the prover, so evaluated_contents does them */
+        this->p_alpha_prime_evals_ = std::move(p_alpha_prime_over_summation_domain);
+        this->p_alpha_ABC_evals_ = std::move(p_alpha_ABC_evals);
+        return;
     }
-    libff::enter_block("multi_lincheck IFFT p_alphas");
+    LIBIOP_TRACE_BEGIN("multi_lincheck IFFT p_alphas");
     this->p_alpha_ABC_ = polynomial<FieldT>(
         IFFT_over_field_subset<FieldT>(p_alpha_ABC_evals, this->summation_domain_));
     this->p_alpha_prime_ = polynomial<FieldT>(
         IFFT_over_field_subset<FieldT>(p_alpha_prime_over_summation_domain, this->summation_domain_));
-    libff::leave_block("multi_lincheck IFFT p_alphas");
+    LIBIOP_TRACE_END("multi_lincheck IFFT p_alphas");
 }
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> multi_lincheck_virtual_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
-    libff::enter_block("multi_lincheck evaluated contents");
+    LIBIOP_TRACE_BEGIN("multi_lincheck evaluated contents");
     if (constituent_oracle_evaluations.size() != this->matrices_.size() + 1)
     {
         throw std::invalid_argument("multi_lincheck uses more constituent oracles than what was provided.");
     }
 
+    std::vector<FieldT> p_alpha_prime_coefficients;
+    std::vector<FieldT> p_alpha_ABC_coefficients;
+    if (this->use_lagrange_)
+    {
+        p_alpha_prime_coefficients =
+            IFFT_over_field_subset<FieldT>(this->p_alpha_prime_evals_, this->summation_domain_);
+        p_alpha_ABC_coefficients =
+            IFFT_over_field_subset<FieldT>(this->p_alpha_ABC_evals_, this->summation_domain_);
+    }
+    const std::vector<FieldT> &p_alpha_prime_coeffs = this->use_lagrange_ ?
+        p_alpha_prime_coefficients : this->p_alpha_prime_.coefficients();
+    const std::vector<FieldT> &p_alpha_ABC_coeffs = this->use_lagrange_ ?
+        p_alpha_ABC_coefficients : this->p_alpha_ABC_.coefficients();
+
     /* p_{alpha}^1 in [BCRSVW18] */
     std::vector<FieldT> p_alpha_prime_over_codeword_domain =
-        FFT_over_field_subset<FieldT>(this->p_alpha_prime_.coefficients(), this->codeword_domain_);
+        FFT_over_field_subset<FieldT>(p_alpha_prime_coeffs, this->codeword_domain_);
 
     /* p_{alpha}^2 in [BCRSVW18] */
     const std::vector<FieldT> p_alpha_ABC_over_codeword_domain =
-        FFT_over_field_subset<FieldT>(this->p_alpha_ABC_.coefficients(), this->codeword_domain_);
+        FFT_over_field_subset<FieldT>(p_alpha_ABC_coeffs, this->codeword_domain_);
 
     const std::size_t n = this->codeword_domain_.num_elements();
 
-    const std::shared_ptr<std::vector<FieldT>> &fz = constituent_oracle_evaluations[0];
+    const shared_buffer<FieldT> &fz = constituent_oracle_evaluations[0];
     /* Random linear combination of Mz's */
     std::vector<FieldT> f_combined_Mz(n, FieldT::zero());
     for (std::size_t i = 0; i < n; i++) {
         for (std::size_t m = 0; m < this->matrices_.size(); m++) {
-            f_combined_Mz[i] += this->r_Mz_[m] * constituent_oracle_evaluations[m + 1]->operator[](i);
+            f_combined_Mz[i] += this->r_Mz_[m] * constituent_oracle_evaluations[m + 1][i];
         }
     }
 
@@ -137,9 +148,9 @@ std::shared_ptr<std::vector<FieldT>> multi_lincheck_virtual_oracle<FieldT>::eval
     {
         result->emplace_back(
             f_combined_Mz[i] * p_alpha_prime_over_codeword_domain[i] -
-            fz->operator[](i) * p_alpha_ABC_over_codeword_domain[i]);
+            fz[i] * p_alpha_ABC_over_codeword_domain[i]);
     }
-    libff::leave_block("multi_lincheck evaluated contents");
+    LIBIOP_TRACE_END("multi_lincheck evaluated contents");
     return result;
 }
 
@@ -155,22 +166,20 @@ FieldT multi_lincheck_virtual_oracle<FieldT>::evaluation_at_point(
         throw std::invalid_argument("multi_lincheck uses more constituent oracles than what was provided.");
     }
 
-    FieldT p_alpha_prime_X = this->p_alpha_prime_.evaluation_at_point(evaluation_point);
-    FieldT p_alpha_ABC_X = this->p_alpha_ABC_.evaluation_at_point(evaluation_point);
+    FieldT p_alpha_prime_X;
+    FieldT p_alpha_ABC_X;
     if (this->use_lagrange_)
     {
-        const std::vector<FieldT> lagrange_coefficients =
-            this->lagrange_coefficients_cache_->coefficients_for(evaluation_point);
-        for (size_t i = 0; i < this->constraint_domain_.num_elements(); ++i)
-        {
-            const std::size_t summation_index = this->summation_domain_.reindex_by_subset(
-                this->constraint_domain_.dimension(), i);
-            p_alpha_prime_X += lagrange_coefficients[summation_index] * this->alpha_powers_[i];
-        }
-        for (std::size_t i = 0; i < this->summation_domain_.num_elements(); ++i)
-        {
-            p_alpha_ABC_X += lagrange_coefficients[i] * this->p_alpha_ABC_evals_[i];
-        }
+        const std::vector<std::vector<FieldT>> p_alphas_X =
+            this->lagrange_coefficients_cache_->interpolate_at_points(
+                { this->p_alpha_prime_evals_, this->p_alpha_ABC_evals_ }, { evaluation_point });
+        p_alpha_prime_X = p_alphas_X[0][0];
+        p_alpha_ABC_X = p_alphas_X[1][0];
+    }
+    else
+    {
+        p_alpha_prime_X = this->p_alpha_prime_.evaluation_at_point(evaluation_point);
+        p_alpha_ABC_X = this->p_alpha_ABC_.evaluation_at_point(evaluation_point);
     }
 
     const FieldT &fz_X = constituent_oracle_evaluations[0];
@@ -182,4 +191,46 @@ FieldT multi_lincheck_virtual_oracle<FieldT>::evaluation_at_point(
     return (f_combined_Mz_x * p_alpha_prime_X - fz_X * p_alpha_ABC_X);
 }
 
+template<typename FieldT>
+temporary_vector<FieldT> multi_lincheck_virtual_oracle<FieldT>::evaluations_at_points(
+    const temporary_vector<std::size_t> &evaluation_positions,
+    const temporary_vector<FieldT> &evaluation_points,
+    const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+{
+    libff::UNUSED(evaluation_positions);
+    if (constituent_oracle_evaluations.size() != this->matrices_.size() + 1)
+    {
+        throw std::invalid_argument("multi_lincheck uses more constituent oracles than what was provided.");
+    }
+
+    /* Both polynomials have degree about |H|, so this is where the time goes */
+    temporary_vector<FieldT> p_alpha_prime_X(temporary_resource());
+    temporary_vector<FieldT> p_alpha_ABC_X(temporary_resource());
+    if (this->use_lagrange_)
+    {
+        const std::vector<std::vector<FieldT>> p_alphas_X =
+            this->lagrange_coefficients_cache_->interpolate_at_points(
+                { this->p_alpha_prime_evals_, this->p_alpha_ABC_evals_ }, evaluation_points);
+        p_alpha_prime_X.assign(p_alphas_X[0].begin(), p_alphas_X[0].end());
+        p_alpha_ABC_X.assign(p_alphas_X[1].begin(), p_alphas_X[1].end());
+    }
+    else
+    {
+        p_alpha_prime_X = this->p_alpha_prime_.evaluations_at_points(evaluation_points);
+        p_alpha_ABC_X = this->p_alpha_ABC_.evaluations_at_points(evaluation_points);
+    }
+
+    const temporary_vector<FieldT> &fz_X = constituent_oracle_evaluations[0];
+    temporary_vector<FieldT> result(evaluation_points.size(), temporary_resource());
+    for (std::size_t j = 0; j < evaluation_points.size(); ++j)
+    {
+        FieldT f_combined_Mz_x = FieldT::zero();
+        for (std::size_t i = 0; i < this->r_Mz_.size(); i++) {
+            f_combined_Mz_x += this->r_Mz_[i] * constituent_oracle_evaluations[i + 1][j];
+        }
+        result[j] = f_combined_Mz_x * p_alpha_prime_X[j] - fz_X[j] * p_alpha_ABC_X[j];
+    }
+    return result;
+}
+
 } // libiop
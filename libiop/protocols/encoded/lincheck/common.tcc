@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -16,7 +18,7 @@ std::vector<FieldT> compute_p_alpha_M(
         // M is cons_domain X var_domain
         for (std::size_t i = 0; i < summation_domain.num_elements(); i++)
         {
-            const linear_combination<FieldT> row = M->get_row(i);
+            const linear_combination<FieldT> &row = M->get_row(i);
 
             for (auto &term : row.terms)
             {
@@ -28,10 +30,10 @@ std::vector<FieldT> compute_p_alpha_M(
             }
         }
     }
-    libff::enter_block("multi_lincheck IFFT p_alpha_M");
+    LIBIOP_TRACE_BEGIN("multi_lincheck IFFT p_alpha_M");
     std::vector<FieldT> p_alpha_M =
         IFFT_over_field_subset<FieldT>(p_alpha_M_over_H, summation_domain);
-    libff::leave_block("multi_lincheck IFFT p_alpha_M");
+    LIBIOP_TRACE_END("multi_lincheck IFFT p_alpha_M");
     return p_alpha_M;
 }
 
@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -389,7 +391,7 @@ void holographic_multi_lincheck<FieldT>::calculate_response_alpha()
     this->p_alpha_M_poly_.resize(this->params_.num_repetitions());
     for (size_t repetition = 0; repetition < this->params_.num_repetitions(); repetition++)
     {
-        libff::enter_block("Calculate alpha_summation_oracle");
+        LIBIOP_TRACE_BEGIN("Calculate alpha_summation_oracle");
         const FieldT alpha = this->IOP_.obtain_verifier_random_message(this->alpha_handle_[repetition])[0];
         this->r_Mz_[repetition] = this->IOP_.obtain_verifier_random_message(this->random_coefficient_handle_[repetition]);
         /** Unnormalized,
@@ -401,21 +403,21 @@ void holographic_multi_lincheck<FieldT>::calculate_response_alpha()
         this->p_alpha_over_H_[repetition] =
             this->p_alpha_[repetition].evaluations_over_field_subset(this->summation_domain_);
 
-        libff::enter_block("multi_lincheck compute p_alpha_M");
+        LIBIOP_TRACE_BEGIN("multi_lincheck compute p_alpha_M");
         std::vector<FieldT> p_alpha_M = compute_p_alpha_M(
             this->input_variable_dim_, this->summation_domain_,
             this->p_alpha_over_H_[repetition], this->r_Mz_[repetition],
             this->matrices_);
         std::vector<FieldT> p_alpha_M_over_L =
             FFT_over_field_subset<FieldT>(p_alpha_M, this->codeword_domain_);
-        libff::leave_block("multi_lincheck compute p_alpha_M");
+        LIBIOP_TRACE_END("multi_lincheck compute p_alpha_M");
         /* t is the provers alleged commitment to p_alpha_M */
         this->IOP_.submit_oracle(this->t_oracle_handle_[repetition], std::move(p_alpha_M_over_L));
         this->p_alpha_M_poly_[repetition] = polynomial<FieldT>(std::move(p_alpha_M));
 
         this->multi_lincheck_virtual_oracle_[repetition]->set_challenge(alpha, this->r_Mz_[repetition]);
 
-        libff::leave_block("Calculate alpha_summation_oracle");
+        LIBIOP_TRACE_END("Calculate alpha_summation_oracle");
     }
 }
 
@@ -440,14 +442,14 @@ void holographic_multi_lincheck<FieldT>::calculate_response_beta()
 
     for (size_t repetition = 0; repetition < this->params_.num_repetitions(); repetition++)
     {
-        libff::enter_block("Calculate beta_summation_oracle");
+        LIBIOP_TRACE_BEGIN("Calculate beta_summation_oracle");
         const FieldT beta = this->IOP_.obtain_verifier_random_message(
             this->beta_handle_[repetition])[0];
         /** We have to compute the combined rational function over K,
          *  to pass into rational sumcheck.    */
         std::vector<std::shared_ptr<std::vector<FieldT>>> numerator_oracles_over_K;
         std::vector<std::shared_ptr<std::vector<FieldT>>> denominator_oracles_over_K;
-        libff::enter_block("Compute rational function over K");
+        LIBIOP_TRACE_BEGIN("Compute rational function over K");
         for (size_t i = 0; i < this->num_matrices_; i++)
         {
             /** TODO: Also index evals over K instead of Re-IFFTing here */
@@ -469,7 +471,7 @@ void holographic_multi_lincheck<FieldT>::calculate_response_beta()
         std::vector<FieldT> combined_rational_over_K =
             this->rational_linear_combination_[repetition]->evaluated_contents(
                 numerator_oracles_over_K, denominator_oracles_over_K);
-        libff::leave_block("Compute rational function over K");
+        LIBIOP_TRACE_END("Compute rational function over K");
 
         this->sumcheck_K_[repetition]->calculate_and_submit_proof(combined_rational_over_K);
         const FieldT M_at_alpha_beta = this->sumcheck_K_[repetition]->get_claimed_sum();
@@ -479,7 +481,7 @@ void holographic_multi_lincheck<FieldT>::calculate_response_beta()
 
         this->sumcheck_H_[repetition]->calculate_and_submit_proof();
 
-        libff::leave_block("Calculate beta_summation_oracle");
+        LIBIOP_TRACE_END("Calculate beta_summation_oracle");
     }
 }
 
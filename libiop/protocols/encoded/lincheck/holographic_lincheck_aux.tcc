@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -21,17 +23,17 @@ void holographic_multi_lincheck_virtual_oracle<FieldT>::set_challenge(const Fiel
     }
     this->r_Mz_ = r_Mz;
 
-    libff::enter_block("multi_lincheck construct p_alpha_prime");
+    LIBIOP_TRACE_BEGIN("multi_lincheck construct p_alpha_prime");
     const bool normalized = false;
     this->p_alpha_prime_ = lagrange_polynomial<FieldT>(alpha, this->summation_domain_, normalized);
-    libff::leave_block("multi_lincheck construct p_alpha_prime");
+    LIBIOP_TRACE_END("multi_lincheck construct p_alpha_prime");
 }
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> holographic_multi_lincheck_virtual_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
-    libff::enter_block("multi_lincheck evaluated contents");
+    LIBIOP_TRACE_BEGIN("multi_lincheck evaluated contents");
     if (constituent_oracle_evaluations.size() != this->matrices_.size() + 2)
     {
         throw std::invalid_argument("multi_lincheck uses more constituent oracles than what was provided.");
@@ -43,12 +45,12 @@ std::shared_ptr<std::vector<FieldT>> holographic_multi_lincheck_virtual_oracle<F
 
     const std::size_t n = this->codeword_domain_.num_elements();
 
-    const std::shared_ptr<std::vector<FieldT>> &fz = constituent_oracle_evaluations[0];
+    const shared_buffer<FieldT> &fz = constituent_oracle_evaluations[0];
     /* Random linear combination of Mz's */
     std::vector<FieldT> f_combined_Mz(n, FieldT::zero());
     for (std::size_t i = 0; i < n; i++) {
         for (std::size_t m = 0; m < this->matrices_.size(); m++) {
-            f_combined_Mz[i] += this->r_Mz_[m] * constituent_oracle_evaluations[m + 1]->operator[](i);
+            f_combined_Mz[i] += this->r_Mz_[m] * constituent_oracle_evaluations[m + 1][i];
         }
     }
 
@@ -59,9 +61,9 @@ std::shared_ptr<std::vector<FieldT>> holographic_multi_lincheck_virtual_oracle<F
     {
         result->emplace_back(
             f_combined_Mz[i] * p_alpha_prime_over_codeword_domain[i] -
-            fz->operator[](i) * constituent_oracle_evaluations[p_alpha_M_index]->operator[](i));
+            fz[i] * constituent_oracle_evaluations[p_alpha_M_index][i]);
     }
-    libff::leave_block("multi_lincheck evaluated contents");
+    LIBIOP_TRACE_END("multi_lincheck evaluated contents");
     return result;
 }
 
@@ -114,13 +116,13 @@ void single_matrix_denominator<FieldT>::set_challenge(
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> single_matrix_denominator<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != 3)
     {
         throw std::invalid_argument("single_matrix_denominator was expecting row, col, row*col oracles as input");
     }
-    const size_t n = constituent_oracle_evaluations[0]->size();
+    const size_t n = constituent_oracle_evaluations[0].size();
     std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>();
     result->reserve(n);
     FieldT row_query_pt_times_col_query_pt = this->row_query_point_ * this->column_query_point_;
@@ -129,9 +131,9 @@ std::shared_ptr<std::vector<FieldT>> single_matrix_denominator<FieldT>::evaluate
     for (size_t i = 0; i < n; i++)
     {
         const FieldT eval = (
-            (-this->column_query_point_ * constituent_oracle_evaluations[0]->operator[](i))
-            - (this->row_query_point_ * constituent_oracle_evaluations[1]->operator[](i))
-            + constituent_oracle_evaluations[2]->operator[](i)
+            (-this->column_query_point_ * constituent_oracle_evaluations[0][i])
+            - (this->row_query_point_ * constituent_oracle_evaluations[1][i])
+            + constituent_oracle_evaluations[2][i]
             + row_query_pt_times_col_query_pt);
         result->emplace_back(eval);
     }
@@ -54,6 +54,8 @@ protected:
     oracle_handle row_times_col_oracle_handle_;
 
     bivariate_lagrange_polynomial<FieldT> bivariate_lagrange_poly_;
+    /* 1 / u_H(h, h) for every h in H. This only depends on H, so it is shared between matrices. */
+    std::shared_ptr<std::vector<FieldT>> lagrange_derivative_inverses_;
 public:
     /* Initialization and registration */
     matrix_indexer(iop_protocol<FieldT> &IOP,
@@ -70,13 +72,29 @@ public:
     oracle_handle get_val_oracle_handle() const;
     oracle_handle get_row_times_col_oracle_handle() const;
 
+    void set_lagrange_derivative_inverses(
+        const std::shared_ptr<std::vector<FieldT>> &lagrange_derivative_inverses);
+
     /* Ran in the indexer */
     std::vector<std::vector<FieldT>> compute_oracles_over_K();
-    void compute_oracles();
+    /** Low degree extends an index oracle from K to the codeword domain.
+     *  This only reads state of the indexer, so it can be run concurrently. */
+    std::vector<FieldT> extend_oracle_to_codeword_domain(const std::vector<FieldT> &evals_over_K) const;
+    /** Submits the row, col, val and row * col oracles over the codeword domain, in that order */
+    void submit_oracles(std::vector<std::vector<FieldT>> &&oracles_over_codeword_domain);
+    /** Computes and submits the index oracles of all the given matrices, which share a matrix domain.
+     *  The matrices are indexed concurrently: each matrix's oracles over K are computed,
+     *  then all of their low degree extensions are done as independent jobs.
+     *  Submission to the IOP is done serially afterwards, in the order of the matrices. */
+    static void compute_oracles(const std::vector<matrix_indexer<FieldT>*> &matrix_indexers);
 
     std::vector<oracle_handle_ptr> get_all_oracle_handles() const;
 };
 
+/** Returns 1 / u_H(h, h) for every h in H, in the order of H's elements. */
+template<typename FieldT>
+std::vector<FieldT> lagrange_derivative_inverses(const field_subset<FieldT> &H);
+
 } // namespace libiop
 
 #include "libiop/protocols/encoded/r1cs_rs_iop/fractal_indexer.tcc"
@@ -2,6 +2,7 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/utils.hpp"
 #include "libiop/algebra/polynomials/polynomial.hpp"
@@ -49,6 +50,29 @@ void matrix_indexer<FieldT>::register_oracles()
             this->codeword_domain_handle_, oracle_degree_bound);
 }
 
+template<typename FieldT>
+void matrix_indexer<FieldT>::set_lagrange_derivative_inverses(
+    const std::shared_ptr<std::vector<FieldT>> &lagrange_derivative_inverses)
+{
+    this->lagrange_derivative_inverses_ = lagrange_derivative_inverses;
+}
+
+template<typename FieldT>
+std::vector<FieldT> lagrange_derivative_inverses(const field_subset<FieldT> &H)
+{
+    const bivariate_lagrange_polynomial<FieldT> bivariate_lagrange_poly(H);
+    const std::vector<FieldT> H_elems = H.all_elements();
+    std::vector<FieldT> derivatives(H_elems.size());
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < H_elems.size(); i++)
+    {
+        derivatives[i] = bivariate_lagrange_poly.evaluation_at_point(H_elems[i], H_elems[i]);
+    }
+    return batch_inverse(derivatives);
+}
+
 template<typename FieldT>
 std::vector<std::vector<FieldT>> matrix_indexer<FieldT>::compute_oracles_over_K()
 {
@@ -69,6 +93,12 @@ std::vector<std::vector<FieldT>> matrix_indexer<FieldT>::compute_oracles_over_K(
      *  So we index val_M'(k) directly */
     this->bivariate_lagrange_poly_ =
         bivariate_lagrange_polynomial<FieldT>(this->matrix_domain_);
+    if (!this->lagrange_derivative_inverses_)
+    {
+        this->lagrange_derivative_inverses_ = std::make_shared<std::vector<FieldT>>(
+            lagrange_derivative_inverses<FieldT>(this->matrix_domain_));
+    }
+    const std::vector<FieldT> &col_derivative_inverses = *this->lagrange_derivative_inverses_;
     /** evaluations over K */
     std::vector<FieldT> row_evals;
     std::vector<FieldT> col_evals;
@@ -82,7 +112,7 @@ std::vector<std::vector<FieldT>> matrix_indexer<FieldT>::compute_oracles_over_K(
     std::size_t num_nonzero_cnt = 0;
     for (size_t i = 0; i < this->matrix_->num_rows(); i++)
     {
-        const linear_combination<FieldT> row = this->matrix_->get_row(i);
+        const linear_combination<FieldT> &row = this->matrix_->get_row(i);
         const FieldT row_index_elem = this->matrix_domain_.element_by_index(i);
 
         for (auto &term : row.terms)
@@ -95,9 +125,7 @@ std::vector<std::vector<FieldT>> matrix_indexer<FieldT>::compute_oracles_over_K(
             col_evals.emplace_back(col_index_elem);
             row_times_col_evals.emplace_back(row_index_elem * col_index_elem);
 
-            const FieldT col_derivative =
-                this->bivariate_lagrange_poly_.evaluation_at_point(col_index_elem, col_index_elem);
-            const FieldT val_eval = term.coeff_ * col_derivative.inverse();
+            const FieldT val_eval = term.coeff_ * col_derivative_inverses[col_index];
             val_evals.emplace_back(val_eval);
         }
     }
@@ -121,38 +149,71 @@ std::vector<std::vector<FieldT>> matrix_indexer<FieldT>::compute_oracles_over_K(
 }
 
 template<typename FieldT>
-void matrix_indexer<FieldT>::compute_oracles()
+std::vector<FieldT> matrix_indexer<FieldT>::extend_oracle_to_codeword_domain(
+    const std::vector<FieldT> &evals_over_K) const
+{
+    return FFT_over_field_subset<FieldT>(
+        IFFT_over_field_subset<FieldT>(evals_over_K, this->index_domain_),
+        this->codeword_domain_);
+}
+
+template<typename FieldT>
+void matrix_indexer<FieldT>::submit_oracles(
+    std::vector<std::vector<FieldT>> &&oracles_over_codeword_domain)
+{
+    this->IOP_.submit_oracle(this->row_oracle_handle_, std::move(oracles_over_codeword_domain[0]));
+    this->IOP_.submit_oracle(this->col_oracle_handle_, std::move(oracles_over_codeword_domain[1]));
+    this->IOP_.submit_oracle(this->row_times_col_oracle_handle_, std::move(oracles_over_codeword_domain[3]));
+    this->IOP_.submit_oracle(this->val_oracle_handle_, std::move(oracles_over_codeword_domain[2]));
+}
+
+template<typename FieldT>
+void matrix_indexer<FieldT>::compute_oracles(const std::vector<matrix_indexer<FieldT>*> &matrix_indexers)
 {
-    std::vector<std::vector<FieldT>> index_oracles_over_K = this->compute_oracles_over_K();
-    /** TODO: Handle domain conversion in another function
-     *  to reduce memory overhead and code duplication.*/
-    const std::vector<FieldT> row_poly_over_codeword_domain
-        = FFT_over_field_subset<FieldT>(
-            IFFT_over_field_subset<FieldT>(
-                index_oracles_over_K[0], this->index_domain_),
-            this->codeword_domain_);
-    this->IOP_.submit_oracle(this->row_oracle_handle_, row_poly_over_codeword_domain);
-
-    const std::vector<FieldT> col_poly_over_codeword_domain
-        = FFT_over_field_subset<FieldT>(
-            IFFT_over_field_subset<FieldT>(
-                index_oracles_over_K[1], this->index_domain_),
-            this->codeword_domain_);
-    this->IOP_.submit_oracle(this->col_oracle_handle_, col_poly_over_codeword_domain);
-
-    const std::vector<FieldT> row_times_col_poly_over_codeword_domain
-        = FFT_over_field_subset<FieldT>(
-            IFFT_over_field_subset<FieldT>(
-                index_oracles_over_K[3], this->index_domain_),
-            this->codeword_domain_);
-    this->IOP_.submit_oracle(this->row_times_col_oracle_handle_, row_times_col_poly_over_codeword_domain);
-
-    const std::vector<FieldT> val_poly_over_codeword_domain
-        = FFT_over_field_subset<FieldT>(
-            IFFT_over_field_subset<FieldT>(
-                index_oracles_over_K[2], this->index_domain_),
-            this->codeword_domain_);
-    this->IOP_.submit_oracle(this->val_oracle_handle_, val_poly_over_codeword_domain);
+    const size_t num_matrices = matrix_indexers.size();
+    const size_t num_oracles_per_matrix = 4;
+    if (num_matrices == 0)
+    {
+        return;
+    }
+
+    LIBIOP_TRACE_BEGIN("Compute index oracles over K");
+    const std::shared_ptr<std::vector<FieldT>> derivative_inverses =
+        std::make_shared<std::vector<FieldT>>(lagrange_derivative_inverses<FieldT>(
+            matrix_indexers[0]->matrix_domain_));
+    std::vector<std::vector<std::vector<FieldT>>> oracles_over_K(num_matrices);
+#ifdef MULTICORE
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_matrices; i++)
+    {
+        matrix_indexers[i]->set_lagrange_derivative_inverses(derivative_inverses);
+        oracles_over_K[i] = matrix_indexers[i]->compute_oracles_over_K();
+    }
+    LIBIOP_TRACE_END("Compute index oracles over K");
+
+    /* Multiplicative matrices share their codeword domain's FFT cache,
+       whose fill on first use is synchronized, see multiplicative_subgroup_base::fft_cache */
+    LIBIOP_TRACE_BEGIN("Extend index oracles to codeword domain");
+    std::vector<std::vector<std::vector<FieldT>>> oracles_over_codeword_domain(
+        num_matrices, std::vector<std::vector<FieldT>>(num_oracles_per_matrix));
+#ifdef MULTICORE
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_t job = 0; job < num_matrices * num_oracles_per_matrix; job++)
+    {
+        const size_t i = job / num_oracles_per_matrix;
+        const size_t j = job % num_oracles_per_matrix;
+        oracles_over_codeword_domain[i][j] =
+            matrix_indexers[i]->extend_oracle_to_codeword_domain(oracles_over_K[i][j]);
+        std::vector<FieldT>().swap(oracles_over_K[i][j]);
+    }
+    LIBIOP_TRACE_END("Extend index oracles to codeword domain");
+
+    for (size_t i = 0; i < num_matrices; i++)
+    {
+        matrix_indexers[i]->submit_oracles(std::move(oracles_over_codeword_domain[i]));
+    }
 }
 
 template<typename FieldT>
@@ -1,9 +1,11 @@
 #include <cmath>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/lagrange.hpp"
+#include "libiop/algebra/low_degree_extension.hpp"
 #include "libiop/algebra/polynomials/polynomial.hpp"
 #include "libiop/algebra/polynomials/vanishing_polynomial.hpp"
 #include "libiop/algebra/utils.hpp"
@@ -179,9 +181,9 @@ public:
     }
 
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
     {
-        libff::enter_block("fz evaluated contents");
+        LIBIOP_TRACE_BEGIN("fz evaluated contents");
         if (constituent_oracle_evaluations.size() != 1)
         {
             throw std::invalid_argument("fz_virtual_oracle has one constituent oracle.");
@@ -192,9 +194,9 @@ public:
             throw std::logic_error("Evaluation requested before primary_input is set.");
         }
 
-        const std::shared_ptr<std::vector<FieldT>> &fw = constituent_oracle_evaluations[0];
+        const shared_buffer<FieldT> &fw = constituent_oracle_evaluations[0];
 
-        if (fw->size() != this->codeword_domain_.num_elements())
+        if (fw.size() != this->codeword_domain_.num_elements())
         {
             throw std::invalid_argument("Provided fw evaluations don't match the declared codeword domain size.");
         }
@@ -207,10 +209,8 @@ public:
         std::vector<FieldT> f_1v_evaluations({ FieldT::one() });
         f_1v_evaluations.insert(f_1v_evaluations.end(),
                                 this->primary_input_.begin(), this->primary_input_.end());
-        std::vector<FieldT> f_1v_coefficients =
-            IFFT_over_field_subset<FieldT>(f_1v_evaluations, this->input_variable_domain_);
-        const std::vector<FieldT> f_1v_over_codeword_domain =
-            FFT_over_field_subset<FieldT>(f_1v_coefficients, this->codeword_domain_);
+        const std::vector<FieldT> f_1v_over_codeword_domain = low_degree_extend<FieldT>(
+            f_1v_evaluations, this->input_variable_domain_, this->codeword_domain_);
 
         /* TODO: Initialize result to f_1v_over_codeword_domain */
         std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>();
@@ -218,9 +218,9 @@ public:
         for (std::size_t i = 0; i < this->codeword_domain_.num_elements(); ++i)
         {
             result->emplace_back(
-                fw->operator[](i) * input_vp_over_codeword_domain[i] + f_1v_over_codeword_domain[i]);
+                fw[i] * input_vp_over_codeword_domain[i] + f_1v_over_codeword_domain[i]);
         }
-        libff::leave_block("fz evaluated contents");
+        LIBIOP_TRACE_END("fz evaluated contents");
 
         return result;
     }
@@ -255,6 +255,40 @@ public:
 
         return fw_X * input_vp_X + f1v_X;
     }
+
+    virtual temporary_vector<FieldT> evaluations_at_points(
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const temporary_vector<FieldT> &evaluation_points,
+        const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+    {
+        libff::UNUSED(evaluation_positions);
+
+        if (constituent_oracle_evaluations.size() != 1)
+        {
+            throw std::invalid_argument("fz_virtual_oracle has one constituent oracle.");
+        }
+
+        if (this->primary_input_.size() != this->primary_input_size_)
+        {
+            throw std::logic_error("Evaluation requested before primary_input is set.");
+        }
+
+        /* f_{1,v} at every point by barycentric interpolation, sharing one batch inversion */
+        std::vector<FieldT> f_1v_evaluations({ FieldT::one() });
+        f_1v_evaluations.insert(f_1v_evaluations.end(),
+                                this->primary_input_.begin(), this->primary_input_.end());
+        const std::vector<FieldT> f1v_X = this->L_X_for_input_domain_->interpolate_at_points(
+            { f_1v_evaluations }, evaluation_points)[0];
+
+        const vanishing_polynomial<FieldT> input_vp(this->input_variable_domain_);
+        const temporary_vector<FieldT> &fw_X = constituent_oracle_evaluations[0];
+        temporary_vector<FieldT> result(evaluation_points.size(), temporary_resource());
+        for (std::size_t i = 0; i < evaluation_points.size(); ++i)
+        {
+            result[i] = fw_X[i] * input_vp.evaluation_at_point(evaluation_points[i]) + f1v_X[i];
+        }
+        return result;
+    }
 };
 
 template<typename FieldT>
@@ -453,29 +487,18 @@ void encoded_aurora_protocol<FieldT>::compute_fprime_ABCz_over_codeword_domain(
      *  over the codeword domain. The same is done for Bz, and Cz.
      *
      *  These matrices may be randomized due to fz' randomness from f_w in the zk case.
+     *  In that case constraint_vp * R_A/B/Cz is added to each of the polynomials,
+     *  which low_degree_extend does in the same pass as the extension.
      */
-
-    polynomial<FieldT> f_Az(std::move(
-            IFFT_over_field_subset<FieldT>(Az, this->constraint_domain_)));
-    polynomial<FieldT> f_Bz(std::move(
-            IFFT_over_field_subset<FieldT>(Bz, this->constraint_domain_)));
-    polynomial<FieldT> f_Cz(std::move(
-            IFFT_over_field_subset<FieldT>(Cz, this->constraint_domain_)));
-
-    if (this->params_.make_zk()) {
-        // Add constraint_vp * R_A/B/Cz to each of the polynomials
-        const vanishing_polynomial<FieldT> constraint_vp(this->constraint_domain_);
-        f_Az += constraint_vp * this->R_Az_;
-        f_Bz += constraint_vp * this->R_Bz_;
-        f_Cz += constraint_vp * this->R_Cz_;
-    }
-
-    this->fprime_Az_over_codeword_domain_ =
-        FFT_over_field_subset<FieldT>(f_Az.coefficients(), this->codeword_domain_);
-    this->fprime_Bz_over_codeword_domain_=
-        FFT_over_field_subset<FieldT>(f_Bz.coefficients(), this->codeword_domain_);
-    this->fprime_Cz_over_codeword_domain_ =
-        FFT_over_field_subset<FieldT>(f_Cz.coefficients(), this->codeword_domain_);
+    const polynomial<FieldT> no_mask;
+    const bool zk = this->params_.make_zk();
+
+    this->fprime_Az_over_codeword_domain_ = low_degree_extend<FieldT>(
+        Az, this->constraint_domain_, this->codeword_domain_, zk ? this->R_Az_ : no_mask);
+    this->fprime_Bz_over_codeword_domain_ = low_degree_extend<FieldT>(
+        Bz, this->constraint_domain_, this->codeword_domain_, zk ? this->R_Bz_ : no_mask);
+    this->fprime_Cz_over_codeword_domain_ = low_degree_extend<FieldT>(
+        Cz, this->constraint_domain_, this->codeword_domain_, zk ? this->R_Cz_ : no_mask);
 }
 
 template<typename FieldT>
@@ -485,7 +508,7 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
 {
     this->fz_oracle_->set_primary_input(primary_input);
 
-    libff::enter_block("Submit witness oracles");
+    LIBIOP_TRACE_BEGIN("Submit witness oracles");
     if (this->params_.holographic())
     {
         this->holographic_multi_lincheck_->submit_sumcheck_masking_polynomials();
@@ -495,7 +518,7 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
         this->multi_lincheck_->submit_sumcheck_masking_polynomials();
     }
 
-    libff::enter_block("Compute randomized f_w");
+    LIBIOP_TRACE_BEGIN("Compute randomized f_w");
     /* Randomization polynomials for the top-level R1CS protocol */
     if (this->params_.make_zk()) {
         this->R_Az_ = polynomial<FieldT>::random_polynomial(this->params_.query_bound());
@@ -567,7 +590,7 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
     this->fw_over_codeword_domain_ =
         FFT_over_field_subset<FieldT>(fw_prime.coefficients(), this->codeword_domain_);
 
-    libff::leave_block("Compute randomized f_w");
+    LIBIOP_TRACE_END("Compute randomized f_w");
 
     /**  2) Calculate f_{Az}, f_{Bz}, f_{Cz} over the constraint domain
      *   i)   Construct z, and compute Az, Bz, Cz
@@ -575,7 +598,7 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
      *   iii) Adds Z_{constraint domain} * R_{A/B/Cz} to each of the corresponding codewords
      *   iv)  FFT this into the codeword domain
     */
-    libff::enter_block("Compute A/B/Cz");
+    LIBIOP_TRACE_BEGIN("Compute A/B/Cz");
 
     std::vector<FieldT> variable_assignment({ FieldT::one() });
     variable_assignment.insert(variable_assignment.end(),
@@ -592,14 +615,14 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
     this->constraint_system_->create_Az_Bz_Cz_from_variable_assignment(
         variable_assignment, Az, Bz, Cz);
 
-    libff::leave_block("Compute A/B/Cz");
+    LIBIOP_TRACE_END("Compute A/B/Cz");
 
-    libff::enter_block("Compute f_{A/B/Cz} over codeword domain");
+    LIBIOP_TRACE_BEGIN("Compute f_{A/B/Cz} over codeword domain");
     this->compute_fprime_ABCz_over_codeword_domain(Az, Bz, Cz);
-    libff::leave_block("Compute f_{A/B/Cz} over codeword domain");
+    LIBIOP_TRACE_END("Compute f_{A/B/Cz} over codeword domain");
 
     /** 3) Submit all the oracles */
-    libff::enter_block("Call IOP oracle submission routines");
+    LIBIOP_TRACE_BEGIN("Call IOP oracle submission routines");
     this->IOP_.submit_oracle(this->fw_handle_, std::move(this->fw_over_codeword_domain_));
     this->IOP_.submit_oracle(this->fAz_handle_, std::move(this->fprime_Az_over_codeword_domain_));
     this->IOP_.submit_oracle(this->fBz_handle_, std::move(this->fprime_Bz_over_codeword_domain_));
@@ -609,9 +632,9 @@ void encoded_aurora_protocol<FieldT>::submit_witness_oracles(
     std::vector<FieldT>().swap(this->fprime_Az_over_codeword_domain_);
     std::vector<FieldT>().swap(this->fprime_Bz_over_codeword_domain_);
     std::vector<FieldT>().swap(this->fprime_Cz_over_codeword_domain_);
-    libff::leave_block("Call IOP oracle submission routines");
+    LIBIOP_TRACE_END("Call IOP oracle submission routines");
 
-    libff::leave_block("Submit witness oracles");
+    LIBIOP_TRACE_END("Submit witness oracles");
 }
 
 template<typename FieldT>
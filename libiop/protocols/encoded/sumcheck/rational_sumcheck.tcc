@@ -61,7 +61,7 @@ public:
     }
 
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>> > &constituent_oracle_evaluations) const
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
     {
         /** The input is expected to be of the form: (p, N, D)
          *  where p is output by rational sumcheck,
@@ -74,7 +74,8 @@ public:
 
         /* evaluations of p */
         std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>(
-            *constituent_oracle_evaluations[0].get());
+            constituent_oracle_evaluations[0].begin(),
+            constituent_oracle_evaluations[0].end());
         const std::vector<FieldT> Z_inv_over_L = batch_inverse(
             this->Z_.evaluations_over_field_subset(this->codeword_domain_));
         if (this->field_subset_type_ == affine_subspace_type)
@@ -91,8 +92,8 @@ public:
             /** Compute q, by performing the correct arithmetic on the evaluations */
             for (std::size_t i = 0; i < result->size(); ++i)
             {
-                const FieldT N_x = constituent_oracle_evaluations[1]->operator[](i);
-                const FieldT D_x = constituent_oracle_evaluations[2]->operator[](i);
+                const FieldT N_x = constituent_oracle_evaluations[1][i];
+                const FieldT D_x = constituent_oracle_evaluations[2][i];
                 result->operator[](i) = ((D_x *
                     (
                         result->operator[](i) + eps_inv_times_claimed_sum_times_x_to_H_minus_1[i])) - N_x
@@ -107,8 +108,8 @@ public:
             for (std::size_t i = 0; i < result->size(); ++i)
             {
                 const FieldT x = domain_elems[i];
-                const FieldT N_x = constituent_oracle_evaluations[1]->operator[](i);
-                const FieldT D_x = constituent_oracle_evaluations[2]->operator[](i);
+                const FieldT N_x = constituent_oracle_evaluations[1][i];
+                const FieldT D_x = constituent_oracle_evaluations[2][i];
                 result->operator[](i) = ((D_x *
                     (
                         result->operator[](i) * x + this->order_H_inv_times_claimed_sum_)) - N_x
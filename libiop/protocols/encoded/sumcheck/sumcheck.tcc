@@ -2,6 +2,7 @@
 #include <stdexcept>
 
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include "libiop/algebra/fft.hpp"
 #include "libiop/algebra/utils.hpp"
 #include "libiop/algebra/polynomials/polynomial.hpp"
@@ -56,7 +57,7 @@ public:
     }
 
     virtual std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>> > &constituent_oracle_evaluations) const
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
     {
         /** [BCRSVW18] protocol 5.3, step 3, computing p in RS[L, (|H|-1) / L] */
         if (constituent_oracle_evaluations.size() != 2)
@@ -64,11 +65,12 @@ public:
             throw std::invalid_argument("sumcheck_g_oracle has two constituent oracles");
         }
 
-        libff::enter_block("Sumcheck: g evaluated contents");
+        LIBIOP_TRACE_BEGIN("Sumcheck: g evaluated contents");
 
         /* evaluations of \hat{f} */
         std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>(
-            *constituent_oracle_evaluations[0].get());
+            constituent_oracle_evaluations[0].begin(),
+            constituent_oracle_evaluations[0].end());
         const std::vector<FieldT> Z_over_L = this->Z_.evaluations_over_field_subset(this->codeword_domain_);
         if (this->field_subset_type_ == affine_subspace_type) {
             /** In the additive case this is computing p in RS[L, (|H|-1) / L],
@@ -91,7 +93,7 @@ public:
             for (std::size_t i = 0; i < result->size(); ++i)
             {
                 result->operator[](i) -= (eps_inv_times_claimed_sum_times_x_to_H_minus_1[i]
-                    + Z_over_L[i] * constituent_oracle_evaluations[1]->operator[](i));
+                    + Z_over_L[i] * constituent_oracle_evaluations[1][i]);
             }
         } else if (this->field_subset_type_ == multiplicative_coset_type) {
             /** In the multiplicative case this is computing p in RS[L, (|H|-1) / L],
@@ -111,12 +113,12 @@ public:
             for (std::size_t i = 0; i < result->size(); ++i)
             {
                 result->operator[](i) -= (this->order_H_inv_times_claimed_sum_ +
-                    Z_over_L[i] * constituent_oracle_evaluations[1]->operator[](i));
+                    Z_over_L[i] * constituent_oracle_evaluations[1][i]);
                 result->operator[](i) *= cur_x_inv;
                 cur_x_inv *= generator_inv;
             }
         }
-        libff::leave_block("Sumcheck: g evaluated contents");
+        LIBIOP_TRACE_END("Sumcheck: g evaluated contents");
         return result;
     }
 
@@ -160,6 +162,44 @@ public:
         }
         return FieldT::zero();
     }
+
+    virtual temporary_vector<FieldT> evaluations_at_points(
+        const temporary_vector<std::size_t> &evaluation_positions,
+        const temporary_vector<FieldT> &evaluation_points,
+        const temporary_vector<temporary_vector<FieldT>> &constituent_oracle_evaluations) const
+    {
+        libff::UNUSED(evaluation_positions);
+        if (constituent_oracle_evaluations.size() != 2)
+        {
+            throw std::invalid_argument("sumcheck_g_oracle has two constituent oracles");
+        }
+
+        const temporary_vector<FieldT> &f_at_x = constituent_oracle_evaluations[0];
+        const temporary_vector<FieldT> &h_at_x = constituent_oracle_evaluations[1];
+        temporary_vector<FieldT> result(evaluation_points.size(), FieldT::zero(), temporary_resource());
+        if (this->field_subset_type_ == affine_subspace_type) {
+            /** p'(x) = f(x) - eps^{-1} * mu * x^{|H| - 1} - Z_H(x) * h(x), as in evaluation_at_point */
+            for (std::size_t i = 0; i < evaluation_points.size(); ++i)
+            {
+                const FieldT Z_at_x = this->Z_.evaluation_at_point(evaluation_points[i]);
+                result[i] = f_at_x[i]
+                    - this->eps_inv_times_claimed_sum_ * libff::power(evaluation_points[i], this->summation_domain_.num_elements() - 1)
+                    - Z_at_x * h_at_x[i];
+            }
+        } else if (this->field_subset_type_ == multiplicative_coset_type) {
+            /** p'(x) = (f(x) - |H|^{-1} * mu - Z_H(x) * h(x)) * (x^-1), with all x^-1 inverted together */
+            const temporary_vector<FieldT> x_inv = batch_inverse(evaluation_points);
+            for (std::size_t i = 0; i < evaluation_points.size(); ++i)
+            {
+                const FieldT Z_at_x = this->Z_.evaluation_at_point(evaluation_points[i]);
+                result[i] = (f_at_x[i]
+                    - this->order_H_inv_times_claimed_sum_
+                    - Z_at_x * h_at_x[i])
+                    * x_inv[i];
+            }
+        }
+        return result;
+    }
 };
 
 /* Initialize domains, domain sizes, and the degree of g and h */
@@ -297,12 +337,12 @@ void batch_sumcheck_protocol<FieldT>::submit_masking_polynomial()
      *  2) alter g such that its sum over H is 0
      *  3) compute m using the identity m = Z_H * h + g
      *  4) convert m to the codeword domain and submit it */
-    libff::enter_block("Sumcheck: sample masking polynomial components");
+    LIBIOP_TRACE_BEGIN("Sumcheck: sample masking polynomial components");
     polynomial<FieldT> masking_g_poly = polynomial<FieldT>::random_polynomial(this->summation_domain_size_);
     const polynomial<FieldT> masking_h_poly = polynomial<FieldT>::random_polynomial(this->h_degree_);
-    libff::leave_block("Sumcheck: sample masking polynomial components");
+    LIBIOP_TRACE_END("Sumcheck: sample masking polynomial components");
 
-    libff::enter_block("Sumcheck: compute masking polynomial codeword");
+    LIBIOP_TRACE_BEGIN("Sumcheck: compute masking polynomial codeword");
     const vanishing_polynomial<FieldT> summation_vp(this->summation_domain_);
 
     if (this->field_subset_type_ == multiplicative_coset_type) {
@@ -322,7 +362,7 @@ void batch_sumcheck_protocol<FieldT>::submit_masking_polynomial()
         this->masking_poly_handle_,
         oracle<FieldT>(FFT_over_field_subset<FieldT>(
             this->masking_poly_.coefficients(), this->codeword_domain_)));
-    libff::leave_block("Sumcheck: compute masking polynomial codeword");
+    LIBIOP_TRACE_END("Sumcheck: compute masking polynomial codeword");
 }
 
 template<typename FieldT>
@@ -64,6 +64,7 @@ class fractal_iop_parameters {
     field_subset<FieldT> index_domain() const;
     field_subset<FieldT> matrix_domain() const;
     field_subset<FieldT> codeword_domain() const;
+    size_t codeword_domain_dim() const;
 
     long double achieved_soundness() const;
     void print() const;
@@ -105,7 +106,7 @@ public:
     /* Proving */
     void produce_proof(const r1cs_primary_input<FieldT> &primary_input,
                        const r1cs_auxiliary_input<FieldT> &auxiliary_input,
-                       iop_prover_index<FieldT> &index);
+                       const iop_prover_index<FieldT> &index);
 
     /* Verification */
     bool verifier_predicate(const r1cs_primary_input<FieldT> &primary_input);
@@ -1,3 +1,5 @@
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -171,6 +173,12 @@ field_subset<FieldT> fractal_iop_parameters<FieldT>::codeword_domain() const
     return this->codeword_domain_;
 }
 
+template<typename FieldT>
+size_t fractal_iop_parameters<FieldT>::codeword_domain_dim() const
+{
+    return this->codeword_domain_dim_;
+}
+
 template<typename FieldT>
 std::vector<size_t> fractal_iop_parameters<FieldT>::locality_vector() const {
     std::vector<size_t> protocol_locality = this->encoded_aurora_params_.locality_vector();
@@ -306,10 +314,12 @@ void fractal_iop<FieldT>::register_queries()
 template<typename FieldT>
 void fractal_iop<FieldT>::produce_index()
 {
-    for (size_t i = 0; i < this->matrix_indexers_.size(); i++)
+    std::vector<matrix_indexer<FieldT>*> matrix_indexers;
+    for (matrix_indexer<FieldT> &indexer : this->matrix_indexers_)
     {
-        this->matrix_indexers_[i].compute_oracles();
+        matrix_indexers.emplace_back(&indexer);
     }
+    matrix_indexer<FieldT>::compute_oracles(matrix_indexers);
     this->IOP_.signal_index_submissions_done();
 }
 
@@ -317,7 +327,7 @@ template<typename FieldT>
 void fractal_iop<FieldT>::produce_proof(
     const r1cs_primary_input<FieldT> &primary_input,
     const r1cs_auxiliary_input<FieldT> &auxiliary_input,
-    iop_prover_index<FieldT> &index)
+    const iop_prover_index<FieldT> &index)
 {
     this->IOP_.submit_prover_index(index);
     this->protocol_->submit_witness_oracles(primary_input, auxiliary_input);
@@ -331,13 +341,13 @@ void fractal_iop<FieldT>::produce_proof(
 template<typename FieldT>
 bool fractal_iop<FieldT>::verifier_predicate(const r1cs_primary_input<FieldT> &primary_input)
 {
-    libff::enter_block("Construct R1CS verifier state");
+    LIBIOP_TRACE_BEGIN("Construct R1CS verifier state");
     this->protocol_->construct_verifier_state(primary_input);
-    libff::leave_block("Construct R1CS verifier state");
+    LIBIOP_TRACE_END("Construct R1CS verifier state");
 
-    libff::enter_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_BEGIN("Check LDT verifier predicate");
     const bool decision = this->LDT_reducer_->verifier_predicate();
-    libff::leave_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_END("Check LDT verifier predicate");
 
     return decision;
 }
@@ -3,7 +3,7 @@ namespace libiop {
 /* helper functions for estimating argument size */
 
 /* return the expected number of hashes needed in the membership proof for a tree */
-size_t num_hashes_in_a_membership_proof(size_t num_queries, size_t depth)
+inline size_t num_hashes_in_a_membership_proof(size_t num_queries, size_t depth)
 {
     /** We wish to know the expected number of hashes the prover must provide to the verifier for q randomly chosen leafs. (q's can collide)
      *  We consider this layer by layer. */
@@ -38,7 +38,7 @@ size_t num_hashes_in_a_membership_proof(size_t num_queries, size_t depth)
     return ((size_t) std::round(sum));
 }
 
-size_t num_hashes_in_all_membership_proofs(
+inline size_t num_hashes_in_all_membership_proofs(
     std::vector<size_t> oracle_locality_vector,
     std::vector<size_t> fri_localization_vector,
     size_t num_queries,
@@ -67,7 +67,7 @@ size_t num_hashes_in_all_membership_proofs(
     return total_hashes;
 }
 
-size_t num_elements_in_query_answers(
+inline size_t num_elements_in_query_answers(
     std::vector<size_t> oracle_locality_vector,
     std::vector<size_t> fri_localization_vector,
     size_t num_queries,
@@ -90,7 +90,7 @@ size_t num_elements_in_query_answers(
     return total;
 }
 
-size_t FRI_final_interpolation_degree(
+inline size_t FRI_final_interpolation_degree(
     const size_t max_tested_degree,
     const std::vector<size_t> fri_localization_vector)
 {
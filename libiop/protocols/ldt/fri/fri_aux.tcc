@@ -1,5 +1,8 @@
 #include <cstdint>
 
+#include "libiop/common/huge_pages.hpp"
+#include "libiop/common/proof_arena.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -42,8 +45,11 @@ std::shared_ptr<std::vector<FieldT>> additive_evaluate_next_f_i_over_entire_doma
 {
     const std::vector<FieldT> all_elements = f_i_domain.all_elements();
     const size_t num_cosets = all_elements.size() / coset_size;
+    /* Coset j is folded into next_f_i[j] by the statically scheduled loop below,
+       so each thread first touches the share of the buffer that it fills. */
     std::shared_ptr<std::vector<FieldT>> next_f_i = std::make_shared<std::vector<FieldT>>();
-    next_f_i->reserve(num_cosets);
+    reserve_oracle_buffer(*next_f_i, num_cosets, true);
+    next_f_i->resize(num_cosets);
 
     /** Lagrange coefficient for coset element k is: vp_coset(x) / vp_coset[1] * (x - v[k])
      *
@@ -61,43 +67,52 @@ std::shared_ptr<std::vector<FieldT>> additive_evaluate_next_f_i_over_entire_doma
 
     const FieldT unshifted_vp_x = unshifted_vp.evaluation_at_point(x_i);
     const FieldT inv_vp_linear_term = unshifted_vp.coefficients()[1].inverse();
-    /** We process cosets one at a time.
+    /** We process cosets one at a time, each thread taking a contiguous range.
      *  We should batch process them for fewer inversions,
      *  but at too large of a batch size we will lose out on cache efficiency.    */
-    /* x - V[k] vector, defined outside the loop to avoid re-allocations. */
-    std::vector<FieldT> shifted_coset_elements(coset_size);
-    for (size_t j = 0; j < num_cosets; j++)
+#ifdef MULTICORE
+#pragma omp parallel
+#endif
     {
-        /** By definition of cosets,
-         *  shifted vp = unshifted vp - unshifted_vp(shift) */
-        const FieldT coset_shift = all_elements[coset_size * j];
-        const FieldT shifted_vp_x = unshifted_vp_x -
-            unshifted_vp.evaluation_at_point(coset_shift);
-
-        const bool x_in_domain = shifted_vp_x == FieldT::zero();
-        FieldT interpolation = FieldT::zero();
-        for (std::size_t k = 0; k < coset_size; k++)
+        /* x - V[k] vector, defined outside the loop to avoid re-allocations.
+           Each thread draws its own from its own temporary resource. */
+        temporary_vector<FieldT> shifted_coset_elements(coset_size, temporary_resource());
+#ifdef MULTICORE
+#pragma omp for schedule(static)
+#endif
+        for (size_t j = 0; j < num_cosets; j++)
         {
-            /** If x in coset, set the interpolation accordingly. */
-            if (x_in_domain && x_i == all_elements[j*coset_size + k])
+            /** By definition of cosets,
+             *  shifted vp = unshifted vp - unshifted_vp(shift) */
+            const FieldT coset_shift = all_elements[coset_size * j];
+            const FieldT shifted_vp_x = unshifted_vp_x -
+                unshifted_vp.evaluation_at_point(coset_shift);
+
+            const bool x_in_domain = shifted_vp_x == FieldT::zero();
+            FieldT interpolation = FieldT::zero();
+            for (std::size_t k = 0; k < coset_size; k++)
             {
-                interpolation = f_i_evals->operator[](j*coset_size + k);
-                break;
+                /** If x in coset, set the interpolation accordingly. */
+                if (x_in_domain && x_i == all_elements[j*coset_size + k])
+                {
+                    interpolation = f_i_evals->operator[](j*coset_size + k);
+                    break;
+                }
+                /* If it's not in the coset, set this element to x - V[k] */
+                shifted_coset_elements[k] = x_i - all_elements[j*coset_size + k];
             }
-            /* If it's not in the coset, set this element to x - V[k] */
-            shifted_coset_elements[k] = x_i - all_elements[j*coset_size + k];
-        }
-        if (!x_in_domain)
-        {
-            const FieldT k = inv_vp_linear_term * shifted_vp_x;
-            const std::vector<FieldT> lagrange_coefficients =
-                batch_inverse_and_mul(shifted_coset_elements, k);
-            for (std::size_t k = 0; k < coset_size; k++)
+            if (!x_in_domain)
             {
-                interpolation += f_i_evals->operator[](j*coset_size + k) * lagrange_coefficients[k];
+                const FieldT k = inv_vp_linear_term * shifted_vp_x;
+                const temporary_vector<FieldT> lagrange_coefficients =
+                    batch_inverse_and_mul(shifted_coset_elements, k);
+                for (std::size_t k = 0; k < coset_size; k++)
+                {
+                    interpolation += f_i_evals->operator[](j*coset_size + k) * lagrange_coefficients[k];
+                }
             }
+            next_f_i->operator[](j) = interpolation;
         }
-        next_f_i->emplace_back(interpolation);
     }
     return next_f_i;
 }
@@ -111,8 +126,10 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_evaluate_next_f_i_over_entir
     const FieldT x_i)
 {
     const size_t num_cosets = f_i_domain.num_elements() / coset_size;
+    /* Filled by a statically scheduled loop over the cosets, see the end */
     std::shared_ptr<std::vector<FieldT>> next_f_i = std::make_shared<std::vector<FieldT>>();
-    next_f_i->reserve(num_cosets);
+    reserve_oracle_buffer(*next_f_i, num_cosets, true);
+    next_f_i->resize(num_cosets);
 
     /** Let g be the generator for the coset, and h be the affine shift.
      *  Then the Lagrange coefficient for coset element k is:
@@ -159,7 +176,7 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_evaluate_next_f_i_over_entir
     const FieldT g_inv = g.inverse();
     const FieldT x_to_order_coset = libff::power(x_i, coset_size);
     /* xg^{-k} */
-    std::vector<FieldT> shifted_x_elements(coset_size);
+    temporary_vector<FieldT> shifted_x_elements(coset_size, temporary_resource());
     shifted_x_elements[0] = x_i;
     for (size_t i = 1; i < coset_size; i++)
     {
@@ -171,11 +188,11 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_evaluate_next_f_i_over_entir
     FieldT cur_coset_constant_plus_h = x_to_order_coset * first_h_to_coset_inv_plus_one;
 
     /* xg^{-k} - h, for all combinations of k, h.  */
-    std::vector<FieldT> elements_to_invert;
+    temporary_vector<FieldT> elements_to_invert(temporary_resource());
     elements_to_invert.reserve(f_i_evals->size());
     /** constant for each coset, equal to
      *  vp_coset(x) / h^{|coset| - 1} = x^{|coset|} h^{-|coset| + 1} - h */
-    std::vector<FieldT> constant_for_each_coset;
+    temporary_vector<FieldT> constant_for_each_coset(temporary_resource());
     constant_for_each_coset.reserve(num_cosets);
 
     const FieldT constant_for_all_cosets = FieldT(coset_size).inverse();
@@ -227,8 +244,11 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_evaluate_next_f_i_over_entir
         cur_coset_constant_plus_h *= h_inc_to_coset_inv_plus_one;
     }
     /* Technically not lagrange coefficients, its missing the constant for each coset */
-    const std::vector<FieldT> lagrange_coefficients =
+    const temporary_vector<FieldT> lagrange_coefficients =
         batch_inverse_and_mul(elements_to_invert, constant_for_all_cosets);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
     for (size_t j = 0; j < num_cosets; j++)
     {
         FieldT interpolation = FieldT::zero();
@@ -238,7 +258,7 @@ std::shared_ptr<std::vector<FieldT>> multiplicative_evaluate_next_f_i_over_entir
         }
         /* Multiply the constant for each coset, to get the correct interpolation */
         interpolation *= constant_for_each_coset[j];
-        next_f_i->emplace_back(interpolation);
+        next_f_i->operator[](j) = interpolation;
     }
     /* if x ever in domain, correct that evaluation. */
     if (x_ever_in_domain)
@@ -375,7 +395,7 @@ std::vector<query_position_handle> calculate_next_coset_query_positions(
         query_pos[i] = IOP.register_deterministic_query_position(
             { non_localized_query_handle },
             [non_localized_domain, localized_domain, prev_coset_size, cur_coset_size, i]
-            (const std::vector<std::size_t> &seed_positions)
+            (const temporary_vector<std::size_t> &seed_positions)
             -> std::size_t {
                 const std::size_t si_idx = seed_positions[0];
                 const size_t localized_position = non_localized_domain.coset_index(si_idx, prev_coset_size);
@@ -1,4 +1,8 @@
+#include <cmath>
+#include <stdexcept>
+
 #include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/field_subset/subgroup.hpp"
 
@@ -60,6 +64,13 @@ FRI_protocol_parameters<FieldT>::FRI_protocol_parameters(const size_t interactiv
         const long double term2 = (1 - 3*rate - (localization_coset_size / sqrt_codeword_domain_size)) / 4;
         /** min(fractional_proximity_parameter, term2) */
         this->effective_proximity_parameter_ = std::min<long double>(fractional_proximity_parameter, term2);
+        /** term2 is only positive for rates below 1/3 and large enough codeword domains,
+         *  otherwise no number of queries achieves the soundness. */
+        if (!(this->effective_proximity_parameter_ > 0 && this->effective_proximity_parameter_ < 1))
+        {
+            throw std::invalid_argument("FRI's proven soundness is not achievable for this rate and codeword domain. "
+                                        "Consider increasing RS_extra_dimensions.");
+        }
         long double denominator = log2l(1 - this->effective_proximity_parameter_);
         const long double query_repetitions = ceil(-1.0 * query_soundness_bits / denominator);
         this->num_query_repetitions_ = std::max<size_t>(1, size_t(query_repetitions));
@@ -74,6 +85,11 @@ FRI_protocol_parameters<FieldT>::FRI_protocol_parameters(const size_t interactiv
          *      log(3 * codeword_domain_size / |F|) = log(3) + codeword_domain_dimension - log(|F|)
          */
         this->soundness_per_interaction_ = (log2l(3) + (long double)(this->codeword_domain_dim_) - field_size_bits);
+        if (!(this->soundness_per_interaction_ < 0))
+        {
+            throw std::invalid_argument("FRI's proven soundness is not achievable for a codeword domain this large "
+                                        "relative to the field.");
+        }
         const long double interactive_repetitions = ceil(-1.0 * interactive_soundness_bits / this->soundness_per_interaction_);
         this->num_interactive_repetitions_ = std::max<size_t>(1, size_t(interactive_repetitions));
     }
@@ -505,9 +521,9 @@ void FRI_protocol<FieldT>::calculate_and_submit_proof()
                 }
             }
 
-            libff::enter_block("LDT signal prover round done");
+            LIBIOP_TRACE_BEGIN("LDT signal prover round done");
             this->IOP_.signal_prover_round_done();
-            libff::leave_block("LDT signal prover round done");
+            LIBIOP_TRACE_END("LDT signal prover round done");
         }
 
         /* For each interaction, receive the verifier challenge and create f_{i + 1} */
@@ -516,7 +532,7 @@ void FRI_protocol<FieldT>::calculate_and_submit_proof()
             const FieldT x_i = this->IOP_.obtain_verifier_random_message(
                 this->verifier_challenge_handles_[i][j])[0];
 
-            libff::enter_block("evaluating next FRI codeword");
+            LIBIOP_TRACE_BEGIN("evaluating next FRI codeword");
             for (size_t ldt_index = 0; ldt_index < this->poly_handles_.size(); ldt_index++)
             {
                 multi_f_i_evaluations_by_interaction[j][ldt_index] = evaluate_next_f_i_over_entire_domain(
@@ -525,7 +541,7 @@ void FRI_protocol<FieldT>::calculate_and_submit_proof()
                     coset_size,
                     x_i);
             }
-            libff::leave_block("evaluating next FRI codeword");
+            LIBIOP_TRACE_END("evaluating next FRI codeword");
         }
     }
 
@@ -542,9 +558,9 @@ void FRI_protocol<FieldT>::calculate_and_submit_proof()
         }
     }
 
-    libff::enter_block("LDT signal prover round done");
+    LIBIOP_TRACE_BEGIN("LDT signal prover round done");
     this->IOP_.signal_prover_round_done();
-    libff::leave_block("LDT signal prover round done");
+    LIBIOP_TRACE_END("LDT signal prover round done");
 }
 
 template<typename FieldT>
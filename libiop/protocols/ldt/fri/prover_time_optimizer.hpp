@@ -0,0 +1,116 @@
+/**@file
+ *****************************************************************************
+  FRI parameter optimizer for minimal prover time under an argument size budget
+ *****************************************************************************
+ * @author     This file is part of libiop (see AUTHORS)
+ * @copyright  MIT license (see LICENSE file)
+ *****************************************************************************/
+#ifndef LIBIOP_PROTOCOLS_LDT_FRI_PROVER_TIME_OPTIMIZER_HPP_
+#define LIBIOP_PROTOCOLS_LDT_FRI_PROVER_TIME_OPTIMIZER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <libff/algebra/field_utils/field_utils.hpp>
+#include "libiop/algebra/utils.hpp"
+#include "libiop/protocols/ldt/fri/fri_aux.hpp"
+#include "libiop/protocols/ldt/fri/argument_size_optimizer.hpp"
+#include "libiop/protocols/ldt/fri/fri_ldt.hpp"
+#include "libiop/protocols/ldt/ldt_reducer.hpp"
+#include "libiop/bcs/hashing/hash_enum.hpp"
+#include "libiop/bcs/pow.hpp"
+
+namespace libiop {
+
+/** Host-specific throughput numbers the prover time predictor is built from.
+ *  These are normally measured with calibrate_prover_cost_model,
+ *  but can be filled in by hand to model a different machine. */
+struct prover_cost_model {
+    /* Seconds per element per level of an FFT, i.e. an FFT of size n costs n log(n) of these */
+    double FFT_seconds_per_element_level = 0;
+    /* Seconds per field element absorbed by a Merkle tree leaf hash */
+    double leaf_hash_seconds_per_element = 0;
+    /* Seconds per two to one hash, used for Merkle tree internal nodes and proof of work */
+    double compression_hash_seconds = 0;
+    /* Seconds per input element of an FRI round */
+    double FRI_fold_seconds_per_element = 0;
+    size_t hash_size_in_bytes = 32;
+};
+
+struct prover_cost_prediction {
+    double prover_seconds = 0;
+    size_t peak_memory_bytes = 0;
+    size_t argument_size_bytes = 0;
+};
+
+/** Measures the FFT, hash and FRI folding throughput of this host,
+ *  over a domain of size 2^{log_domain_size}. */
+template<typename FieldT, typename hash_type>
+prover_cost_model calibrate_prover_cost_model(
+    const bcs_hash_type hash_enum,
+    const size_t security_parameter,
+    const size_t log_domain_size = 12);
+
+/** Returns the predicted prover time, peak memory and argument size.
+ *  The prover time accounts for the low degree extensions of the input oracles,
+ *  Merkle tree construction for every committed oracle, FRI folding across all
+ *  interactive repetitions, and 2^{pow_bits} hashes of proof of work.
+ *  The peak memory assumes every codeword and Merkle tree is held until the query phase,
+ *  which is what the BCS prover does.
+ *
+ *  The locality vector is the vector of the number of oracles, by round,
+ *  that are being low degree tested into FRI.
+ */
+template<typename FieldT>
+prover_cost_prediction prover_cost_predictor(
+    const prover_cost_model &model,
+    std::vector<size_t> oracle_locality_vector,
+    std::vector<size_t> fri_localization_vector,
+    size_t codeword_dim,
+    size_t num_queries,
+    size_t interactive_repetitions,
+    size_t max_tested_degree,
+    size_t pow_bits);
+
+/** Returns the vector of FRI localization parameters with the smallest predicted prover time,
+ *  among those whose predicted argument size is at most max_argument_size_in_bytes.
+ *  Returns an empty vector if no localization vector fits in the budget.
+ *  As in compute_argument_size_optimal_localization_parameters, all options are brute forced
+ *  and the first localization parameter is fixed as 1.
+ */
+template<typename FieldT>
+std::vector<size_t> compute_prover_time_optimal_localization_parameters(
+    const prover_cost_model &model,
+    std::vector<size_t> oracle_locality_vector,
+    size_t codeword_dim,
+    size_t num_queries,
+    size_t interactive_repetitions,
+    size_t max_tested_degree,
+    size_t pow_bits,
+    size_t max_argument_size_in_bytes);
+
+/** Re-parameterizes a SNARK with the RS extra dimensions (1 to max_RS_extra_dimensions,
+ *  or 2 to max_RS_extra_dimensions if either soundness type is proven),
+ *  proof of work bits (0 to max_pow_bits) and FRI localization vector that have the
+ *  smallest predicted prover time, among those whose predicted argument size is at most
+ *  max_argument_size_in_bytes. Returns the prediction for the chosen parameterization.
+ *  RS extra dimensions for which FRI's proven soundness is not achievable are skipped.
+ *  If none fit the budget, or re-parameterizing throws partway through the search,
+ *  the original parameters are restored before the exception propagates.
+ *
+ *  This is the search behind aurora_snark_parameters::optimize_for_prover_time and
+ *  fractal_snark_parameters::optimize_for_prover_time, which befriend it.
+ */
+template<typename FieldT, typename snark_parameters_type>
+prover_cost_prediction optimize_snark_parameters_for_prover_time(
+    snark_parameters_type &parameters,
+    const prover_cost_model &model,
+    const size_t max_argument_size_in_bytes,
+    const size_t max_RS_extra_dimensions,
+    const size_t max_pow_bits);
+
+} // namespace libiop
+
+#include "libiop/protocols/ldt/fri/prover_time_optimizer.tcc"
+
+#endif // LIBIOP_PROTOCOLS_LDT_FRI_PROVER_TIME_OPTIMIZER_HPP_
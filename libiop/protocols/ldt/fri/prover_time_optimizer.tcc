@@ -0,0 +1,346 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+
+#include "libiop/algebra/fft.hpp"
+#include "libiop/algebra/field_subset/field_subset.hpp"
+
+namespace libiop {
+
+template<typename FieldT, typename hash_type>
+prover_cost_model calibrate_prover_cost_model(
+    const bcs_hash_type hash_enum,
+    const size_t security_parameter,
+    const size_t log_domain_size)
+{
+    typedef std::chrono::steady_clock clock;
+    const auto seconds_since = [](const clock::time_point start) {
+        return std::chrono::duration<double>(clock::now() - start).count();
+    };
+    const size_t domain_size = 1ull << log_domain_size;
+    const size_t coset_size = 4;
+    const size_t FFT_repetitions = 4;
+
+    const field_subset<FieldT> domain(domain_size);
+    std::vector<FieldT> coefficients(domain_size);
+    for (size_t i = 0; i < domain_size; ++i)
+    {
+        coefficients[i] = FieldT::random_element();
+    }
+
+    prover_cost_model model;
+
+    clock::time_point start = clock::now();
+    std::vector<FieldT> evaluations;
+    for (size_t r = 0; r < FFT_repetitions; ++r)
+    {
+        evaluations = FFT_over_field_subset<FieldT>(coefficients, domain);
+    }
+    model.FFT_seconds_per_element_level =
+        seconds_since(start) / (FFT_repetitions * domain_size * std::max<size_t>(log_domain_size, 1));
+
+    /* Hash with fresh hashers, so the state of the ones the prover uses is untouched. */
+    std::shared_ptr<leafhash<FieldT, hash_type>> leafhasher =
+        get_leafhash<FieldT, hash_type>(hash_enum, security_parameter, coset_size);
+    const two_to_one_hash_function<hash_type> compression_hasher =
+        get_two_to_one_hash<hash_type, FieldT>(hash_enum, security_parameter);
+
+    std::vector<hash_type> leaf_hashes;
+    leaf_hashes.reserve(domain_size / coset_size);
+    start = clock::now();
+    for (size_t i = 0; i < domain_size; i += coset_size)
+    {
+        leaf_hashes.emplace_back(leafhasher->hash(&evaluations[i], coset_size));
+    }
+    model.leaf_hash_seconds_per_element = seconds_since(start) / domain_size;
+    model.hash_size_in_bytes = get_hash_size<hash_type>(leaf_hashes[0]);
+
+    const size_t num_compressions = leaf_hashes.size() / 2;
+    start = clock::now();
+    for (size_t i = 0; i < num_compressions; ++i)
+    {
+        leaf_hashes[i] = compression_hasher(
+            leaf_hashes[2 * i], leaf_hashes[2 * i + 1], model.hash_size_in_bytes);
+    }
+    model.compression_hash_seconds = seconds_since(start) / std::max<size_t>(num_compressions, 1);
+
+    const std::shared_ptr<std::vector<FieldT>> f_i_evals =
+        std::make_shared<std::vector<FieldT>>(std::move(evaluations));
+    start = clock::now();
+    const std::shared_ptr<std::vector<FieldT>> next_f_i = evaluate_next_f_i_over_entire_domain<FieldT>(
+        f_i_evals, domain, coset_size, FieldT::random_element());
+    model.FRI_fold_seconds_per_element = seconds_since(start) / domain_size;
+
+    return model;
+}
+
+/* Fills in the prover time and peak memory of a prediction, but not its argument size */
+template<typename FieldT>
+void predict_prover_time_and_memory(
+    const prover_cost_model &model,
+    const std::vector<size_t> &oracle_locality_vector,
+    const std::vector<size_t> &fri_localization_vector,
+    const size_t codeword_dim,
+    const size_t interactive_repetitions,
+    const size_t pow_bits,
+    prover_cost_prediction &prediction)
+{
+    const size_t field_size_in_bits = libff::log_of_field_size_helper<FieldT>(FieldT::zero());
+    const double field_size_in_bytes = (double)((field_size_in_bits + 7) / 8);
+    const double hash_size_in_bytes = (double)model.hash_size_in_bytes;
+
+    if (fri_localization_vector.size() == 0 || fri_localization_vector[0] > codeword_dim)
+    {
+        throw std::invalid_argument("FRI localization vector does not fit in the codeword domain");
+    }
+
+    size_t num_input_oracles = 0;
+    for (size_t i = 0; i < oracle_locality_vector.size(); ++i)
+    {
+        num_input_oracles += oracle_locality_vector[i];
+    }
+
+    /** The input oracles are low degree extended onto the codeword domain,
+     *  and each round's oracles are committed to in a single Merkle tree,
+     *  whose leaves are cosets of size 2^{first localization parameter}. */
+    const double codeword_size = exp2((double)codeword_dim);
+    const double input_leaves = exp2((double)(codeword_dim - fri_localization_vector[0]));
+    double seconds = num_input_oracles * codeword_size *
+        (codeword_dim * model.FFT_seconds_per_element_level + model.leaf_hash_seconds_per_element);
+    seconds += oracle_locality_vector.size() * (input_leaves - 1) * model.compression_hash_seconds;
+    double memory = num_input_oracles * codeword_size * field_size_in_bytes +
+        oracle_locality_vector.size() * (2 * input_leaves - 1) * hash_size_in_bytes;
+
+    /** Each FRI round folds the previous codeword, and every codeword but the final one is committed to.
+     *  This is done once per interactive repetition. */
+    double FRI_seconds = 0;
+    double FRI_memory = 0;
+    size_t current_dim = codeword_dim;
+    for (size_t i = 0; i < fri_localization_vector.size(); ++i)
+    {
+        if (fri_localization_vector[i] > current_dim)
+        {
+            throw std::invalid_argument("FRI localization vector does not fit in the codeword domain");
+        }
+        FRI_seconds += exp2((double)current_dim) * model.FRI_fold_seconds_per_element;
+        current_dim -= fri_localization_vector[i];
+        if (i + 1 < fri_localization_vector.size())
+        {
+            const size_t next_localization = std::min(fri_localization_vector[i + 1], current_dim);
+            const double folded_size = exp2((double)current_dim);
+            const double folded_leaves = exp2((double)(current_dim - next_localization));
+            FRI_seconds += folded_size * model.leaf_hash_seconds_per_element +
+                (folded_leaves - 1) * model.compression_hash_seconds;
+            FRI_memory += folded_size * field_size_in_bytes +
+                (2 * folded_leaves - 1) * hash_size_in_bytes;
+        }
+    }
+    seconds += interactive_repetitions * FRI_seconds;
+    memory += interactive_repetitions * FRI_memory;
+
+    /* The proof of work takes an expected 2^{pow bits} hashes */
+    seconds += exp2((double)pow_bits) * model.compression_hash_seconds;
+
+    prediction.prover_seconds = seconds;
+    prediction.peak_memory_bytes = (size_t)memory;
+}
+
+template<typename FieldT>
+prover_cost_prediction prover_cost_predictor(
+    const prover_cost_model &model,
+    std::vector<size_t> oracle_locality_vector,
+    std::vector<size_t> fri_localization_vector,
+    size_t codeword_dim,
+    size_t num_queries,
+    size_t interactive_repetitions,
+    size_t max_tested_degree,
+    size_t pow_bits)
+{
+    prover_cost_prediction prediction;
+    predict_prover_time_and_memory<FieldT>(
+        model, oracle_locality_vector, fri_localization_vector,
+        codeword_dim, interactive_repetitions, pow_bits, prediction);
+    prediction.argument_size_bytes = argument_size_predictor<FieldT>(
+        oracle_locality_vector, fri_localization_vector, codeword_dim,
+        num_queries, interactive_repetitions, max_tested_degree, model.hash_size_in_bytes);
+    return prediction;
+}
+
+template<typename FieldT>
+std::vector<size_t> compute_prover_time_optimal_localization_parameters(
+    const prover_cost_model &model,
+    std::vector<size_t> oracle_locality_vector,
+    size_t codeword_dim,
+    size_t num_queries,
+    size_t interactive_repetitions,
+    size_t max_tested_degree,
+    size_t pow_bits,
+    size_t max_argument_size_in_bytes)
+{
+    /* Same search space as compute_argument_size_optimal_localization_parameters */
+    const size_t minimum_final_constant_dim = 2;
+    /* Degrees too small to leave that much after a round still get the single round {1} */
+    const size_t log_max_tested_degree = libff::log2(max_tested_degree);
+    const size_t num_dimensions_to_reduce = (log_max_tested_degree > 2 + minimum_final_constant_dim) ?
+        log_max_tested_degree - 1 - minimum_final_constant_dim : 1;
+    std::vector<std::vector<size_t>> options =
+        all_localization_vectors(num_dimensions_to_reduce);
+
+    /** The prover time is cheap to predict, while the argument size is not.
+     *  So we rank the options by prover time,
+     *  and return the first one whose argument size is within the budget. */
+    std::vector<double> predicted_seconds(options.size());
+    for (size_t i = 0; i < options.size(); ++i)
+    {
+        prover_cost_prediction prediction;
+        predict_prover_time_and_memory<FieldT>(
+            model, oracle_locality_vector, options[i],
+            codeword_dim, interactive_repetitions, pow_bits, prediction);
+        predicted_seconds[i] = prediction.prover_seconds;
+    }
+    std::vector<size_t> order(options.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&predicted_seconds](const size_t a, const size_t b) {
+            return predicted_seconds[a] < predicted_seconds[b];
+        });
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const size_t argument_size = argument_size_predictor<FieldT>(
+            oracle_locality_vector, options[order[i]], codeword_dim,
+            num_queries, interactive_repetitions, max_tested_degree, model.hash_size_in_bytes);
+        if (argument_size <= max_argument_size_in_bytes)
+        {
+            return options[order[i]];
+        }
+    }
+
+    return {};
+}
+
+template<typename FieldT, typename snark_parameters_type>
+prover_cost_prediction optimize_snark_parameters_for_prover_time(
+    snark_parameters_type &parameters,
+    const prover_cost_model &model,
+    const size_t max_argument_size_in_bytes,
+    const size_t max_RS_extra_dimensions,
+    const size_t max_pow_bits)
+{
+    const size_t original_RS_extra_dimensions = parameters.RS_extra_dimensions_;
+    const pow_parameters original_pow_params = parameters.bcs_params_.pow_params_;
+    const std::vector<size_t> original_localization_parameter_array = parameters.FRI_localization_parameter_array_;
+    const auto restore_original = [&]() {
+        parameters.RS_extra_dimensions_ = original_RS_extra_dimensions;
+        parameters.bcs_params_.pow_params_ = original_pow_params;
+        parameters.FRI_localization_parameter_array_ = original_localization_parameter_array;
+        parameters.initialize_iop_params();
+    };
+
+    /* The proof of work rounds the hash cost down to a power of two, see pow_parameters::pow_bitlen */
+    const size_t cost_per_hash = original_pow_params.cost_per_hash();
+    size_t log_cost_per_hash = libff::log2(cost_per_hash);
+    if ((1ull << log_cost_per_hash) > cost_per_hash)
+    {
+        log_cost_per_hash -= 1;
+    }
+
+    /** Both proven soundness analyses need a rate below 1/2: the LDT reducer's proximity
+     *  parameter is (codeword_domain_size - 2*max_tested_degree) / 2 - 1, and FRI's is
+     *  only positive for rates below 1/3. */
+    const bool proven_soundness =
+        parameters.LDT_reducer_soundness_type_ == LDT_reducer_soundness_type::proven ||
+        parameters.FRI_soundness_type_ == FRI_soundness_type::proven;
+    const size_t min_RS_extra_dimensions = proven_soundness ? 2 : 1;
+
+    bool found = false;
+    prover_cost_prediction best;
+    size_t best_RS_extra_dimensions = 0;
+    pow_parameters best_pow_params;
+    std::vector<size_t> best_localization_parameter_array;
+    try
+    {
+        for (size_t RS_extra_dimensions = min_RS_extra_dimensions;
+             RS_extra_dimensions <= max_RS_extra_dimensions;
+             ++RS_extra_dimensions)
+        {
+            for (size_t pow_bits = 0; pow_bits <= max_pow_bits; ++pow_bits)
+            {
+                /* The proof of work can't supply more than the entire query soundness */
+                const size_t work_parameter = log_cost_per_hash + pow_bits;
+                if (work_parameter > parameters.security_parameter_)
+                {
+                    break;
+                }
+                /* Nor is it worth doing more of it than the fastest parameterization so far takes in total */
+                if (found && exp2((double)pow_bits) * model.compression_hash_seconds >= best.prover_seconds)
+                {
+                    break;
+                }
+
+                /** Any localization vector gives the degree bound, codeword domain and repetition counts
+                 *  the optimizer needs, so we parameterize with the smallest one first. */
+                parameters.RS_extra_dimensions_ = RS_extra_dimensions;
+                parameters.bcs_params_.pow_params_ = pow_parameters(work_parameter, cost_per_hash);
+                parameters.FRI_localization_parameter_array_ = {1};
+                try
+                {
+                    parameters.initialize_iop_params();
+                }
+                catch (const std::invalid_argument &)
+                {
+                    /* Proven soundness is not achievable with this rate and domain, try a lower rate */
+                    break;
+                }
+
+                const size_t codeword_dim = parameters.iop_params_.codeword_domain_dim();
+                const size_t num_queries = parameters.iop_params_.FRI_params_.query_repetitions();
+                const size_t interactive_repetitions = parameters.iop_params_.FRI_params_.interactive_repetitions() *
+                    parameters.iop_params_.LDT_reducer_params_.num_output_LDT_instances();
+                const size_t max_tested_degree = parameters.iop_params_.LDT_reducer_params_.max_tested_degree_bound();
+                const std::vector<size_t> locality_vector = parameters.iop_params_.locality_vector();
+
+                const std::vector<size_t> localization_parameter_array =
+                    compute_prover_time_optimal_localization_parameters<FieldT>(
+                        model, locality_vector, codeword_dim, num_queries, interactive_repetitions,
+                        max_tested_degree, pow_bits, max_argument_size_in_bytes);
+                if (localization_parameter_array.size() == 0)
+                {
+                    continue;
+                }
+                const prover_cost_prediction prediction = prover_cost_predictor<FieldT>(
+                    model, locality_vector, localization_parameter_array, codeword_dim, num_queries,
+                    interactive_repetitions, max_tested_degree, pow_bits);
+                if (!found || prediction.prover_seconds < best.prover_seconds)
+                {
+                    found = true;
+                    best = prediction;
+                    best_RS_extra_dimensions = RS_extra_dimensions;
+                    best_pow_params = parameters.bcs_params_.pow_params_;
+                    best_localization_parameter_array = localization_parameter_array;
+                }
+            }
+        }
+
+        if (!found)
+        {
+            throw std::invalid_argument("No parameterization is predicted to fit in the argument size budget.");
+        }
+
+        parameters.RS_extra_dimensions_ = best_RS_extra_dimensions;
+        parameters.bcs_params_.pow_params_ = best_pow_params;
+        parameters.FRI_localization_parameter_array_ = best_localization_parameter_array;
+        parameters.initialize_iop_params();
+    }
+    catch (...)
+    {
+        restore_original();
+        throw;
+    }
+    return best;
+}
+
+} // namespace libiop
@@ -1,6 +1,8 @@
 #include <cassert>
 #include <stdexcept>
 
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -241,7 +243,7 @@ void LDT_instance_reducer<FieldT, multi_LDT_type>::register_queries()
 template<typename FieldT, typename multi_LDT_type>
 void LDT_instance_reducer<FieldT, multi_LDT_type>::submit_masking_polynomial()
 {
-    libff::enter_block("LDT Reducer: Submit masking polynomial");
+    LIBIOP_TRACE_BEGIN("LDT Reducer: Submit masking polynomial");
     if (this->reducer_params_.make_zk())
     {
         for (size_t i = 0; i < this->reducer_params_.num_output_LDT_instances(); ++i)
@@ -253,13 +255,13 @@ void LDT_instance_reducer<FieldT, multi_LDT_type>::submit_masking_polynomial()
             this->IOP_.submit_oracle(this->blinding_vector_handles_[i], std::move(blinding_oracle));
         }
     }
-    libff::leave_block("LDT Reducer: Submit masking polynomial");
+    LIBIOP_TRACE_END("LDT Reducer: Submit masking polynomial");
 }
 
 template<typename FieldT, typename multi_LDT_type>
 void LDT_instance_reducer<FieldT, multi_LDT_type>::calculate_and_submit_proof()
 {
-    libff::enter_block("LDT Reducer: Calculate and submit proof");
+    LIBIOP_TRACE_BEGIN("LDT Reducer: Calculate and submit proof");
     for (size_t i = 0; i < this->reducer_params_.num_output_LDT_instances(); ++i)
     {
         const std::vector<FieldT> challenge = this->IOP_.obtain_verifier_random_message(
@@ -268,7 +270,7 @@ void LDT_instance_reducer<FieldT, multi_LDT_type>::calculate_and_submit_proof()
     }
 
     this->multi_LDT_->calculate_and_submit_proof();
-    libff::leave_block("LDT Reducer: Calculate and submit proof");
+    LIBIOP_TRACE_END("LDT Reducer: Calculate and submit proof");
 }
 
 template<typename FieldT, typename multi_LDT_type>
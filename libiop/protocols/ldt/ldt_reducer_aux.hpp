@@ -43,7 +43,7 @@ public:
     void set_random_coefficients(const std::vector<FieldT>& random_coefficients);
 
     std::shared_ptr<std::vector<FieldT>> evaluated_contents(
-        const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const;
+        const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const;
 
     FieldT evaluation_at_point(
         const std::size_t evaluation_position,
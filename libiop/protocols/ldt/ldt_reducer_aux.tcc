@@ -38,7 +38,7 @@ void combined_LDT_virtual_oracle<FieldT>::set_random_coefficients(
 
 template<typename FieldT>
 std::shared_ptr<std::vector<FieldT>> combined_LDT_virtual_oracle<FieldT>::evaluated_contents(
-    const std::vector<std::shared_ptr<std::vector<FieldT>>> &constituent_oracle_evaluations) const
+    const std::vector<shared_buffer<FieldT>> &constituent_oracle_evaluations) const
 {
     if (constituent_oracle_evaluations.size() != this->num_input_oracles_)
     {
@@ -46,13 +46,13 @@ std::shared_ptr<std::vector<FieldT>> combined_LDT_virtual_oracle<FieldT>::evalua
     }
 
     std::shared_ptr<std::vector<FieldT>> result = std::make_shared<std::vector<FieldT>>
-        (constituent_oracle_evaluations[0]->size(), FieldT::zero());
+        (constituent_oracle_evaluations[0].size(), FieldT::zero());
 
     /* Handle maximal degree oracles */
     for (size_t i = 0; i < this->maximal_oracle_indices_.size(); i++)
     {
         const size_t index = this->maximal_oracle_indices_[i];
-        if (constituent_oracle_evaluations[index]->size() != result->size())
+        if (constituent_oracle_evaluations[index].size() != result->size())
         {
             throw std::invalid_argument("Vectors of mismatched size.");
         }
@@ -60,7 +60,7 @@ std::shared_ptr<std::vector<FieldT>> combined_LDT_virtual_oracle<FieldT>::evalua
         for (std::size_t j = 0; j < result->size(); ++j)
         {
             result->operator[](j) += this->coefficients_[index] *
-                constituent_oracle_evaluations[index]->operator[](j);
+                constituent_oracle_evaluations[index][j];
         }
     }
 
@@ -95,7 +95,7 @@ std::shared_ptr<std::vector<FieldT>> combined_LDT_virtual_oracle<FieldT>::evalua
                     this->coefficients_[submaximal_oracle_index] +
                     this->coefficients_[this->num_input_oracles_ + i] *
                     bump_factors[j]) *
-                    constituent_oracle_evaluations[submaximal_oracle_index]->operator[](j);
+                    constituent_oracle_evaluations[submaximal_oracle_index][j];
             }
         }
     }
@@ -119,7 +119,7 @@ std::shared_ptr<std::vector<FieldT>> combined_LDT_virtual_oracle<FieldT>::evalua
                 result->operator[](j) += (
                     this->coefficients_[submaximal_oracle_index] +
                     cur_bump_factor) *
-                    constituent_oracle_evaluations[submaximal_oracle_index]->operator[](j);
+                    constituent_oracle_evaluations[submaximal_oracle_index][j];
                 cur_bump_factor *= bump_factor_inc;
             }
         }
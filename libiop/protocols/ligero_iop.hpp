@@ -46,6 +46,9 @@ class ligero_iop_parameters {
     void set_encoded_ligero_interactions(const size_t interactive_soundness_error);
     void set_queries(const size_t query_soundness_error, const size_t max_tested_degree);
     void calculate_encoded_ligero_proximity_parameters(const size_t query_bound);
+    /* Whether L - 2H - 2b + 1 is large enough for a positive proximity parameter */
+    bool codeword_domain_fits_query_bound(const size_t query_bound) const;
+    void increase_codeword_domain_dim();
     void set_soundness_parameters();
     public:
     ligero_iop_parameters(const size_t security_parameter,
@@ -57,7 +60,10 @@ class ligero_iop_parameters {
                           const size_t num_constraints,
                           const size_t num_variables);
     size_t systematic_domain_dim() const;
+    size_t codeword_domain_dim() const;
     size_t RS_extra_dimensions() const;
+    size_t num_oracles_input() const;
+    size_t num_oracle_vectors() const;
     bool make_zk() const;
     field_subset_type domain_type() const;
 
@@ -1,3 +1,6 @@
+#include <libff/common/profiling.hpp>
+#include "libiop/common/tracing.hpp"
+
 namespace libiop {
 
 template<typename FieldT>
@@ -107,6 +110,11 @@ void ligero_iop_parameters<FieldT>::set_queries(const size_t query_soundness_bit
     const long double codeword_domain_size = (long double)(1ull << this->codeword_domain_dim_);
     if (!this->make_zk_) {
         const size_t query_bound = 0;
+        if (!this->codeword_domain_fits_query_bound(query_bound))
+        {
+            this->increase_codeword_domain_dim();
+            return;
+        }
         const size_t query_error_numerator = 2*(1ull << this->systematic_domain_dim_) - 2;
         const long double query_error = ((long double) query_error_numerator) / codeword_domain_size;
         this->calculate_encoded_ligero_proximity_parameters(query_bound);
@@ -136,14 +144,10 @@ void ligero_iop_parameters<FieldT>::set_queries(const size_t query_soundness_bit
         {
             const size_t query_bound = estimated_num_queries + 1;
             const size_t query_error_numerator = 2*(1ull << this->systematic_domain_dim_)+ 2*query_bound - 2;
-            const size_t max_poly_degree = query_error_numerator + 1;
-            if (max_poly_degree > (1ull << this->codeword_domain_dim_))
+            /** This also ensures the max poly degree, query_error_numerator + 1, fits in the codeword domain */
+            if (!this->codeword_domain_fits_query_bound(query_bound))
             {
-                printf("Query bound is too large for codeword domain dimension %lu, \
-increasing codeword domain dimension\n", this->codeword_domain_dim_);
-                this->RS_extra_dimensions_ += 1;
-                this->codeword_domain_dim_ += 1;
-                this->set_soundness_parameters();
+                this->increase_codeword_domain_dim();
                 return;
             }
             /** \epsilon_q in the paper */
@@ -167,6 +171,29 @@ increasing codeword domain dimension\n", this->codeword_domain_dim_);
     }
 }
 
+template<typename FieldT>
+bool ligero_iop_parameters<FieldT>::codeword_domain_fits_query_bound(const size_t query_bound) const
+{
+    /** The min absolute proximity parameter below, ((L - 2H - 2b + 1) / 4) - 1, is at least one
+     *  exactly when L + 1 >= 2H + 2b + 8. This also keeps the query error plus the fractional
+     *  proximity parameter below one. */
+    const size_t codeword_domain_size = 1ull << this->codeword_domain_dim_;
+    return codeword_domain_size + 1 >= 2*(1ull << this->systematic_domain_dim_) + 2*query_bound + 8;
+}
+
+template<typename FieldT>
+void ligero_iop_parameters<FieldT>::increase_codeword_domain_dim()
+{
+    if (!libff::inhibit_profiling_info)
+    {
+        printf("Query bound is too large for codeword domain dimension %lu, \
+increasing codeword domain dimension\n", this->codeword_domain_dim_);
+    }
+    this->RS_extra_dimensions_ += 1;
+    this->codeword_domain_dim_ += 1;
+    this->set_soundness_parameters();
+}
+
 template<typename FieldT>
 void ligero_iop_parameters<FieldT>::calculate_encoded_ligero_proximity_parameters(const size_t query_bound)
 {
@@ -219,11 +246,26 @@ size_t ligero_iop_parameters<FieldT>::systematic_domain_dim() const
     return this->systematic_domain_dim_;
 }
 template<typename FieldT>
+size_t ligero_iop_parameters<FieldT>::codeword_domain_dim() const
+{
+    return this->codeword_domain_dim_;
+}
+template<typename FieldT>
 size_t ligero_iop_parameters<FieldT>::RS_extra_dimensions() const
 {
     return this->RS_extra_dimensions_;
 }
 template<typename FieldT>
+size_t ligero_iop_parameters<FieldT>::num_oracles_input() const
+{
+    return this->num_oracles_input_;
+}
+template<typename FieldT>
+size_t ligero_iop_parameters<FieldT>::num_oracle_vectors() const
+{
+    return this->num_oracle_vectors_;
+}
+template<typename FieldT>
 bool ligero_iop_parameters<FieldT>::make_zk() const
 {
     return this->make_zk_;
@@ -375,13 +417,13 @@ void ligero_iop<FieldT>::produce_proof(const r1cs_primary_input<FieldT> &primary
 template<typename FieldT>
 bool ligero_iop<FieldT>::verifier_predicate(const r1cs_primary_input<FieldT> &primary_input)
 {
-    libff::enter_block("Check Interleaved R1CS verifier predicate");
+    LIBIOP_TRACE_BEGIN("Check Interleaved R1CS verifier predicate");
     bool decision = this->protocol_->verifier_predicate(primary_input);
-    libff::leave_block("Check Interleaved R1CS verifier predicate");
+    LIBIOP_TRACE_END("Check Interleaved R1CS verifier predicate");
 
-    libff::enter_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_BEGIN("Check LDT verifier predicate");
     decision &= this->LDT_reducer_->verifier_predicate();
-    libff::leave_block("Check LDT verifier predicate");
+    LIBIOP_TRACE_END("Check LDT verifier predicate");
 
     return decision;
 }
@@ -145,6 +145,14 @@ public:
     naive_sparse_matrix<FieldT> B_matrix() const;
     naive_sparse_matrix<FieldT> C_matrix() const;
 
+    /** Computes (Az)_i, (Bz)_i and (Cz)_i for constraint i, where z = (1, v, w). */
+    void evaluate_constraint(const std::size_t i,
+                             const r1cs_variable_assignment<FieldT> &z,
+                             FieldT &Az_i,
+                             FieldT &Bz_i,
+                             FieldT &Cz_i) const;
+    /** Appends Az, Bz and Cz to the output vectors, computed in a single sweep over the
+     *  constraints. Rows are split into contiguous blocks across threads. */
     void create_Az_Bz_Cz_from_variable_assignment(
         const r1cs_variable_assignment<FieldT> &variable_assignment,
         std::vector<FieldT> &Az_out,
@@ -123,28 +123,44 @@ bool r1cs_constraint_system<FieldT>::is_satisfied(const r1cs_primary_input<Field
 template<typename FieldT>
 bool r1cs_constraint_system<FieldT>::is_satisfied(const r1cs_variable_assignment<FieldT> &full_variable_assignment) const
 {
-    for (size_t c = 0; c < constraints_.size(); ++c)
+    /* The row kernel expects z = (1, x) */
+    r1cs_variable_assignment<FieldT> z;
+    z.reserve(full_variable_assignment.size() + 1);
+    z.emplace_back(FieldT::one());
+    z.insert(z.end(), full_variable_assignment.begin(), full_variable_assignment.end());
+
+    const size_t num_constraints = constraints_.size();
+    size_t first_unsatisfied = num_constraints;
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static) reduction(min:first_unsatisfied)
+#endif
+    for (size_t c = 0; c < num_constraints; ++c)
     {
-        const FieldT ares = constraints_[c].a_.evaluate(full_variable_assignment);
-        const FieldT bres = constraints_[c].b_.evaluate(full_variable_assignment);
-        const FieldT cres = constraints_[c].c_.evaluate(full_variable_assignment);
-
-        if (!(ares*bres == cres))
+        FieldT ares, bres, cres;
+        this->evaluate_constraint(c, z, ares, bres, cres);
+        if (!(ares*bres == cres) && c < first_unsatisfied)
         {
-#ifdef DEBUG
-            auto it = constraint_annotations_.find(c);
-            printf("constraint %zu (%s) unsatisfied\n", c, (it == constraint_annotations_.end() ? "no annotation" : it->second.c_str()));
-            printf("<a,(1,x)> = "); ares.print();
-            printf("<b,(1,x)> = "); bres.print();
-            printf("<c,(1,x)> = "); cres.print();
-            printf("constraint was:\n");
-            dump_r1cs_constraint(constraints_[c], full_variable_assignment, variable_annotations_);
-#endif // DEBUG
-            return false;
+            first_unsatisfied = c;
         }
     }
 
-    return true;
+    if (first_unsatisfied == num_constraints)
+    {
+        return true;
+    }
+#ifdef DEBUG
+    const size_t c = first_unsatisfied;
+    FieldT ares, bres, cres;
+    this->evaluate_constraint(c, z, ares, bres, cres);
+    auto it = constraint_annotations_.find(c);
+    printf("constraint %zu (%s) unsatisfied\n", c, (it == constraint_annotations_.end() ? "no annotation" : it->second.c_str()));
+    printf("<a,(1,x)> = "); ares.print();
+    printf("<b,(1,x)> = "); bres.print();
+    printf("<c,(1,x)> = "); cres.print();
+    printf("constraint was:\n");
+    dump_r1cs_constraint(constraints_[c], full_variable_assignment, variable_annotations_);
+#endif // DEBUG
+    return false;
 }
 
 template<typename FieldT>
@@ -232,6 +248,32 @@ naive_sparse_matrix<FieldT> r1cs_constraint_system<FieldT>::C_matrix() const
     return matrix;
 }
 
+template<typename FieldT>
+void r1cs_constraint_system<FieldT>::evaluate_constraint(
+    const std::size_t i,
+    const r1cs_variable_assignment<FieldT> &z,
+    FieldT &Az_i,
+    FieldT &Bz_i,
+    FieldT &Cz_i) const
+{
+    const r1cs_constraint<FieldT> &constraint = this->constraints_[i];
+    Az_i = FieldT::zero();
+    for (const linear_term<FieldT> &lt : constraint.a_.terms)
+    {
+        Az_i += z[lt.index_] * lt.coeff_;
+    }
+    Bz_i = FieldT::zero();
+    for (const linear_term<FieldT> &lt : constraint.b_.terms)
+    {
+        Bz_i += z[lt.index_] * lt.coeff_;
+    }
+    Cz_i = FieldT::zero();
+    for (const linear_term<FieldT> &lt : constraint.c_.terms)
+    {
+        Cz_i += z[lt.index_] * lt.coeff_;
+    }
+}
+
 template<typename FieldT>
 void r1cs_constraint_system<FieldT>::create_Az_Bz_Cz_from_variable_assignment(
     const r1cs_variable_assignment<FieldT> &variable_assignment,
@@ -240,28 +282,19 @@ void r1cs_constraint_system<FieldT>::create_Az_Bz_Cz_from_variable_assignment(
     std::vector<FieldT> &Cz_out) const
 {
     /** This assumes variable assignment z is structured as (1, v, w). */
-    for (size_t i = 0; i < this->constraints_.size(); ++i)
+    const size_t num_constraints = this->constraints_.size();
+    const size_t offset = Az_out.size();
+    assert(Bz_out.size() == offset && Cz_out.size() == offset);
+    Az_out.resize(offset + num_constraints);
+    Bz_out.resize(offset + num_constraints);
+    Cz_out.resize(offset + num_constraints);
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < num_constraints; ++i)
     {
-        FieldT Az_i = FieldT::zero();
-        for (auto &lt : this->constraints_[i].a_.terms)
-        {
-            Az_i += variable_assignment[lt.index_] * lt.coeff_;
-        }
-        Az_out.emplace_back(Az_i);
-
-        FieldT Bz_i = FieldT::zero();
-        for (auto &lt : this->constraints_[i].b_.terms)
-        {
-            Bz_i += variable_assignment[lt.index_] * lt.coeff_;
-        }
-        Bz_out.emplace_back(Bz_i);
-
-        FieldT Cz_i = FieldT::zero();
-        for (auto &lt : this->constraints_[i].c_.terms)
-        {
-            Cz_i += variable_assignment[lt.index_] * lt.coeff_;
-        }
-        Cz_out.emplace_back(Cz_i);
+        this->evaluate_constraint(i, variable_assignment,
+            Az_out[offset + i], Bz_out[offset + i], Cz_out[offset + i]);
     }
 }
 
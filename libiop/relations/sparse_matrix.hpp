@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "libiop/relations/r1cs.hpp"
 #include "libiop/relations/variable.hpp"
@@ -22,7 +23,8 @@ class sparse_matrix {
 public:
     sparse_matrix() = default;
 
-    virtual linear_combination<FieldT> get_row(const std::size_t row_index) const = 0;
+    /** The row is owned by the matrix, so callers can read it without copying */
+    virtual const linear_combination<FieldT> &get_row(const std::size_t row_index) const = 0;
     virtual std::size_t num_rows() const = 0;
     virtual std::size_t num_columns() const = 0;
     virtual std::size_t num_nonzero_entries() const = 0;
@@ -48,12 +50,38 @@ public:
         std::shared_ptr<r1cs_constraint_system<FieldT> > constraint_system,
         const r1cs_sparse_matrix_type matrix_type);
 
-    virtual linear_combination<FieldT> get_row(const std::size_t row_index) const;
+    virtual const linear_combination<FieldT> &get_row(const std::size_t row_index) const;
     virtual std::size_t num_rows() const;
     virtual std::size_t num_columns() const;
     virtual std::size_t num_nonzero_entries() const;
 };
 
+/** A sparse matrix stored by columns (CSC): the nonzero entries of column c are
+ *  row_indices_[column_starts_[c] .. column_starts_[c+1]) and the matching values_.
+ *  This is the layout wanted for computing r^T M, since each output entry is then
+ *  a contiguous dot product, and distinct columns can be computed concurrently. */
+template<typename FieldT>
+class compressed_column_matrix {
+protected:
+    std::size_t num_rows_;
+    std::size_t num_columns_;
+    std::vector<std::size_t> column_starts_;
+    std::vector<std::size_t> row_indices_;
+    std::vector<FieldT> values_;
+public:
+    compressed_column_matrix() = default;
+    compressed_column_matrix(const naive_sparse_matrix<FieldT> &matrix,
+                             const std::size_t num_columns);
+
+    std::size_t num_rows() const;
+    std::size_t num_columns() const;
+    std::size_t num_nonzero_entries() const;
+
+    /** Returns r_i^T M for every r_i in vectors, with a single pass over the nonzero entries. */
+    std::vector<std::vector<FieldT>> transpose_multiply(
+        const std::vector<std::vector<FieldT>> &vectors) const;
+};
+
 } // libiop
 
 #include "libiop/relations/sparse_matrix.tcc"
@@ -1,3 +1,4 @@
+#include <map>
 #include <stdexcept>
 
 namespace libiop {
@@ -12,7 +13,7 @@ r1cs_sparse_matrix<FieldT>::r1cs_sparse_matrix(
 }
 
 template<typename FieldT>
-linear_combination<FieldT> r1cs_sparse_matrix<FieldT>::get_row(const std::size_t row_index) const
+const linear_combination<FieldT> &r1cs_sparse_matrix<FieldT>::get_row(const std::size_t row_index) const
 {
     if (row_index >= this->num_rows())
     {
@@ -52,10 +53,103 @@ std::size_t r1cs_sparse_matrix<FieldT>::num_nonzero_entries() const
     size_t total_nonzero_entries = 0;
     for (size_t i = 0; i < this->constraint_system_->num_constraints(); i++)
     {
-        linear_combination<FieldT> row = this->get_row(i);
-        total_nonzero_entries += row.terms.size();
+        total_nonzero_entries += this->get_row(i).terms.size();
     }
     return total_nonzero_entries;
 }
 
+template<typename FieldT>
+compressed_column_matrix<FieldT>::compressed_column_matrix(
+    const naive_sparse_matrix<FieldT> &matrix,
+    const std::size_t num_columns) :
+    num_rows_(matrix.size()),
+    num_columns_(num_columns)
+{
+    /* Count the entries of each column, then place them. Rows are visited in order,
+     * so the row indices within each column come out sorted. */
+    this->column_starts_.resize(num_columns + 1, 0);
+    for (const std::map<std::size_t, FieldT> &row : matrix)
+    {
+        for (const std::pair<const std::size_t, FieldT> &entry : row)
+        {
+            if (entry.first >= num_columns)
+            {
+                throw std::invalid_argument("Sparse matrix entry is out of the column bounds.");
+            }
+            this->column_starts_[entry.first + 1]++;
+        }
+    }
+    for (std::size_t c = 0; c < num_columns; ++c)
+    {
+        this->column_starts_[c + 1] += this->column_starts_[c];
+    }
+
+    const std::size_t num_nonzero = this->column_starts_[num_columns];
+    this->row_indices_.resize(num_nonzero);
+    this->values_.resize(num_nonzero);
+    std::vector<std::size_t> next_position(this->column_starts_.begin(), this->column_starts_.end() - 1);
+    for (std::size_t i = 0; i < matrix.size(); ++i)
+    {
+        for (const std::pair<const std::size_t, FieldT> &entry : matrix[i])
+        {
+            const std::size_t position = next_position[entry.first]++;
+            this->row_indices_[position] = i;
+            this->values_[position] = entry.second;
+        }
+    }
+}
+
+template<typename FieldT>
+std::size_t compressed_column_matrix<FieldT>::num_rows() const
+{
+    return this->num_rows_;
+}
+
+template<typename FieldT>
+std::size_t compressed_column_matrix<FieldT>::num_columns() const
+{
+    return this->num_columns_;
+}
+
+template<typename FieldT>
+std::size_t compressed_column_matrix<FieldT>::num_nonzero_entries() const
+{
+    return this->values_.size();
+}
+
+template<typename FieldT>
+std::vector<std::vector<FieldT>> compressed_column_matrix<FieldT>::transpose_multiply(
+    const std::vector<std::vector<FieldT>> &vectors) const
+{
+    for (const std::vector<FieldT> &v : vectors)
+    {
+        if (v.size() != this->num_rows_)
+        {
+            throw std::invalid_argument("Vector length does not match the number of matrix rows.");
+        }
+    }
+
+    const std::size_t num_vectors = vectors.size();
+    std::vector<std::vector<FieldT>> result(
+        num_vectors, std::vector<FieldT>(this->num_columns_, FieldT::zero()));
+    /* Each column is written by exactly one thread, and static scheduling
+     * hands each thread a contiguous block of columns. */
+#ifdef MULTICORE
+#pragma omp parallel for schedule(static)
+#endif
+    for (std::size_t c = 0; c < this->num_columns_; ++c)
+    {
+        for (std::size_t k = this->column_starts_[c]; k < this->column_starts_[c + 1]; ++k)
+        {
+            const std::size_t row = this->row_indices_[k];
+            const FieldT &value = this->values_[k];
+            for (std::size_t h = 0; h < num_vectors; ++h)
+            {
+                result[h][c] += vectors[h][row] * value;
+            }
+        }
+    }
+    return result;
+}
+
 } // libiop
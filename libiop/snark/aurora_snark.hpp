@@ -14,6 +14,7 @@
 
 #include "libiop/protocols/aurora_iop.hpp"
 #include "libiop/protocols/ldt/fri/fri_ldt.hpp"
+#include "libiop/protocols/ldt/fri/prover_time_optimizer.hpp"
 #include "libiop/protocols/ldt/ldt_reducer.hpp"
 #include "libiop/bcs/bcs_common.hpp"
 #include "libiop/bcs/bcs_prover.hpp"
@@ -39,6 +40,14 @@ class aurora_snark_parameters {
 
     void initialize_bcs_params(const bcs_hash_type hash_enum);
     void initialize_iop_params();
+
+    template<typename OptimizerFieldT, typename snark_parameters_type>
+    friend prover_cost_prediction optimize_snark_parameters_for_prover_time(
+        snark_parameters_type &parameters,
+        const prover_cost_model &model,
+        const size_t max_argument_size_in_bytes,
+        const size_t max_RS_extra_dimensions,
+        const size_t max_pow_bits);
     public:
     aurora_snark_parameters(const size_t security_parameter,
                             const LDT_reducer_soundness_type ldt_reducer_soundness_type,
@@ -63,6 +72,17 @@ class aurora_snark_parameters {
                             const size_t num_variables);
 
     void reset_fri_localization_parameters(const std::vector<size_t> FRI_localization_parameter_array);
+    /** Re-parameterizes with the RS extra dimensions (1 to max_RS_extra_dimensions,
+     *  or from 2 under proven soundness),
+     *  proof of work bits (0 to max_pow_bits) and FRI localization vector that have the
+     *  smallest predicted prover time, among those whose predicted argument size is at most
+     *  max_argument_size_in_bytes. Returns the prediction for the chosen parameterization.
+     *  Throws std::invalid_argument, and leaves the parameters unchanged, if none fit the budget.
+     *  See optimize_snark_parameters_for_prover_time. */
+    prover_cost_prediction optimize_for_prover_time(const prover_cost_model &model,
+                                                    const size_t max_argument_size_in_bytes,
+                                                    const size_t max_RS_extra_dimensions = 4,
+                                                    const size_t max_pow_bits = 24);
     void print() const;
 
     bcs_transformation_parameters<FieldT, hash_type> bcs_params_;
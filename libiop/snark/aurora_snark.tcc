@@ -1,4 +1,6 @@
 #include <libff/common/profiling.hpp>
+#include "libiop/common/proof_arena.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/bcs/bcs_common.hpp"
@@ -70,6 +72,17 @@ void aurora_snark_parameters<FieldT, hash_type>::reset_fri_localization_paramete
 }
 
 
+template<typename FieldT, typename hash_type>
+prover_cost_prediction aurora_snark_parameters<FieldT, hash_type>::optimize_for_prover_time(
+    const prover_cost_model &model,
+    const size_t max_argument_size_in_bytes,
+    const size_t max_RS_extra_dimensions,
+    const size_t max_pow_bits)
+{
+    return optimize_snark_parameters_for_prover_time<FieldT>(
+        *this, model, max_argument_size_in_bytes, max_RS_extra_dimensions, max_pow_bits);
+}
+
 template<typename FieldT, typename hash_type>
 void aurora_snark_parameters<FieldT, hash_type>::initialize_iop_params()
 {
@@ -112,6 +125,8 @@ void aurora_snark_parameters<FieldT, hash_type>::print() const
         FRI_soundness_type_to_string(FRI_soundness_type_));
     libff::print_indent(); printf("* zero-knowledge = %s\n", make_zk_ ? "true" : "false");
     libff::print_indent(); printf("* domain type = %s\n", field_subset_type_names[this->domain_type_]);
+    libff::print_indent(); printf("* oracle pages = %s\n",
+        oracle_page_policy_to_string(this->bcs_params_.oracle_page_policy_));
 
     this->iop_params_.print();
 }
@@ -123,7 +138,10 @@ aurora_snark_argument<FieldT, hash_type> aurora_snark_prover(
     const r1cs_auxiliary_input<FieldT> &auxiliary_input,
     const aurora_snark_parameters<FieldT, hash_type> &parameters)
 {
-    libff::enter_block("Aurora SNARK prover");
+    /* The temporaries of the proof come from one arena, released on return */
+    const scoped_proof_arena arena;
+    const scoped_oracle_page_policy page_policy(parameters.bcs_params_.oracle_page_policy_);
+    LIBIOP_TRACE_BEGIN("Aurora SNARK prover");
     parameters.print();
 
     bcs_prover<FieldT, hash_type> IOP(parameters.bcs_params_);
@@ -135,13 +153,13 @@ aurora_snark_argument<FieldT, hash_type> aurora_snark_prover(
 
     full_protocol.produce_proof(primary_input, auxiliary_input);
 
-    libff::enter_block("Obtain transcript");
+    LIBIOP_TRACE_BEGIN("Obtain transcript");
     const aurora_snark_argument<FieldT, hash_type> transcript = IOP.get_transcript();
-    libff::leave_block("Obtain transcript");
+    LIBIOP_TRACE_END("Obtain transcript");
 
     IOP.describe_sizes();
 
-    libff::leave_block("Aurora SNARK prover");
+    LIBIOP_TRACE_END("Aurora SNARK prover");
     return transcript;
 }
 
@@ -151,29 +169,29 @@ bool aurora_snark_verifier(const r1cs_constraint_system<FieldT> &constraint_syst
                            const aurora_snark_argument<FieldT, hash_type> &proof,
                            const aurora_snark_parameters<FieldT, hash_type> &parameters)
 {
-    libff::enter_block("Aurora SNARK verifier");
+    LIBIOP_TRACE_BEGIN("Aurora SNARK verifier");
     parameters.print();
 
     bcs_verifier<FieldT, hash_type> IOP(parameters.bcs_params_, proof);
 
-    libff::enter_block("Aurora IOP protocol initialization and registration");
+    LIBIOP_TRACE_BEGIN("Aurora IOP protocol initialization and registration");
     aurora_iop<FieldT> full_protocol(IOP, constraint_system, parameters.iop_params_);
     full_protocol.register_interactions();
     IOP.seal_interaction_registrations();
     full_protocol.register_queries();
     IOP.seal_query_registrations();
-    libff::leave_block("Aurora IOP protocol initialization and registration");
+    LIBIOP_TRACE_END("Aurora IOP protocol initialization and registration");
 
-    libff::enter_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_BEGIN("Check semantic validity of IOP transcript");
     const bool IOP_transcript_valid = IOP.transcript_is_valid();
-    libff::leave_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_END("Check semantic validity of IOP transcript");
 
     const bool full_protocol_accepts = full_protocol.verifier_predicate(primary_input);
 
     libff::print_indent(); printf("* IOP transcript valid: %s\n", IOP_transcript_valid ? "true" : "false");
     libff::print_indent(); printf("* Full protocol decision predicate satisfied: %s\n", full_protocol_accepts ? "true" : "false");
     const bool decision = IOP_transcript_valid && full_protocol_accepts;
-    libff::leave_block("Aurora SNARK verifier");
+    LIBIOP_TRACE_END("Aurora SNARK verifier");
 
     return decision;
 }
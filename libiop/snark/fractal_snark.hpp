@@ -14,9 +14,11 @@
 
 #include "libiop/protocols/fractal_hiop.hpp"
 #include "libiop/protocols/ldt/fri/fri_ldt.hpp"
+#include "libiop/protocols/ldt/fri/prover_time_optimizer.hpp"
 #include "libiop/protocols/ldt/ldt_reducer.hpp"
 #include "libiop/bcs/bcs_common.hpp"
 #include "libiop/bcs/bcs_indexer.hpp"
+#include "libiop/bcs/bcs_index_serialization.hpp"
 #include "libiop/bcs/bcs_prover.hpp"
 #include "libiop/bcs/bcs_verifier.hpp"
 #include "libiop/relations/r1cs.hpp"
@@ -39,6 +41,14 @@ class fractal_snark_parameters {
 
     void initialize_bcs_params(const bcs_hash_type hash_enum);
     void initialize_iop_params();
+
+    template<typename OptimizerFieldT, typename snark_parameters_type>
+    friend prover_cost_prediction optimize_snark_parameters_for_prover_time(
+        snark_parameters_type &parameters,
+        const prover_cost_model &model,
+        const size_t max_argument_size_in_bytes,
+        const size_t max_RS_extra_dimensions,
+        const size_t max_pow_bits);
     public:
     fractal_snark_parameters(
         const size_t security_parameter,
@@ -63,6 +73,17 @@ class fractal_snark_parameters {
         const std::shared_ptr<r1cs_constraint_system<FieldT>> constraint_system);
 
     void reset_fri_localization_parameters(const std::vector<size_t> FRI_localization_parameter_array);
+    /** Re-parameterizes with the RS extra dimensions (1 to max_RS_extra_dimensions,
+     *  or from 2 under proven soundness),
+     *  proof of work bits (0 to max_pow_bits) and FRI localization vector that have the
+     *  smallest predicted prover time, among those whose predicted argument size is at most
+     *  max_argument_size_in_bytes. Returns the prediction for the chosen parameterization.
+     *  Throws std::invalid_argument, and leaves the parameters unchanged, if none fit the budget.
+     *  See optimize_snark_parameters_for_prover_time. */
+    prover_cost_prediction optimize_for_prover_time(const prover_cost_model &model,
+                                                    const size_t max_argument_size_in_bytes,
+                                                    const size_t max_RS_extra_dimensions = 4,
+                                                    const size_t max_pow_bits = 24);
     void print() const;
 
     bcs_transformation_parameters<FieldT, hash_type> bcs_params_;
@@ -77,11 +98,12 @@ std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_t
 fractal_snark_indexer(
     const fractal_snark_parameters<FieldT, hash_type> &parameters);
 
-/** This mutates the bcs_prover_index.
- *  It is expected that the end user makes a copy before passing it in here */
+/** The prover index is only read, and the proof shares its Merkle trees and
+ *  oracle evaluations rather than copying them. So one index can be used for
+ *  many proofs, including concurrent ones. */
 template<typename FieldT, typename hash_type>
 fractal_snark_argument<FieldT, hash_type> fractal_snark_prover(
-    bcs_prover_index<FieldT, hash_type> &index,
+    const bcs_prover_index<FieldT, hash_type> &index,
     const r1cs_primary_input<FieldT> &primary_input,
     const r1cs_auxiliary_input<FieldT> &auxiliary_input,
     const fractal_snark_parameters<FieldT, hash_type> &parameters);
@@ -1,4 +1,6 @@
 #include <libff/common/profiling.hpp>
+#include "libiop/common/proof_arena.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/bcs/bcs_common.hpp"
@@ -66,6 +68,17 @@ void fractal_snark_parameters<FieldT, hash_type>::reset_fri_localization_paramet
 }
 
 
+template<typename FieldT, typename hash_type>
+prover_cost_prediction fractal_snark_parameters<FieldT, hash_type>::optimize_for_prover_time(
+    const prover_cost_model &model,
+    const size_t max_argument_size_in_bytes,
+    const size_t max_RS_extra_dimensions,
+    const size_t max_pow_bits)
+{
+    return optimize_snark_parameters_for_prover_time<FieldT>(
+        *this, model, max_argument_size_in_bytes, max_RS_extra_dimensions, max_pow_bits);
+}
+
 template<typename FieldT, typename hash_type>
 void fractal_snark_parameters<FieldT, hash_type>::initialize_iop_params()
 {
@@ -107,6 +120,8 @@ void fractal_snark_parameters<FieldT, hash_type>::print() const
         FRI_soundness_type_to_string(FRI_soundness_type_));
     libff::print_indent(); printf("* zero-knowledge = %s\n", make_zk_ ? "true" : "false");
     libff::print_indent(); printf("* domain type = %s\n", field_subset_type_names[this->domain_type_]);
+    libff::print_indent(); printf("* oracle pages = %s\n",
+        oracle_page_policy_to_string(this->bcs_params_.oracle_page_policy_));
 
     this->iop_params_.print();
 }
@@ -116,7 +131,10 @@ std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_t
 fractal_snark_indexer(
     const fractal_snark_parameters<FieldT, hash_type> &parameters)
 {
-    libff::enter_block("Fractal SNARK indexer");
+    /* The temporaries of indexing come from one arena, released on return */
+    const scoped_proof_arena arena;
+    const scoped_oracle_page_policy page_policy(parameters.bcs_params_.oracle_page_policy_);
+    LIBIOP_TRACE_BEGIN("Fractal SNARK indexer");
     parameters.print();
     bcs_indexer<FieldT, hash_type> IOP(parameters.bcs_params_);
     fractal_iop<FieldT> full_protocol(IOP, parameters.iop_params_);
@@ -128,18 +146,21 @@ fractal_snark_indexer(
     bcs_verifier_index<FieldT, hash_type> verifier_index = IOP.get_verifier_index();
     std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
         std::make_pair(std::move(prover_index), verifier_index);
-    libff::leave_block("Fractal SNARK indexer");
+    LIBIOP_TRACE_END("Fractal SNARK indexer");
     return index;
 }
 
 template<typename FieldT, typename hash_type>
 fractal_snark_argument<FieldT, hash_type> fractal_snark_prover(
-    bcs_prover_index<FieldT, hash_type> &index,
+    const bcs_prover_index<FieldT, hash_type> &index,
     const r1cs_primary_input<FieldT> &primary_input,
     const r1cs_auxiliary_input<FieldT> &auxiliary_input,
     const fractal_snark_parameters<FieldT, hash_type> &parameters)
 {
-    libff::enter_block("Fractal SNARK prover");
+    /* The temporaries of the proof come from one arena, released on return */
+    const scoped_proof_arena arena;
+    const scoped_oracle_page_policy page_policy(parameters.bcs_params_.oracle_page_policy_);
+    LIBIOP_TRACE_BEGIN("Fractal SNARK prover");
     parameters.print();
 
     bcs_prover<FieldT, hash_type> IOP(parameters.bcs_params_, index);
@@ -151,13 +172,13 @@ fractal_snark_argument<FieldT, hash_type> fractal_snark_prover(
 
     full_protocol.produce_proof(primary_input, auxiliary_input, index.iop_index_);
 
-    libff::enter_block("Obtain transcript");
+    LIBIOP_TRACE_BEGIN("Obtain transcript");
     const fractal_snark_argument<FieldT, hash_type> transcript = IOP.get_transcript();
-    libff::leave_block("Obtain transcript");
+    LIBIOP_TRACE_END("Obtain transcript");
 
     IOP.describe_sizes();
 
-    libff::leave_block("Fractal SNARK prover");
+    LIBIOP_TRACE_END("Fractal SNARK prover");
     return transcript;
 }
 
@@ -168,29 +189,29 @@ bool fractal_snark_verifier(
     const fractal_snark_argument<FieldT, hash_type> &proof,
     const fractal_snark_parameters<FieldT, hash_type> &parameters)
 {
-    libff::enter_block("Fractal SNARK verifier");
+    LIBIOP_TRACE_BEGIN("Fractal SNARK verifier");
     parameters.print();
 
     bcs_verifier<FieldT, hash_type> IOP(parameters.bcs_params_, proof, index);
 
-    libff::enter_block("Fractal IOP protocol initialization and registration");
+    LIBIOP_TRACE_BEGIN("Fractal IOP protocol initialization and registration");
     fractal_iop<FieldT> full_protocol(IOP, parameters.iop_params_);
     full_protocol.register_interactions();
     IOP.seal_interaction_registrations();
     full_protocol.register_queries();
     IOP.seal_query_registrations();
-    libff::leave_block("Fractal IOP protocol initialization and registration");
+    LIBIOP_TRACE_END("Fractal IOP protocol initialization and registration");
 
-    libff::enter_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_BEGIN("Check semantic validity of IOP transcript");
     const bool IOP_transcript_valid = IOP.transcript_is_valid();
-    libff::leave_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_END("Check semantic validity of IOP transcript");
 
     const bool full_protocol_accepts = full_protocol.verifier_predicate(primary_input);
 
     libff::print_indent(); printf("* IOP transcript valid: %s\n", IOP_transcript_valid ? "true" : "false");
     libff::print_indent(); printf("* Full protocol decision predicate satisfied: %s\n", full_protocol_accepts ? "true" : "false");
     const bool decision = IOP_transcript_valid && full_protocol_accepts;
-    libff::leave_block("Fractal SNARK verifier");
+    LIBIOP_TRACE_END("Fractal SNARK verifier");
 
     return decision;
 }
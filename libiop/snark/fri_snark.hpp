@@ -33,6 +33,8 @@ struct FRI_snark_parameters {
 
     libff::field_type field_type_;
 
+    oracle_page_policy oracle_page_policy_ = oracle_page_policy::default_pages;
+
     void describe();
 };
 
@@ -1,4 +1,6 @@
 #include <libff/common/profiling.hpp>
+#include "libiop/common/proof_arena.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/protocols/fri_iop.hpp"
@@ -16,6 +18,7 @@ void FRI_snark_parameters<FieldT>::describe()
     libff::print_indent(); printf("* Localization parameter: %zu\n", localization_parameter_);
     libff::print_indent(); printf("* Localization parameter array: %zu\n", localization_parameter_array_);
     libff::print_indent(); printf("* Num query repetitions: %zu\n", num_query_repetitions_);
+    libff::print_indent(); printf("* Oracle pages: %s\n", oracle_page_policy_to_string(oracle_page_policy_));
 }
 
 template<typename FieldT, typename hash_type>
@@ -26,6 +29,7 @@ obtain_bcs_and_FRI_parameters_from_FRI_snark_parameters(const FRI_snark_paramete
     bcs_transformation_parameters<FieldT, hash_type> bcs_parameters =
         default_bcs_params<FieldT, hash_type>(
             parameters.hash_enum_, parameters.security_level_, parameters.codeword_domain_dim_);
+    bcs_parameters.oracle_page_policy_ = parameters.oracle_page_policy_;
 
     FRI_iop_protocol_parameters FRI_parameters;
     FRI_parameters.RS_extra_dimensions_ = parameters.RS_extra_dimensions_;
@@ -43,7 +47,10 @@ obtain_bcs_and_FRI_parameters_from_FRI_snark_parameters(const FRI_snark_paramete
 template<typename FieldT, typename hash_type>
 FRI_snark_proof<FieldT, hash_type> FRI_snark_prover(const FRI_snark_parameters<FieldT> &parameters)
 {
-    libff::enter_block("FRI SNARK prover");
+    /* The temporaries of the proof come from one arena, released on return */
+    const scoped_proof_arena arena;
+    const scoped_oracle_page_policy page_policy(parameters.oracle_page_policy_);
+    LIBIOP_TRACE_BEGIN("FRI SNARK prover");
     const std::pair<bcs_transformation_parameters<FieldT, hash_type>,
                     FRI_iop_protocol_parameters>
         bcs_and_FRI_parameters =
@@ -62,17 +69,17 @@ FRI_snark_proof<FieldT, hash_type> FRI_snark_prover(const FRI_snark_parameters<F
 
     full_protocol.produce_proof();
 
-    libff::enter_block("Obtain transcript");
-    libff::enter_block("Run verifier to populate virtual oracle data structures");
+    LIBIOP_TRACE_BEGIN("Obtain transcript");
+    LIBIOP_TRACE_BEGIN("Run verifier to populate virtual oracle data structures");
     full_protocol.verifier_predicate();
-    libff::leave_block("Run verifier to populate virtual oracle data structures");
+    LIBIOP_TRACE_END("Run verifier to populate virtual oracle data structures");
 
     const FRI_snark_proof<FieldT, hash_type> transcript = IOP.get_transcript();
-    libff::leave_block("Obtain transcript");
+    LIBIOP_TRACE_END("Obtain transcript");
 
     IOP.describe_sizes();
 
-    libff::leave_block("FRI SNARK prover");
+    LIBIOP_TRACE_END("FRI SNARK prover");
     return transcript;
 }
 
@@ -80,7 +87,7 @@ template<typename FieldT, typename hash_type>
 bool FRI_snark_verifier(const FRI_snark_proof<FieldT, hash_type> &proof,
                         const FRI_snark_parameters<FieldT> &parameters)
 {
-    libff::enter_block("FRI SNARK verifier");
+    LIBIOP_TRACE_BEGIN("FRI SNARK verifier");
     const std::pair<bcs_transformation_parameters<FieldT, hash_type>,
                     FRI_iop_protocol_parameters>
         bcs_and_FRI_parameters =
@@ -97,16 +104,16 @@ bool FRI_snark_verifier(const FRI_snark_proof<FieldT, hash_type> &proof,
     full_protocol.register_queries();
     IOP.seal_query_registrations();
 
-    libff::enter_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_BEGIN("Check semantic validity of IOP transcript");
     const bool IOP_transcript_valid = IOP.transcript_is_valid();
-    libff::leave_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_END("Check semantic validity of IOP transcript");
 
     const bool full_protocol_accepts = full_protocol.verifier_predicate();
 
     libff::print_indent(); printf("* IOP transcript valid: %s\n", IOP_transcript_valid ? "true" : "false");
     libff::print_indent(); printf("* Full protocol decision predicate satisfied: %s\n", full_protocol_accepts ? "true" : "false");
     const bool decision = IOP_transcript_valid && full_protocol_accepts;
-    libff::leave_block("FRI SNARK verifier");
+    LIBIOP_TRACE_END("FRI SNARK verifier");
 
     return decision;
 }
@@ -14,6 +14,7 @@
 
 #include <libff/algebra/field_utils/field_utils.hpp>
 #include "libiop/protocols/ligero_iop.hpp"
+#include "libiop/protocols/ldt/fri/prover_time_optimizer.hpp"
 #include "libiop/relations/r1cs.hpp"
 #include "libiop/bcs/bcs_common.hpp"
 #include "libiop/bcs/bcs_prover.hpp"
@@ -22,6 +23,30 @@
 
 namespace libiop {
 
+/** What optimize_matrix_shape minimizes */
+enum class ligero_objective {
+    prover_time = 1,
+    argument_size = 2,
+    verifier_time = 3,
+};
+
+inline const char* ligero_objective_to_string(const ligero_objective objective)
+{
+    switch (objective)
+    {
+        case ligero_objective::prover_time: return "prover time";
+        case ligero_objective::argument_size: return "argument size";
+        case ligero_objective::verifier_time: return "verifier time";
+    }
+    return "unknown";
+}
+
+struct ligero_cost_prediction {
+    double prover_seconds = 0;
+    double verifier_seconds = 0;
+    size_t argument_size_bytes = 0;
+};
+
 template<typename FieldT, typename MT_root_hash>
 struct ligero_snark_parameters {
     size_t security_level_;
@@ -32,9 +57,36 @@ struct ligero_snark_parameters {
     field_subset_type domain_type_;
     bcs_transformation_parameters<FieldT, MT_root_hash> bcs_params_;
 
+    /** Chooses height_width_ratio_ and RS_extra_dimensions_ for an R1CS instance of the given size.
+     *  Every power of two row length (systematic domain size) up to the number of variables
+     *  is tried with 2 to max_RS_extra_dimensions extra dimensions, or more if the queries need them,
+     *  and the shape whose predicted cost is smallest for the objective is kept.
+     *  All other fields must be set beforehand, as they affect the number of queries and repetitions. */
+    ligero_cost_prediction optimize_matrix_shape(const prover_cost_model &model,
+                                                 const ligero_objective objective,
+                                                 const size_t num_constraints,
+                                                 const size_t num_variables,
+                                                 const size_t max_RS_extra_dimensions = 4);
+
+    /* Set by optimize_matrix_shape, and reported by describe */
+    bool matrix_shape_optimized_ = false;
+    ligero_objective objective_ = ligero_objective::prover_time;
+    ligero_cost_prediction predicted_costs_;
+
     void describe();
 };
 
+/** Predicts the prover time, verifier time and argument size of the Ligero SNARK
+ *  with the given IOP parameters, from the host throughputs in model.
+ *  Only the costs that depend on the matrix shape are counted:
+ *  the row encodings, the Merkle tree over the codeword domain, the encoded protocol's
+ *  response polynomials, and the direct LDT. The sparse matrix-vector products of
+ *  lincheck take the same time for every shape and are left out.
+ *  Field operations outside of FFTs are priced as one element of one FFT level. */
+template<typename FieldT>
+ligero_cost_prediction ligero_cost_predictor(const prover_cost_model &model,
+                                             const ligero_iop_parameters<FieldT> &iop_params);
+
 template<typename FieldT, typename MT_root_hash>
 using ligero_snark_argument = bcs_transformation_transcript<FieldT, MT_root_hash>;
 
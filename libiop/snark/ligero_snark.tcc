@@ -1,4 +1,10 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include <libff/common/profiling.hpp>
+#include "libiop/common/proof_arena.hpp"
+#include "libiop/common/tracing.hpp"
 #include <libff/common/utils.hpp>
 #include "libiop/algebra/field_subset/subspace.hpp"
 #include "libiop/bcs/bcs_common.hpp"
@@ -15,6 +21,171 @@ void ligero_snark_parameters<FieldT, MT_root_hash>::describe()
     libff::print_indent(); printf("RS extra dimensions: %zu\n", RS_extra_dimensions_);
     libff::print_indent(); printf("Zero-knowledge: %d\n", make_zk_);
     libff::print_indent(); printf("Domain type = %s\n", field_subset_type_names[this->domain_type_]);
+    if (this->matrix_shape_optimized_)
+    {
+        libff::print_indent(); printf("Matrix shape optimized for: %s\n", ligero_objective_to_string(this->objective_));
+        libff::print_indent(); printf("Predicted prover time: %f s\n", this->predicted_costs_.prover_seconds);
+        libff::print_indent(); printf("Predicted verifier time: %f s\n", this->predicted_costs_.verifier_seconds);
+        libff::print_indent(); printf("Predicted argument size: %zu bytes\n", this->predicted_costs_.argument_size_bytes);
+    }
+}
+
+template<typename FieldT>
+ligero_cost_prediction ligero_cost_predictor(const prover_cost_model &model,
+                                             const ligero_iop_parameters<FieldT> &iop_params)
+{
+    const size_t field_size_in_bits = libff::log_of_field_size_helper<FieldT>(FieldT::zero());
+    const double field_size_in_bytes = (double)((field_size_in_bits + 7) / 8);
+    const double op_seconds = model.FFT_seconds_per_element_level;
+
+    const size_t systematic_dim = iop_params.systematic_domain_dim();
+    const size_t codeword_dim = iop_params.codeword_domain_dim();
+    const double systematic_size = exp2((double)systematic_dim);
+    const double codeword_size = exp2((double)codeword_dim);
+
+    const size_t num_interactions = iop_params.encoded_ligero_params_.num_interaction_phase_repetitions_;
+    const size_t num_LDT_instances = iop_params.ldt_reducer_params_.num_output_LDT_instances();
+    const size_t num_queries = iop_params.encoded_ligero_params_.num_query_phase_repetitions_ +
+        iop_params.direct_ldt_params_.num_queries();
+    /** The w rows, and the a, b and c rows, each of which is one oracle.
+     *  With zero knowledge there are also four blinding oracles per interaction,
+     *  three over the systematic domain and one over the extended systematic domain. */
+    const size_t num_rows = iop_params.num_oracles_input() + 3 * iop_params.num_oracle_vectors();
+    const size_t num_blinding_rows = iop_params.make_zk() ? 4 * num_interactions : 0;
+    const size_t num_oracles = num_rows + num_blinding_rows;
+    /* Three lincheck and one rowcheck response per interaction, of twice the systematic domain size */
+    const double num_response_elements = 4.0 * num_interactions * 2.0 * systematic_size;
+
+    ligero_cost_prediction prediction;
+
+    /** Prover: low degree extend every row, hash the oracles into one Merkle tree
+     *  whose leaves are the codeword positions, take the random linear combinations of
+     *  rows for each response, and have the LDT reducer combine and interpolate every oracle. */
+    double prover_seconds = num_oracles *
+        (systematic_size * systematic_dim + codeword_size * codeword_dim) * op_seconds;
+    prover_seconds += num_oracles * codeword_size * model.leaf_hash_seconds_per_element;
+    prover_seconds += (codeword_size - 1) * model.compression_hash_seconds;
+    prover_seconds += num_interactions * 4.0 * num_rows * 2.0 * systematic_size * op_seconds;
+    prover_seconds += num_LDT_instances * (num_oracles + codeword_dim) * codeword_size * op_seconds;
+    prediction.prover_seconds = prover_seconds;
+
+    /** Argument: every queried position opens a column of all oracles, with the pruned
+     *  authentication paths, and the responses and direct LDT polynomials are sent in the clear. */
+    const size_t num_path_hashes = num_hashes_in_a_membership_proof(num_queries, codeword_dim);
+    double argument_size = num_queries * num_oracles * field_size_in_bytes;
+    argument_size += (num_path_hashes + 1) * model.hash_size_in_bytes;
+    argument_size += num_response_elements * field_size_in_bytes;
+    argument_size += num_LDT_instances * iop_params.direct_ldt_params_.poly_degree_bound() * field_size_in_bytes;
+    prediction.argument_size_bytes = (size_t)argument_size;
+
+    /** Verifier: hash the opened columns and recompute the authentication paths, check each
+     *  response against the columns it combines, evaluate each response at every query,
+     *  and check the direct LDT polynomials at every query. */
+    double verifier_seconds = num_queries * num_oracles * model.leaf_hash_seconds_per_element;
+    verifier_seconds += (num_queries + num_path_hashes) * model.compression_hash_seconds;
+    verifier_seconds += num_response_elements * op_seconds;
+    verifier_seconds += num_interactions * 4.0 * num_queries * (num_rows + 2.0 * systematic_size) * op_seconds;
+    verifier_seconds += num_LDT_instances * num_queries *
+        (num_oracles + iop_params.direct_ldt_params_.poly_degree_bound()) * op_seconds;
+    prediction.verifier_seconds = verifier_seconds;
+
+    return prediction;
+}
+
+template<typename FieldT, typename MT_root_hash>
+ligero_cost_prediction ligero_snark_parameters<FieldT, MT_root_hash>::optimize_matrix_shape(
+    const prover_cost_model &model,
+    const ligero_objective objective,
+    const size_t num_constraints,
+    const size_t num_variables,
+    const size_t max_RS_extra_dimensions)
+{
+    const auto cost = [objective](const ligero_cost_prediction &prediction) -> double {
+        switch (objective)
+        {
+            case ligero_objective::prover_time: return prediction.prover_seconds;
+            case ligero_objective::argument_size: return (double)prediction.argument_size_bytes;
+            case ligero_objective::verifier_time: return prediction.verifier_seconds;
+        }
+        throw std::invalid_argument("Unknown Ligero objective.");
+    };
+
+    /** The systematic domain size is the row length, i.e. the matrix width over the number of
+     *  input oracles, and ligero_iop_parameters derives it from the ratio as
+     *      round_to_next_power_of_2(ceil(sqrt((num_variables + 1) / height_width_ratio))).
+     *  So a ratio of (num_variables + 1) / (size - 1/2)^2 selects exactly the power of two size,
+     *  with a margin of 1/2 for the float arithmetic. */
+    const size_t num_vars = num_variables + 1;
+    const size_t max_systematic_dim = libff::log2(num_vars);
+    /** With one extra dimension the codeword domain has no room for Ligero's proximity parameter,
+     *  so ligero_iop_parameters would always add another. */
+    const size_t min_RS_extra_dimensions = 2;
+
+    /** ligero_iop_parameters reports every extra dimension it adds to fit the queries,
+     *  which would be once per candidate here. */
+    const bool inhibit_profiling_info = libff::inhibit_profiling_info;
+    libff::inhibit_profiling_info = true;
+
+    bool found = false;
+    float best_height_width_ratio = 0;
+    size_t best_RS_extra_dimensions = 0;
+    ligero_cost_prediction best;
+    try
+    {
+        for (size_t systematic_dim = 1; systematic_dim <= max_systematic_dim; ++systematic_dim)
+        {
+            const double target_size = exp2((double)systematic_dim) - 0.5;
+            const float height_width_ratio = (float)(num_vars / (target_size * target_size));
+            for (size_t RS_extra_dimensions = min_RS_extra_dimensions;
+                 RS_extra_dimensions <= max_RS_extra_dimensions;
+                 ++RS_extra_dimensions)
+            {
+                const ligero_iop_parameters<FieldT> iop_params(
+                    this->security_level_,
+                    this->LDT_reducer_soundness_type_,
+                    RS_extra_dimensions,
+                    height_width_ratio,
+                    this->make_zk_,
+                    this->domain_type_,
+                    num_constraints,
+                    num_variables);
+                if (iop_params.systematic_domain_dim() != systematic_dim)
+                {
+                    continue;
+                }
+                /** The parameters add extra dimensions when the queries need them. The candidates
+                 *  they skip over would give the same parameters, so continue past them. */
+                RS_extra_dimensions = std::max(RS_extra_dimensions, iop_params.RS_extra_dimensions());
+
+                const ligero_cost_prediction prediction = ligero_cost_predictor<FieldT>(model, iop_params);
+                if (!found || cost(prediction) < cost(best))
+                {
+                    found = true;
+                    best = prediction;
+                    best_height_width_ratio = height_width_ratio;
+                    best_RS_extra_dimensions = iop_params.RS_extra_dimensions();
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        libff::inhibit_profiling_info = inhibit_profiling_info;
+        throw;
+    }
+    libff::inhibit_profiling_info = inhibit_profiling_info;
+
+    if (!found)
+    {
+        throw std::invalid_argument("No Ligero matrix shape fits this constraint system.");
+    }
+
+    this->height_width_ratio_ = best_height_width_ratio;
+    this->RS_extra_dimensions_ = best_RS_extra_dimensions;
+    this->matrix_shape_optimized_ = true;
+    this->objective_ = objective;
+    this->predicted_costs_ = best;
+    return best;
 }
 
 template<typename FieldT, typename MT_root_hash>
@@ -43,7 +214,10 @@ ligero_snark_argument<FieldT, MT_root_hash> ligero_snark_prover(
     const r1cs_auxiliary_input<FieldT> &auxiliary_input,
     const ligero_snark_parameters<FieldT, MT_root_hash> &parameters)
 {
-    libff::enter_block("Ligero SNARK prover");
+    /* The temporaries of the proof come from one arena, released on return */
+    const scoped_proof_arena arena;
+    const scoped_oracle_page_policy page_policy(parameters.bcs_params_.oracle_page_policy_);
+    LIBIOP_TRACE_BEGIN("Ligero SNARK prover");
     const ligero_iop_parameters<FieldT> iop_params =
         obtain_iop_parameters_from_ligero_snark_params<FieldT>(
             parameters,
@@ -61,13 +235,13 @@ ligero_snark_argument<FieldT, MT_root_hash> ligero_snark_prover(
 
     full_protocol.produce_proof(primary_input, auxiliary_input);
 
-    libff::enter_block("Obtain transcript");
+    LIBIOP_TRACE_BEGIN("Obtain transcript");
     const ligero_snark_argument<FieldT, MT_root_hash> transcript = IOP.get_transcript();
-    libff::leave_block("Obtain transcript");
+    LIBIOP_TRACE_END("Obtain transcript");
 
     IOP.describe_sizes();
 
-    libff::leave_block("Ligero SNARK prover");
+    LIBIOP_TRACE_END("Ligero SNARK prover");
     return transcript;
 }
 
@@ -77,7 +251,7 @@ bool ligero_snark_verifier(const r1cs_constraint_system<FieldT> &constraint_syst
                            const ligero_snark_argument<FieldT, MT_root_hash> &proof,
                            const ligero_snark_parameters<FieldT, MT_root_hash> &parameters)
 {
-    libff::enter_block("Ligero SNARK verifier");
+    LIBIOP_TRACE_BEGIN("Ligero SNARK verifier");
     const ligero_iop_parameters<FieldT> iop_params =
         obtain_iop_parameters_from_ligero_snark_params<FieldT>(
             parameters,
@@ -94,18 +268,18 @@ bool ligero_snark_verifier(const r1cs_constraint_system<FieldT> &constraint_syst
     full_protocol.register_queries();
     IOP.seal_query_registrations();
 
-    libff::enter_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_BEGIN("Check semantic validity of IOP transcript");
     const bool IOP_transcript_valid = IOP.transcript_is_valid();
-    libff::leave_block("Check semantic validity of IOP transcript");
+    LIBIOP_TRACE_END("Check semantic validity of IOP transcript");
 
-    libff::enter_block("Check verifier predicate");
+    LIBIOP_TRACE_BEGIN("Check verifier predicate");
     const bool full_protocol_accepts = full_protocol.verifier_predicate(primary_input);
-    libff::leave_block("Check verifier predicate");
+    LIBIOP_TRACE_END("Check verifier predicate");
 
     libff::print_indent(); printf("* IOP transcript valid: %s\n", IOP_transcript_valid ? "true" : "false");
     libff::print_indent(); printf("* Full protocol decision predicate satisfied: %s\n", full_protocol_accepts ? "true" : "false");
     const bool decision = IOP_transcript_valid && full_protocol_accepts;
-    libff::leave_block("Ligero SNARK verifier");
+    LIBIOP_TRACE_END("Ligero SNARK verifier");
 
     return decision;
 }
@@ -1,12 +1,20 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <thread>
 #include <vector>
 
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+#include <libff/algebra/curves/edwards/edwards_pp.hpp>
 
 #include <libff/algebra/fields/binary/gf64.hpp>
+#include <libff/algebra/fields/binary/gf128.hpp>
 #include <libff/common/utils.hpp>
+#include "libiop/algebra/randomness.hpp"
 #include "libiop/algebra/utils.hpp"
+#include "libiop/algebra/vector_ops.hpp"
+#include "libiop/common/proof_arena.hpp"
 
 namespace libiop {
 
@@ -31,6 +39,24 @@ TEST(BatchInverseTest, SimpleTest) {
     }
 }
 
+TEST(BatchInverseTest, TemporaryVectorTest) {
+    typedef libff::gf64 FieldT;
+
+    const scoped_proof_arena arena;
+    const std::size_t sz = 100;
+    const std::vector<FieldT> vec = random_vector<FieldT>(sz);
+    const temporary_vector<FieldT> temporary_vec(vec.begin(), vec.end(), temporary_resource());
+    const FieldT k = FieldT::random_element();
+    const temporary_vector<FieldT> vec_inv = batch_inverse_and_mul(temporary_vec, k);
+
+    /* The result is allocated from the same arena */
+    EXPECT_EQ(vec_inv.get_allocator().resource(), temporary_resource());
+    for (std::size_t i = 0; i < sz; ++i)
+    {
+        EXPECT_EQ(vec[i] * vec_inv[i], k);
+    }
+}
+
 TEST(MultiplicativeBatchInverseTest, SimpleTest) {
     libff::alt_bn128_pp::init_public_params();
     typedef libff::alt_bn128_Fr FieldT;
@@ -62,4 +88,158 @@ TEST(MultiplicativeBatchInverseTest, SimpleTest) {
     }
 }
 
+
+template<typename FieldT>
+void run_vector_ops_test(const std::size_t sz)
+{
+    const FieldT a = FieldT::random_element();
+    const std::vector<FieldT> x = random_vector<FieldT>(sz);
+    const std::vector<FieldT> y = random_vector<FieldT>(sz);
+
+    std::vector<FieldT> scaled(x);
+    vector_scale(a, scaled.data(), sz);
+    std::vector<FieldT> axpy(y);
+    vector_axpy(a, x.data(), axpy.data(), sz);
+    std::vector<FieldT> product(sz);
+    vector_pointwise_multiply(x.data(), y.data(), product.data(), sz);
+    std::vector<FieldT> product_sum(y);
+    vector_pointwise_multiply_add(x.data(), y.data(), product_sum.data(), sz);
+
+    FieldT dot = FieldT::zero();
+    for (std::size_t i = 0; i < sz; ++i)
+    {
+        EXPECT_TRUE(scaled[i] == a * x[i]);
+        EXPECT_TRUE(axpy[i] == y[i] + a * x[i]);
+        EXPECT_TRUE(product[i] == x[i] * y[i]);
+        EXPECT_TRUE(product_sum[i] == y[i] + x[i] * y[i]);
+        dot += x[i] * y[i];
+    }
+    EXPECT_TRUE(vector_dot_product(x.data(), y.data(), sz) == dot);
+
+    /* In-place pointwise multiplication */
+    std::vector<FieldT> in_place(x);
+    vector_pointwise_multiply(in_place.data(), y.data(), in_place.data(), sz);
+    EXPECT_TRUE(in_place == product);
+
+    std::vector<FieldT> squares(x);
+    vector_square(squares.data(), sz);
+    std::vector<FieldT> lo(x);
+    std::vector<FieldT> hi(y);
+    const std::vector<FieldT> w = random_vector<FieldT>(sz);
+    vector_butterfly(w.data(), lo.data(), hi.data(), sz);
+    for (std::size_t i = 0; i < sz; ++i)
+    {
+        EXPECT_TRUE(squares[i] == x[i].squared());
+        EXPECT_TRUE(lo[i] == x[i] + w[i] * y[i]);
+        EXPECT_TRUE(hi[i] == x[i] - w[i] * y[i]);
+    }
+}
+
+TEST(VectorOpsTest, BinaryFieldTest) {
+    /* Sizes straddle the unrolled kernel width so the scalar tails run too */
+    for (std::size_t sz : {0, 1, 3, 4, 7, 64, 101})
+    {
+        run_vector_ops_test<libff::gf64>(sz);
+        run_vector_ops_test<libff::gf128>(sz);
+    }
+}
+
+TEST(VectorOpsTest, PrimeFieldTest) {
+    libff::alt_bn128_pp::init_public_params();
+    libff::edwards_pp::init_public_params();
+    for (std::size_t sz : {0, 1, 3, 4, 7, 64, 101})
+    {
+        run_vector_ops_test<libff::alt_bn128_Fr>(sz);
+        run_vector_ops_test<libff::edwards_Fr>(sz);
+    }
+
+}
+
+TEST(RandomnessTest, SeedTest) {
+    const size_t sz = (1ull << 20) + 3; /* More than one chunk */
+
+    set_randomness_seed("seed");
+    const std::vector<uint8_t> first = random_vector<uint8_t>(sz);
+    const std::vector<uint8_t> second = random_vector<uint8_t>(sz);
+    set_randomness_seed("seed");
+    const std::vector<uint8_t> first_again = random_vector<uint8_t>(sz);
+    set_randomness_seed("another seed");
+    const std::vector<uint8_t> other_seed = random_vector<uint8_t>(sz);
+    clear_randomness_seed();
+    const std::vector<uint8_t> unseeded = random_vector<uint8_t>(sz);
+
+    EXPECT_EQ(first, first_again);
+    EXPECT_NE(first, second);
+    EXPECT_NE(first, other_seed);
+    EXPECT_NE(first, unseeded);
+
+    std::vector<uint8_t> scoped;
+    {
+        scoped_randomness_seed seed("seed");
+        scoped = random_vector<uint8_t>(sz);
+    }
+    EXPECT_EQ(first, scoped);
+    EXPECT_NE(random_vector<uint8_t>(sz), second);
+
+    /* A nested seed restores the enclosing one, and its position in the sequence */
+    set_randomness_seed("seed");
+    const std::vector<uint8_t> before_nested = random_vector<uint8_t>(sz);
+    {
+        scoped_randomness_seed seed("another seed");
+        EXPECT_EQ(random_vector<uint8_t>(sz), other_seed);
+    }
+    const std::vector<uint8_t> after_nested = random_vector<uint8_t>(sz);
+    EXPECT_EQ(before_nested, first);
+    EXPECT_EQ(after_nested, second);
+
+    /* Other threads are not seeded by this one */
+    set_randomness_seed("seed");
+    std::vector<uint8_t> other_thread;
+    std::thread([&other_thread, sz]() {
+        other_thread = random_vector<uint8_t>(sz);
+    }).join();
+    EXPECT_NE(other_thread, first);
+    EXPECT_EQ(random_vector<uint8_t>(sz), first);
+    clear_randomness_seed();
+}
+
+TEST(RandomnessTest, PrimeFieldTest) {
+    libff::alt_bn128_pp::init_public_params();
+    typedef libff::alt_bn128_Fr FieldT;
+    const size_t sz = 1000;
+
+    const std::vector<FieldT> elements = random_FieldT_vector<FieldT>(sz);
+    for (const FieldT &x : elements)
+    {
+        EXPECT_LT(mpn_cmp(x.mont_repr.data, FieldT::mod.data, FieldT::num_limbs), 0);
+    }
+    /** Bit k = num_bits - 2 of a uniform element of [0, p) is set on [2^k, 2^{k+1})
+     *  and on [3 * 2^k, p). With t = p / 2^k, that is (1 + max(t - 3, 0)) / t of the
+     *  range, which is about 0.339 for alt_bn128's r rather than one half. */
+    const size_t k = FieldT::mod.num_bits() - 2;
+    double t = 0;
+    for (size_t i = FieldT::num_limbs; i--; )
+    {
+        t = std::ldexp(t, 64) + (double)FieldT::mod.data[i];
+    }
+    t = std::ldexp(t, -(int)k);
+    const double probability = (1 + std::max(t - 3, 0.0)) / t;
+    size_t num_bits_set = 0;
+    for (const FieldT &x : elements)
+    {
+        num_bits_set += x.as_bigint().test_bit(k);
+    }
+    /* Allow five standard deviations */
+    const double expected = probability * sz;
+    const double tolerance = 5 * std::sqrt(sz * probability * (1 - probability));
+    EXPECT_NEAR(expected, (double)num_bits_set, tolerance);
+
+    set_randomness_seed("seed");
+    const std::vector<FieldT> seeded = random_FieldT_vector<FieldT>(sz);
+    set_randomness_seed("seed");
+    const std::vector<FieldT> seeded_again = random_FieldT_vector<FieldT>(sz);
+    clear_randomness_seed();
+    EXPECT_TRUE(seeded == seeded_again);
+}
+
 }
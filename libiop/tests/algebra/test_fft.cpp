@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <thread>
 #include <vector>
 
 #include <libff/algebra/curves/edwards/edwards_pp.hpp>
@@ -7,7 +8,10 @@
 #include <libff/algebra/fields/binary/gf64.hpp>
 #include "libiop/algebra/utils.hpp"
 #include "libiop/algebra/fft.hpp"
+#include "libiop/algebra/low_degree_extension.hpp"
+#include "libiop/algebra/polynomials/vanishing_polynomial.hpp"
 #include "libiop/algebra/field_subset/subspace.hpp"
+#include "libiop/common/tracing.hpp"
 
 namespace libiop {
 
@@ -51,6 +55,121 @@ TEST(AdditiveTest, SimpleTest) {
     }
 }
 
+TEST(AdditiveTest, PlanReuseTest) {
+    typedef libff::gf64 FieldT;
+
+    for (size_t m = 0; m <= 8; ++m)
+    {
+        const affine_subspace<FieldT> subspace = affine_subspace<FieldT>::random_affine_subspace(m);
+        const field_subset<FieldT> domain(subspace);
+        /* Copies of a subspace share its plan */
+        const affine_subspace<FieldT> copy = domain.subspace();
+        EXPECT_EQ(subspace.fft_plan(), copy.fft_plan());
+
+        for (size_t trial = 0; trial < 3; ++trial)
+        {
+            const std::vector<FieldT> poly_coeffs = random_vector<FieldT>(1ull<<m);
+            std::vector<FieldT> data(poly_coeffs);
+            copy.fft_plan()->execute(data);
+            EXPECT_EQ(data, naive_FFT<FieldT>(poly_coeffs, domain));
+
+            subspace.fft_plan()->execute_inverse(data);
+            EXPECT_EQ(data, poly_coeffs);
+        }
+    }
+
+    const affine_subspace<FieldT> subspace = affine_subspace<FieldT>::random_affine_subspace(4);
+    std::vector<FieldT> wrong_size(8);
+    EXPECT_THROW(subspace.fft_plan()->execute(wrong_size), std::invalid_argument);
+}
+
+TEST(AdditiveTest, DegreeAwareTest) {
+    typedef libff::gf64 FieldT;
+
+    for (size_t domain_dim = 0; domain_dim <= 10; ++domain_dim)
+    {
+        const field_subset<FieldT> domain = field_subset<FieldT>(
+            affine_subspace<FieldT>::random_affine_subspace(domain_dim));
+        const size_t n = 1ull << domain_dim;
+        for (size_t num_coeffs : {size_t(0), size_t(1), size_t(3), n / 4, n / 2 + 1, n})
+        {
+            const std::vector<FieldT> poly_coeffs = random_vector<FieldT>(std::min(num_coeffs, n));
+            const std::vector<FieldT> naive_result =
+                naive_FFT<FieldT>(poly_coeffs, domain);
+            const std::vector<FieldT> additive_result =
+                additive_FFT<FieldT>(poly_coeffs, domain.subspace());
+
+            EXPECT_EQ(naive_result, additive_result);
+        }
+    }
+}
+
+template<typename FieldT>
+void run_low_degree_extension_test(const field_subset<FieldT> &small_domain,
+                                   const field_subset<FieldT> &large_domain,
+                                   const size_t mask_terms)
+{
+    const std::vector<FieldT> evals = elementwise_random_vector<FieldT>(small_domain.num_elements());
+    const polynomial<FieldT> mask = (mask_terms > 0) ?
+        polynomial<FieldT>::random_polynomial(mask_terms) : polynomial<FieldT>();
+
+    /* Reference: interpolate, add the mask, evaluate over the whole domain */
+    polynomial<FieldT> f(IFFT_over_field_subset<FieldT>(evals, small_domain));
+    if (mask_terms > 0)
+    {
+        f += vanishing_polynomial<FieldT>(small_domain) * mask;
+    }
+    const std::vector<FieldT> expected = f.evaluations_over_field_subset(large_domain);
+
+    const std::vector<FieldT> lde = low_degree_extend<FieldT>(evals, small_domain, large_domain, mask);
+    ASSERT_EQ(lde.size(), large_domain.num_elements());
+    for (size_t i = 0; i < lde.size(); ++i)
+    {
+        EXPECT_TRUE(lde[i] == expected[i]);
+    }
+}
+
+TEST(LowDegreeExtensionTest, MultiplicativeTest) {
+    libff::edwards_pp::init_public_params();
+    typedef libff::edwards_Fr FieldT;
+
+    for (size_t small_dim = 1; small_dim <= 5; ++small_dim)
+    {
+        for (size_t large_dim = small_dim; large_dim <= small_dim + 3; ++large_dim)
+        {
+            const field_subset<FieldT> small_domain(1ull << small_dim, FieldT::random_element());
+            const field_subset<FieldT> large_domain(1ull << large_dim, FieldT::multiplicative_generator);
+            run_low_degree_extension_test<FieldT>(small_domain, large_domain, 0);
+            if (large_dim > small_dim)
+            {
+                /* Masks both shorter and longer than the small domain */
+                run_low_degree_extension_test<FieldT>(small_domain, large_domain, 1);
+                run_low_degree_extension_test<FieldT>(
+                    small_domain, large_domain, (1ull << large_dim) - (1ull << small_dim));
+            }
+        }
+    }
+}
+
+TEST(LowDegreeExtensionTest, AdditiveTest) {
+    typedef libff::gf64 FieldT;
+
+    for (size_t small_dim = 1; small_dim <= 5; ++small_dim)
+    {
+        const size_t large_dim = small_dim + 2;
+        const field_subset<FieldT> large_domain(
+            affine_subspace<FieldT>::random_affine_subspace(large_dim));
+        const field_subset<FieldT> small_domain = large_domain.get_subset_of_order(1ull << small_dim);
+        run_low_degree_extension_test<FieldT>(small_domain, large_domain, 0);
+        run_low_degree_extension_test<FieldT>(small_domain, large_domain, 3);
+    }
+
+    const field_subset<FieldT> small_domain(affine_subspace<FieldT>::random_affine_subspace(3));
+    const field_subset<FieldT> large_domain(affine_subspace<FieldT>::random_affine_subspace(2));
+    EXPECT_THROW(low_degree_extend<FieldT>(std::vector<FieldT>(8), small_domain, large_domain),
+                 std::invalid_argument);
+}
+
 TEST(MultiplicativeSubgroupTest, SimpleTest) {
     libff::edwards_pp::init_public_params();
     typedef libff::edwards_Fr FieldT;
@@ -85,6 +204,43 @@ TEST(MultiplicativeSubgroupTest, SimpleTest) {
     }
 }
 
+TEST(MultiplicativeSubgroupTest, ConcurrentCacheTest) {
+    libff::edwards_pp::init_public_params();
+    typedef libff::edwards_Fr FieldT;
+
+    const size_t domain_dim = 10;
+    const size_t num_threads = 4;
+    const field_subset<FieldT> domain(1ull << domain_dim);
+    std::vector<std::vector<FieldT>> poly_coeffs(num_threads);
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        poly_coeffs[t] = elementwise_random_vector<FieldT>(1ull << domain_dim);
+    }
+
+    /* The threads all fill the same (shared) FFT cache on first use */
+    std::vector<std::vector<FieldT>> results(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&domain, &poly_coeffs, &results, t]() {
+            results[t] = multiplicative_FFT<FieldT>(poly_coeffs[t], domain.coset());
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(domain.coset().fft_cache()->size(), (1ull << domain_dim) - 1);
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        const std::vector<FieldT> naive_result = naive_FFT<FieldT>(poly_coeffs[t], domain);
+        for (size_t i = 0; i < domain.num_elements(); ++i) {
+            EXPECT_TRUE(results[t][i] == naive_result[i]);
+        }
+    }
+}
+
 TEST(MultiplicativeCosetTest, SimpleTest) {
     libff::edwards_pp::init_public_params();
 
@@ -138,4 +294,30 @@ TEST(ExtendedRangeTest, SimpleTest) {
     }
 }
 
+#ifdef TRACING
+/* Each transform is counted once, whichever entry point it goes through */
+template<typename FieldT>
+void run_FFT_counter_test(const field_subset<FieldT> &domain)
+{
+    const std::vector<FieldT> poly_coeffs = random_vector<FieldT>(domain.num_elements());
+
+    clear_trace();
+    const std::vector<FieldT> evals = FFT_over_field_subset<FieldT>(poly_coeffs, domain);
+    EXPECT_EQ(total_trace_counters()[trace_counter::FFT_points], domain.num_elements());
+
+    clear_trace();
+    const std::vector<FieldT> interpolation = IFFT_over_field_subset<FieldT>(evals, domain);
+    EXPECT_EQ(total_trace_counters()[trace_counter::FFT_points], domain.num_elements());
+    EXPECT_LT(0u, total_trace_counters()[trace_counter::field_multiplications]);
+    clear_trace();
+}
+
+TEST(FFTCounterTest, SimpleTest) {
+    libff::edwards_pp::init_public_params();
+    run_FFT_counter_test<libff::gf64>(field_subset<libff::gf64>(
+        affine_subspace<libff::gf64>::random_affine_subspace(8)));
+    run_FFT_counter_test<libff::edwards_Fr>(field_subset<libff::edwards_Fr>(1ull << 8));
+}
+#endif // TRACING
+
 }
\ No newline at end of file
@@ -60,6 +60,42 @@ TEST(Test, LagrangeTest) {
     run_lagrange_test<libff::alt_bn128_Fr>(altbn_domain);
 }
 
+template<typename FieldT>
+void run_multi_point_lagrange_test(const field_subset<FieldT> &domain) {
+    const std::size_t num_points = 8;
+    lagrange_cache<FieldT> L_cache(domain, false, true);
+
+    const polynomial<FieldT> poly = polynomial<FieldT>::random_polynomial(domain.num_elements());
+    const std::vector<FieldT> poly_evals = FFT_over_field_subset(poly.coefficients(), domain);
+
+    /* Random points, plus one point inside the domain */
+    std::vector<FieldT> points = random_vector<FieldT>(num_points);
+    points.emplace_back(domain.element_by_index(std::rand() % domain.num_elements()));
+
+    const std::vector<std::vector<FieldT>> all_coeffs = L_cache.coefficients_for(points);
+    const std::vector<std::vector<FieldT>> interpolations =
+        L_cache.interpolate_at_points({ poly_evals }, points);
+    ASSERT_EQ(all_coeffs.size(), points.size());
+    ASSERT_EQ(interpolations.size(), std::size_t(1));
+    for (std::size_t j = 0; j < points.size(); ++j)
+    {
+        EXPECT_TRUE(all_coeffs[j] == L_cache.coefficients_for(points[j]));
+        EXPECT_TRUE(interpolations[0][j] == poly.evaluation_at_point(points[j]));
+    }
+}
+
+TEST(MultiPoint, LagrangeTest) {
+    const std::size_t dim = 6;
+    const field_subset<libff::gf64> additive_domain(
+        affine_subspace<libff::gf64>::random_affine_subspace(dim));
+    run_multi_point_lagrange_test<libff::gf64>(additive_domain);
+
+    libff::alt_bn128_pp::init_public_params();
+    const field_subset<libff::alt_bn128_Fr> altbn_domain(
+        1ull << dim, libff::alt_bn128_Fr::multiplicative_generator);
+    run_multi_point_lagrange_test<libff::alt_bn128_Fr>(altbn_domain);
+}
+
 template<typename FieldT>
 void run_intersecting_lagrange_test(const field_subset<FieldT> &domain) {
     const std::size_t dim = domain.dimension();
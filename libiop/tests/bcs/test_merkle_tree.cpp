@@ -1,5 +1,6 @@
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <vector>
 #include <type_traits>
 
@@ -175,6 +176,181 @@ TEST(MerkleTreeZKTest, MultiTest) {
     run_multi_test(make_zk);
 }
 
+TEST(MerkleTreeTest, LeafHashValidationTest) {
+    typedef libff::gf64 FieldT;
+
+    const std::size_t size = 16;
+    const std::size_t security_parameter = 128;
+    const std::size_t digest_len_bytes = 256/8;
+    const bool make_zk = true;
+
+    merkle_tree<FieldT, binary_hash_digest> tree = new_MT<FieldT, binary_hash_digest>(
+        size,
+        digest_len_bytes,
+        make_zk,
+        security_parameter);
+
+    const std::vector<FieldT> vec = random_vector<FieldT>(size);
+    tree.construct({ vec });
+    const binary_hash_digest root = tree.get_root();
+
+    const std::vector<std::size_t> positions({ 1, 2, 3, 9 });
+    const merkle_tree_set_membership_proof<binary_hash_digest> mp = tree.get_set_membership_proof(positions);
+    std::vector<binary_hash_digest> leaf_hashes;
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        leaf_hashes.emplace_back(tree.hash_leaf({ vec[positions[i]] }, mp, i));
+    }
+    EXPECT_TRUE(tree.validate_set_membership_proof_from_leaf_hashes(root, positions, leaf_hashes, mp));
+
+    /* A wrong leaf hash must be rejected */
+    std::vector<binary_hash_digest> wrong_leaf_hashes(leaf_hashes);
+    wrong_leaf_hashes[2] = leaf_hashes[0];
+    EXPECT_FALSE(tree.validate_set_membership_proof_from_leaf_hashes(root, positions, wrong_leaf_hashes, mp));
+
+    /* Truncated proofs must throw rather than read past the auxiliary hashes or salts */
+    merkle_tree_set_membership_proof<binary_hash_digest> truncated_mp = mp;
+    truncated_mp.auxiliary_hashes.pop_back();
+    EXPECT_THROW(tree.validate_set_membership_proof_from_leaf_hashes(root, positions, leaf_hashes, truncated_mp),
+                 std::invalid_argument);
+    truncated_mp = mp;
+    truncated_mp.randomness_hashes.pop_back();
+    EXPECT_THROW(tree.check_leaf_salts(truncated_mp, positions.size()), std::invalid_argument);
+}
+
+TEST(MerkleTreeZKTest, SaltTest) {
+    typedef libff::gf64 FieldT;
+
+    const std::size_t size = 64;
+    const std::size_t security_parameter = 128;
+    const std::size_t digest_len_bytes = 256/8;
+    const std::size_t num_zk_bytes = (2 * security_parameter + 7) / 8;
+
+    merkle_tree<FieldT, binary_hash_digest> tree = new_MT<FieldT, binary_hash_digest>(
+        size, digest_len_bytes, true, security_parameter);
+    const std::vector<FieldT> vec = random_vector<FieldT>(size);
+    tree.construct({ vec });
+
+    std::vector<std::size_t> positions(size);
+    std::iota(positions.begin(), positions.end(), 0);
+    const merkle_tree_set_membership_proof<binary_hash_digest> mp = tree.get_set_membership_proof(positions);
+    ASSERT_EQ(mp.randomness_hashes.size(), size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(mp.randomness_hashes[i].size(), num_zk_bytes);
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            EXPECT_NE(mp.randomness_hashes[i], mp.randomness_hashes[j]);
+        }
+    }
+
+    /* Hashing a salt in place must agree with hashing it as a string */
+    blake2b_leafhash<FieldT> leafhasher(security_parameter);
+    const zk_salt_type &salt = mp.randomness_hashes[5];
+    EXPECT_EQ(leafhasher.zk_hash(&vec[5], 1, salt),
+              leafhasher.zk_hash(&vec[5], 1, reinterpret_cast<const std::uint8_t*>(salt.data()), salt.size()));
+    EXPECT_EQ(leafhasher.zk_hash(std::vector<FieldT>({ vec[5] }), salt),
+              tree.hash_leaf({ vec[5] }, mp, 5));
+}
+
+TEST(MerkleTreeTest, CosetSerializationTest) {
+    typedef libff::gf64 FieldT;
+
+    /* Enough leaves that the leaves are gathered over several blocks */
+    const std::size_t num_leaves = 1ull << 12;
+    const std::size_t coset_size = 4;
+    const std::size_t num_oracles = 3;
+    const std::size_t digest_len_bytes = 256/8;
+    const std::size_t security_parameter = 128;
+
+    merkle_tree<FieldT, binary_hash_digest> tree = new_MT<FieldT, binary_hash_digest>(
+        num_leaves,
+        digest_len_bytes,
+        false,
+        security_parameter);
+
+    std::vector<std::shared_ptr<std::vector<FieldT>>> oracles;
+    for (std::size_t k = 0; k < num_oracles; k++)
+    {
+        oracles.emplace_back(std::make_shared<std::vector<FieldT>>(
+            random_vector<FieldT>(num_leaves * coset_size)));
+    }
+    tree.construct_with_leaves_serialized_by_cosets(oracles, coset_size);
+
+    const binary_hash_digest root = tree.get_root();
+    const field_subset<FieldT> leaf_domain(num_leaves * coset_size);
+    for (std::size_t i = 0; i < num_leaves; i += 37)
+    {
+        const std::vector<size_t> positions = leaf_domain.all_positions_in_coset_i(i, coset_size);
+        std::vector<FieldT> leaf;
+        for (std::size_t k = 0; k < num_oracles; k++)
+        {
+            for (std::size_t j = 0; j < coset_size; j++)
+            {
+                leaf.emplace_back(oracles[k]->operator[](positions[j]));
+            }
+        }
+
+        const std::vector<size_t> set = {i};
+        const merkle_tree_set_membership_proof<binary_hash_digest> mp = tree.get_set_membership_proof(set);
+        EXPECT_TRUE(tree.validate_set_membership_proof(root, set, { leaf }, mp));
+    }
+}
+
+/* Only implements the vector overloads, so the Merkle tree hashes through leafhash's default pointer overloads */
+template<typename FieldT>
+class vector_only_leafhash : public leafhash<FieldT, binary_hash_digest>
+{
+    protected:
+    blake2b_leafhash<FieldT> inner_;
+    public:
+    using leafhash<FieldT, binary_hash_digest>::hash;
+    using leafhash<FieldT, binary_hash_digest>::zk_hash;
+
+    vector_only_leafhash(const std::size_t security_parameter) : inner_(security_parameter) {}
+
+    binary_hash_digest hash(const std::vector<FieldT> &leaf)
+    {
+        return this->inner_.hash(leaf);
+    }
+    binary_hash_digest zk_hash(const std::vector<FieldT> &leaf, const zk_salt_type &zk_salt)
+    {
+        return this->inner_.zk_hash(leaf, zk_salt);
+    }
+};
+
+TEST(MerkleTreeTest, DefaultLeafhashOverloadsTest) {
+    typedef libff::gf64 FieldT;
+
+    /* Enough leaves that, under MULTICORE, several threads hash through the default overloads at once */
+    const std::size_t num_leaves = 1ull << 12;
+    const std::size_t coset_size = 4;
+    const std::size_t digest_len_bytes = 256/8;
+    const std::size_t security_parameter = 128;
+
+    merkle_tree<FieldT, binary_hash_digest> expected_tree = new_MT<FieldT, binary_hash_digest>(
+        num_leaves,
+        digest_len_bytes,
+        false,
+        security_parameter);
+    merkle_tree<FieldT, binary_hash_digest> tree(
+        num_leaves,
+        std::make_shared<vector_only_leafhash<FieldT>>(security_parameter),
+        blake2b_two_to_one_hash,
+        digest_len_bytes,
+        false,
+        security_parameter);
+
+    const std::vector<std::shared_ptr<std::vector<FieldT>>> oracles = {
+        std::make_shared<std::vector<FieldT>>(random_vector<FieldT>(num_leaves * coset_size)),
+        std::make_shared<std::vector<FieldT>>(random_vector<FieldT>(num_leaves * coset_size))
+    };
+    expected_tree.construct_with_leaves_serialized_by_cosets(oracles, coset_size);
+    tree.construct_with_leaves_serialized_by_cosets(oracles, coset_size);
+
+    EXPECT_EQ(tree.get_root(), expected_tree.get_root());
+}
+
 TEST(MerkleTreeTwoToOneHashTest, SimpleTest)
 {
     typedef libff::gf64 FieldT;
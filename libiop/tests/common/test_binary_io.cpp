@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libiop/common/binary_io.hpp"
+
+namespace libiop {
+
+TEST(BinaryIOTest, AlignedArrayTest) {
+    const std::vector<std::uint64_t> values({ 1, 2, 3, 5, 8, 13 });
+    std::ostringstream out;
+    write_value<std::uint8_t>(out, 7);
+    write_aligned_array<std::uint64_t>(out, values.data(), values.size());
+    write_value<std::uint8_t>(out, 9);
+    const std::string bytes = out.str();
+    EXPECT_EQ(bytes.size(), binary_array_alignment + values.size() * sizeof(std::uint64_t) + 1);
+
+    const std::uint8_t *begin = reinterpret_cast<const std::uint8_t*>(bytes.data());
+    /* Without an owner the array is copied */
+    byte_reader in(begin, begin + bytes.size());
+    EXPECT_EQ(in.read_value<std::uint8_t>(), 7);
+    const shared_buffer<std::uint64_t> copied = read_aligned_array<std::uint64_t>(in, nullptr, values.size());
+    EXPECT_EQ(in.read_value<std::uint8_t>(), 9);
+    EXPECT_TRUE(in.at_end());
+    EXPECT_EQ(std::vector<std::uint64_t>(copied.begin(), copied.end()), values);
+    EXPECT_NE((const void*)copied.data(), (const void*)(begin + binary_array_alignment));
+}
+
+TEST(BinaryIOTest, MappedFileTest) {
+    const std::vector<std::uint64_t> values({ 1, 2, 3, 5, 8, 13 });
+    const std::string path = "test_binary_io.bin";
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        write_value<std::uint64_t>(out, values.size());
+        write_aligned_array<std::uint64_t>(out, values.data(), values.size());
+    }
+
+    shared_buffer<std::uint64_t> viewed;
+    {
+        const std::shared_ptr<const mapped_file> file = std::make_shared<const mapped_file>(path);
+        byte_reader in(file->data(), file->data() + file->size());
+        const std::size_t size = in.read_value<std::uint64_t>();
+        viewed = read_aligned_array<std::uint64_t>(in, file, size);
+        EXPECT_TRUE(in.at_end());
+        /* With an owner the array is read in place */
+        EXPECT_EQ((const void*)viewed.data(), (const void*)(file->data() + binary_array_alignment));
+    }
+    /* The buffer keeps the mapping alive, also once the file is removed */
+    std::remove(path.c_str());
+    EXPECT_EQ(std::vector<std::uint64_t>(viewed.begin(), viewed.end()), values);
+
+    EXPECT_THROW(mapped_file("test_binary_io_missing.bin"), std::runtime_error);
+}
+
+}
@@ -0,0 +1,87 @@
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libiop/common/huge_pages.hpp"
+
+namespace libiop {
+
+TEST(HugePagesTest, PolicyScopeTest) {
+    EXPECT_FALSE(huge_pages_enabled());
+    {
+        const scoped_oracle_page_policy default_policy(oracle_page_policy::default_pages);
+        EXPECT_FALSE(huge_pages_enabled());
+        {
+            const scoped_oracle_page_policy huge_page_policy(oracle_page_policy::transparent_huge_pages);
+            EXPECT_TRUE(huge_pages_enabled());
+            {
+                /* The innermost policy is the one in force */
+                const scoped_oracle_page_policy nested_default_policy(oracle_page_policy::default_pages);
+                EXPECT_FALSE(huge_pages_enabled());
+            }
+            EXPECT_TRUE(huge_pages_enabled());
+
+            /* Other threads, e.g. another prover or a verifier, keep their own policy */
+            bool other_thread_enabled = true;
+            std::thread other([&other_thread_enabled]() {
+                other_thread_enabled = huge_pages_enabled();
+            });
+            other.join();
+            EXPECT_FALSE(other_thread_enabled);
+        }
+        EXPECT_FALSE(huge_pages_enabled());
+    }
+    EXPECT_FALSE(huge_pages_enabled());
+}
+
+TEST(HugePagesTest, ReserveTest) {
+    const scoped_oracle_page_policy policy(oracle_page_policy::transparent_huge_pages);
+
+    /* Spans several huge pages, and so is prepared */
+    const std::size_t large_size = 3 * huge_page_size / sizeof(std::size_t) + 5;
+    std::vector<std::size_t> large;
+    reserve_oracle_buffer(large, large_size);
+    EXPECT_GE(large.capacity(), large_size);
+    for (std::size_t i = 0; i < large_size; ++i)
+    {
+        large.emplace_back(i);
+    }
+    for (std::size_t i = 0; i < large_size; i += 4099)
+    {
+        EXPECT_EQ(large[i], i);
+    }
+
+    /* Smaller than a huge page, and so just reserved */
+    std::vector<std::size_t> small;
+    reserve_oracle_buffer(small, 100);
+    EXPECT_GE(small.capacity(), 100u);
+
+    /* Existing elements are kept */
+    std::vector<std::size_t> existing(10, 7);
+    reserve_oracle_buffer(existing, large_size);
+    EXPECT_GE(existing.capacity(), large_size);
+    ASSERT_EQ(existing.size(), 10u);
+    EXPECT_EQ(existing[9], 7u);
+}
+
+TEST(HugePagesTest, PrepareUnalignedTest) {
+    /* Neither end of the range is aligned to a base or huge page */
+    const std::size_t num_bytes = 2 * huge_page_size + 12345;
+    char *buffer = static_cast<char*>(::operator new(num_bytes + 3));
+    prepare_huge_pages(buffer + 3, num_bytes);
+    /* The first byte of the range is written by the first touch */
+    EXPECT_EQ(buffer[3], 0);
+    ::operator delete(buffer);
+
+    /* As for a buffer filled by a statically scheduled parallel loop */
+    char *parallel_buffer = static_cast<char*>(::operator new(num_bytes + 3));
+    prepare_huge_pages(parallel_buffer + 3, num_bytes, true);
+    EXPECT_EQ(parallel_buffer[3], 0);
+    ::operator delete(parallel_buffer);
+}
+
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libiop/common/memory_accounting.hpp"
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+#ifdef MEMORY_ACCOUNTING
+
+/* Calls operator new directly, as the compiler may elide allocations made by new expressions */
+void allocate_and_free(const std::size_t size)
+{
+    void *allocation = ::operator new(size);
+    static_cast<volatile char*>(allocation)[0] = 0;
+    ::operator delete(allocation);
+}
+
+TEST(MemoryAccountingTest, LiveBytesTest) {
+    const std::size_t size = 1 << 20;
+    reset_peak_heap_bytes();
+    const std::size_t live_before = live_heap_bytes();
+    void *allocation = ::operator new(size);
+    const std::size_t live_during = live_heap_bytes();
+    ::operator delete(allocation);
+    const std::size_t live_after = live_heap_bytes();
+    const std::size_t peak = peak_heap_bytes();
+
+    EXPECT_EQ(live_during, live_before + size);
+    EXPECT_EQ(live_after, live_before);
+    EXPECT_GE(peak, live_before + size);
+
+    /* Over-aligned allocations are counted too */
+    const std::size_t alignment = 64;
+    const std::size_t aligned_live_before = live_heap_bytes();
+    void *aligned_allocation = ::operator new(size, std::align_val_t(alignment));
+    const std::size_t aligned_live_during = live_heap_bytes();
+    const std::size_t offset = reinterpret_cast<std::size_t>(aligned_allocation) % alignment;
+    ::operator delete(aligned_allocation, std::align_val_t(alignment));
+    const std::size_t aligned_live_after = live_heap_bytes();
+
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(aligned_live_during, aligned_live_before + size);
+    EXPECT_EQ(aligned_live_after, aligned_live_before);
+}
+
+TEST(MemoryAccountingTest, NestedPhaseTest) {
+    clear_trace();
+    std::vector<trace_span_metrics> closed;
+    set_trace_metrics_callback([&closed](const trace_span_metrics &metrics) {
+        closed.emplace_back(metrics);
+    });
+
+    const std::size_t outer_size = 1 << 22;
+    const std::size_t inner_size = 1 << 20;
+    LIBIOP_TRACE_BEGIN("outer phase");
+    allocate_and_free(outer_size);
+    {
+        LIBIOP_TRACE_SCOPE("inner phase");
+        allocate_and_free(inner_size);
+    }
+    LIBIOP_TRACE_END("outer phase");
+    set_trace_metrics_callback(nullptr);
+
+    /* The inner phase's peak is only its own, while the outer phase's covers both */
+    ASSERT_EQ(closed.size(), 2u);
+    EXPECT_GE(closed[0].peak_heap_bytes - closed[0].heap_bytes_at_start, inner_size);
+    EXPECT_LT(closed[0].peak_heap_bytes - closed[0].heap_bytes_at_start, outer_size);
+    EXPECT_GE(closed[1].peak_heap_bytes - closed[1].heap_bytes_at_start, outer_size);
+
+    const std::vector<memory_phase> report = memory_phase_report();
+    ASSERT_EQ(report.size(), 2u);
+    EXPECT_EQ(report[0].name, "inner phase");
+    EXPECT_EQ(report[0].calls, 1u);
+    EXPECT_GE(report[0].peak_growth_bytes, inner_size);
+    EXPECT_EQ(report[1].name, "outer phase");
+    EXPECT_GE(report[1].peak_growth_bytes, outer_size);
+
+    clear_trace();
+    EXPECT_EQ(memory_phase_report().size(), 0u);
+}
+
+TEST(MemoryAccountingTest, OtherThreadTest) {
+    clear_trace();
+    std::vector<trace_span_metrics> closed;
+    set_trace_metrics_callback([&closed](const trace_span_metrics &metrics) {
+        closed.emplace_back(metrics);
+    });
+    const std::size_t size = 1 << 20;
+    const auto other_prover = [size]() {
+        LIBIOP_TRACE_SCOPE("other phase");
+        allocate_and_free(size);
+    };
+
+    /* While this thread has a heap phase open, another thread's spans record none */
+    LIBIOP_TRACE_BEGIN("owner phase");
+    std::thread during(other_prover);
+    during.join();
+    LIBIOP_TRACE_END("owner phase");
+
+    /* Once it has closed them all, another thread may record its own */
+    std::thread after(other_prover);
+    after.join();
+    set_trace_metrics_callback(nullptr);
+
+    ASSERT_EQ(closed.size(), 3u);
+    EXPECT_EQ(std::string(closed[0].name), "other phase");
+    EXPECT_EQ(closed[0].peak_heap_bytes, 0u);
+    EXPECT_EQ(std::string(closed[1].name), "owner phase");
+    EXPECT_EQ(std::string(closed[2].name), "other phase");
+    EXPECT_GE(closed[2].peak_heap_bytes - closed[2].heap_bytes_at_start, size);
+    clear_trace();
+}
+
+#else
+
+TEST(MemoryAccountingTest, DisabledTest) {
+    EXPECT_FALSE(memory_accounting_enabled());
+    void *allocation = ::operator new(1 << 20);
+    ::operator delete(allocation);
+    EXPECT_EQ(live_heap_bytes(), 0u);
+    EXPECT_EQ(peak_heap_bytes(), 0u);
+    EXPECT_EQ(memory_phase_report().size(), 0u);
+}
+
+#endif // MEMORY_ACCOUNTING
+
+}
@@ -0,0 +1,66 @@
+#include <cstddef>
+#include <memory_resource>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "libiop/common/proof_arena.hpp"
+
+namespace libiop {
+
+TEST(ProofArenaTest, ScopeTest) {
+    EXPECT_EQ(temporary_resource(), std::pmr::get_default_resource());
+    {
+        const scoped_proof_arena arena;
+        std::pmr::memory_resource *resource = temporary_resource();
+        EXPECT_NE(resource, std::pmr::get_default_resource());
+
+        /* A nested scope keeps the enclosing arena */
+        {
+            const scoped_proof_arena nested_arena;
+            EXPECT_EQ(temporary_resource(), resource);
+        }
+        EXPECT_EQ(temporary_resource(), resource);
+
+        /* Other threads do not see this thread's arena */
+        std::pmr::memory_resource *other_thread_resource = nullptr;
+        std::thread other([&other_thread_resource]() {
+            other_thread_resource = temporary_resource();
+        });
+        other.join();
+        EXPECT_EQ(other_thread_resource, std::pmr::get_default_resource());
+    }
+    EXPECT_EQ(temporary_resource(), std::pmr::get_default_resource());
+}
+
+TEST(ProofArenaTest, TemporaryVectorTest) {
+    const scoped_proof_arena arena;
+    temporary_vector<std::size_t> small(temporary_resource());
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        small.emplace_back(i);
+    }
+    /* Larger than any pooled block, so passed through to the default resource */
+    temporary_vector<char> large(2 * proof_arena::largest_pooled_allocation, 'a', temporary_resource());
+
+    EXPECT_EQ(small.get_allocator().resource(), temporary_resource());
+    for (std::size_t i = 0; i < small.size(); ++i)
+    {
+        EXPECT_EQ(small[i], i);
+    }
+    EXPECT_EQ(large.back(), 'a');
+}
+
+TEST(ProofArenaTest, ReleaseTest) {
+    proof_arena arena;
+    for (std::size_t round = 0; round < 3; ++round)
+    {
+        {
+            temporary_vector<std::size_t> values(1000, round, arena.resource());
+            EXPECT_EQ(values[999], round);
+        }
+        arena.release();
+    }
+}
+
+}
@@ -0,0 +1,111 @@
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "libiop/common/tracing.hpp"
+
+namespace libiop {
+
+#ifdef TRACING
+
+TEST(TracingTest, CounterTest) {
+    clear_trace();
+    LIBIOP_TRACE_COUNT(hashes, 3);
+    LIBIOP_TRACE_COUNT(FFT_points, 1024);
+
+    /* Each thread has its own counters, which are summed */
+    std::thread other([]() {
+        LIBIOP_TRACE_COUNT(hashes, 4);
+        LIBIOP_TRACE_COUNT(field_multiplications, 5);
+    });
+    other.join();
+
+    const trace_counters totals = total_trace_counters();
+    EXPECT_EQ(totals[trace_counter::hashes], 7u);
+    EXPECT_EQ(totals[trace_counter::FFT_points], 1024u);
+    EXPECT_EQ(totals[trace_counter::field_multiplications], 5u);
+    EXPECT_EQ(totals[trace_counter::allocated_bytes], 0u);
+
+    clear_trace();
+    EXPECT_EQ(total_trace_counters()[trace_counter::hashes], 0u);
+}
+
+TEST(TracingTest, MetricsCallbackTest) {
+    clear_trace();
+    std::vector<trace_span_metrics> closed;
+    set_trace_metrics_callback([&closed](const trace_span_metrics &metrics) {
+        closed.emplace_back(metrics);
+    });
+
+    LIBIOP_TRACE_BEGIN("outer");
+    LIBIOP_TRACE_COUNT(hashes, 2);
+    {
+        LIBIOP_TRACE_SCOPE("inner");
+        LIBIOP_TRACE_COUNT(hashes, 1);
+        LIBIOP_TRACE_COUNT(allocated_bytes, 64);
+    }
+    LIBIOP_TRACE_END("outer");
+    set_trace_metrics_callback(nullptr);
+
+    /* Spans are reported as they close, innermost first */
+    ASSERT_EQ(closed.size(), 2u);
+    EXPECT_EQ(std::string(closed[0].name), "inner");
+    EXPECT_EQ(closed[0].depth, 1u);
+    EXPECT_EQ(closed[0].counters[trace_counter::hashes], 1u);
+    EXPECT_EQ(closed[0].counters[trace_counter::allocated_bytes], 64u);
+    EXPECT_EQ(std::string(closed[1].name), "outer");
+    EXPECT_EQ(closed[1].depth, 0u);
+    EXPECT_EQ(closed[1].counters[trace_counter::hashes], 3u);
+    EXPECT_LE(closed[1].start_ns, closed[0].start_ns);
+    EXPECT_GE(closed[1].duration_ns, closed[0].duration_ns);
+}
+
+TEST(TracingTest, ChromeTraceTest) {
+    clear_trace();
+    enable_trace_recording(true);
+    {
+        LIBIOP_TRACE_SCOPE("prove");
+        std::thread worker([]() {
+            LIBIOP_TRACE_SCOPE("worker \"task\"");
+        });
+        worker.join();
+    }
+    enable_trace_recording(false);
+    {
+        LIBIOP_TRACE_SCOPE("not recorded");
+    }
+
+    std::stringstream out;
+    write_chrome_trace(out);
+    const std::string trace = out.str();
+    EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    EXPECT_NE(trace.find("{\"name\":\"prove\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"prove\",\"ph\":\"E\""), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"worker \\\"task\\\"\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_EQ(trace.find("not recorded"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"C\""), std::string::npos);
+
+    clear_trace();
+    std::stringstream empty;
+    write_chrome_trace(empty);
+    EXPECT_EQ(empty.str().find("prove"), std::string::npos);
+}
+
+#else
+
+TEST(TracingTest, DisabledTest) {
+    /* The arguments are not evaluated when tracing is compiled out */
+    std::size_t evaluations = 0;
+    LIBIOP_TRACE_COUNT(hashes, ++evaluations);
+    LIBIOP_TRACE_SCOPE("unused");
+    EXPECT_EQ(evaluations, 0u);
+}
+
+#endif // TRACING
+
+}
@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <map>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <libff/algebra/fields/binary/gf64.hpp>
+#include "libiop/algebra/utils.hpp"
+#include "libiop/iop/utilities/evaluation_cache.hpp"
+
+namespace libiop {
+
+TEST(OracleEvaluationCacheTest, MatchesMapTest) {
+    typedef libff::gf64 FieldT;
+    const std::size_t domain_size = 64;
+    const std::size_t num_batches = 10;
+
+    oracle_evaluation_cache<FieldT> cache;
+    std::map<std::size_t, FieldT> expected;
+    for (std::size_t batch = 0; batch < num_batches; ++batch)
+    {
+        /* Unsorted positions with repeats, including ones already cached */
+        std::vector<std::size_t> positions;
+        std::vector<FieldT> values;
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            positions.emplace_back(std::rand() % domain_size);
+            values.emplace_back(FieldT::random_element());
+            expected[positions.back()] = values.back();
+        }
+        cache.insert(positions, values);
+
+        const std::size_t single_position = std::rand() % domain_size;
+        const FieldT single_value = FieldT::random_element();
+        cache.insert(single_position, single_value);
+        expected[single_position] = single_value;
+    }
+
+    ASSERT_EQ(cache.size(), expected.size());
+    for (std::size_t position = 0; position < domain_size; ++position)
+    {
+        const FieldT *value = cache.find(position);
+        if (expected.count(position) == 1)
+        {
+            ASSERT_TRUE(value != nullptr);
+            EXPECT_TRUE(*value == expected[position]);
+        }
+        else
+        {
+            EXPECT_TRUE(value == nullptr);
+        }
+    }
+}
+
+}
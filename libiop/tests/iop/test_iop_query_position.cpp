@@ -29,7 +29,7 @@ void run_query_to_queries_for_entire_coset_test(
         IOP.register_deterministic_query_position(
             { },
             [initial_query_pos]
-            (const std::vector<std::size_t> &seed_positions)
+            (const temporary_vector<std::size_t> &seed_positions)
             -> std::size_t {
                 return initial_query_pos;
             });
@@ -16,7 +16,7 @@
 namespace libiop {
 
 template<typename FieldT>
-void run_test(field_subset_type domain_type) {
+void run_test(field_subset_type domain_type, const bool use_lagrange = false) {
 for (std::size_t constraint_domain_dim = 7; constraint_domain_dim < 9; constraint_domain_dim++) {
 for (std::size_t variable_domain_dim = 7; variable_domain_dim < 9; variable_domain_dim++) {
     std::size_t input_variable_domain_dim = variable_domain_dim - 2;
@@ -70,14 +70,15 @@ for (std::size_t variable_domain_dim = 7; variable_domain_dim < 9; variable_doma
 
         const size_t dummy_security_parameter = 64;
         const bool holographic = false;
-        const encoded_aurora_parameters<FieldT> params(dummy_security_parameter,
-                                                       codeword_domain_dim,
-                                                       constraint_domain_dim,
-                                                       summation_domain.dimension(),
-                                                       query_bound,
-                                                       make_zk,
-                                                       holographic,
-                                                       domain_type);
+        encoded_aurora_parameters<FieldT> params(dummy_security_parameter,
+                                                 codeword_domain_dim,
+                                                 constraint_domain_dim,
+                                                 summation_domain.dimension(),
+                                                 query_bound,
+                                                 make_zk,
+                                                 holographic,
+                                                 domain_type);
+        params.multi_lincheck_params_.set_use_lagrange(use_lagrange);
 
         encoded_aurora_protocol<FieldT> proto(IOP,
                                               constraint_domain_handle,
@@ -119,4 +120,16 @@ TEST(R1CSMultiplicativeProtocolTest, R1CSTest) {
     run_test<FieldT>(multiplicative_coset_type);
 }
 
+/* The lincheck polynomials are evaluated at query points by barycentric interpolation */
+TEST(R1CSAdditiveProtocolTest, LagrangeLincheckTest) {
+    typedef libff::gf64 FieldT;
+    run_test<FieldT>(affine_subspace_type, true);
+}
+
+TEST(R1CSMultiplicativeProtocolTest, LagrangeLincheckTest) {
+    libff::edwards_pp::init_public_params();
+    typedef libff::edwards_Fr FieldT;
+    run_test<FieldT>(multiplicative_coset_type, true);
+}
+
 }
\ No newline at end of file
@@ -205,7 +205,7 @@ void run_multi_lincheck_test(
 
     multi_lincheck.set_challenge(alpha, r_Mz);
 
-    std::vector<std::shared_ptr<std::vector<FieldT>>> constituent_codewords;
+    std::vector<shared_buffer<FieldT>> constituent_codewords;
     constituent_codewords.emplace_back(
         std::make_shared<std::vector<FieldT>>(fz_over_codeword_domain));
     for (std::size_t i = 0; i < Mzs_over_codeword_domain.size(); i++) {
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdint>
 #include <stdexcept>
 
@@ -42,7 +43,7 @@ void run_indexer_test(
     indexer.register_oracles();
     IOP.seal_interaction_registrations();
     IOP.seal_query_registrations();
-    indexer.compute_oracles();
+    matrix_indexer<FieldT>::compute_oracles({&indexer});
     const std::vector<FieldT> row_codeword =
         *IOP.get_oracle_evaluations(indexer.get_all_oracle_handles()[0]).get();
     const std::vector<FieldT> col_codeword =
@@ -154,6 +155,75 @@ void run_all_indexer_tests()
     }
 }
 
+/** Indexes all three matrices of an R1CS instance together, which under MULTICORE
+ *  runs their low degree extensions concurrently over one fresh codeword domain,
+ *  and checks the oracles against extending each one serially. */
+template<typename FieldT>
+void run_concurrent_indexer_test(const std::size_t domain_dim)
+{
+    const std::size_t num_constraints = 1 << domain_dim;
+    const std::size_t num_inputs = (1 << (domain_dim - 2)) - 1;
+    const std::size_t num_variables = (1 << domain_dim) - 1;
+    r1cs_example<FieldT> r1cs_params = generate_r1cs_example<FieldT>(
+        num_constraints, num_inputs, num_variables);
+    std::shared_ptr<r1cs_constraint_system<FieldT> > cs =
+        std::make_shared<r1cs_constraint_system<FieldT> >(r1cs_params.constraint_system_);
+    const std::vector<r1cs_sparse_matrix_type> matrix_types = {
+        r1cs_sparse_matrix_A, r1cs_sparse_matrix_B, r1cs_sparse_matrix_C};
+    std::vector<std::shared_ptr<sparse_matrix<FieldT>>> matrices;
+    size_t max_num_nonzero_entries = 0;
+    for (const r1cs_sparse_matrix_type matrix_type : matrix_types)
+    {
+        matrices.emplace_back(std::make_shared<r1cs_sparse_matrix<FieldT>>(cs, matrix_type));
+        max_num_nonzero_entries = std::max(max_num_nonzero_entries, matrices.back()->num_nonzero_entries());
+    }
+
+    const size_t codeword_domain_dim = 4 + domain_dim;
+    const size_t indexing_domain_dim = libff::log2(max_num_nonzero_entries);
+    field_subset<FieldT> unshifted_codeword_domain(1ull << codeword_domain_dim);
+    FieldT shift = unshifted_codeword_domain.element_outside_of_subset();
+
+    iop_protocol<FieldT> IOP;
+    const domain_handle codeword_domain_handle =
+        IOP.register_domain(field_subset<FieldT>(1ull << codeword_domain_dim, shift));
+    const domain_handle summation_domain_handle =
+        IOP.register_domain(field_subset<FieldT>(1ull << domain_dim));
+    const domain_handle indexing_domain_handle =
+        IOP.register_domain(field_subset<FieldT>(1ull << indexing_domain_dim));
+    const size_t input_variable_dim = 0;
+
+    std::vector<std::shared_ptr<matrix_indexer<FieldT>>> indexers;
+    std::vector<matrix_indexer<FieldT>*> indexers_to_compute;
+    for (const std::shared_ptr<sparse_matrix<FieldT>> &matrix : matrices)
+    {
+        indexers.emplace_back(std::make_shared<matrix_indexer<FieldT>>(
+            IOP,
+            indexing_domain_handle,
+            summation_domain_handle,
+            codeword_domain_handle,
+            input_variable_dim,
+            matrix));
+        indexers.back()->register_oracles();
+        indexers_to_compute.emplace_back(indexers.back().get());
+    }
+    IOP.seal_interaction_registrations();
+    IOP.seal_query_registrations();
+    matrix_indexer<FieldT>::compute_oracles(indexers_to_compute);
+
+    /* Both the handles and the oracles over K are in the order row, col, val, row * col */
+    for (std::shared_ptr<matrix_indexer<FieldT>> &indexer : indexers)
+    {
+        const std::vector<std::vector<FieldT>> oracles_over_K = indexer->compute_oracles_over_K();
+        const std::vector<oracle_handle_ptr> handles = indexer->get_all_oracle_handles();
+        for (size_t j = 0; j < oracles_over_K.size(); j++)
+        {
+            const std::vector<FieldT> expected =
+                indexer->extend_oracle_to_codeword_domain(oracles_over_K[j]);
+            EXPECT_TRUE(*IOP.get_oracle_evaluations(handles[j]) == expected) << "oracle " << j;
+        }
+    }
+}
+
 TEST(AdditiveTests, IndexerTest) {
     run_all_indexer_tests<libff::gf64>();
     run_all_indexer_tests<libff::gf128>();
@@ -168,4 +238,13 @@ TEST(MultiplicativeTests, IndexerTest) {
     run_all_indexer_tests<libff::alt_bn128_Fr>();
 }
 
+TEST(MultiplicativeTests, ConcurrentIndexerTest) {
+    libff::edwards_pp::init_public_params();
+    run_concurrent_indexer_test<libff::edwards_Fr>(8);
+}
+
+TEST(AdditiveTests, ConcurrentIndexerTest) {
+    run_concurrent_indexer_test<libff::gf64>(8);
+}
+
 }
\ No newline at end of file
@@ -127,10 +127,12 @@ for (std::size_t summation_domain_dim = 7; summation_domain_dim < 9; summation_d
         IOP.seal_interaction_registrations();
 
         IOP.seal_query_registrations();
+        std::vector<matrix_indexer<FieldT>*> indexers_to_compute;
         for (size_t i = 0; i < matrices.size(); i++)
         {
-            matrix_indexers[i]->compute_oracles();
+            indexers_to_compute.emplace_back(matrix_indexers[i].get());
         }
+        matrix_indexer<FieldT>::compute_oracles(indexers_to_compute);
         IOP.signal_index_submissions_done();
 
         /* Proving */
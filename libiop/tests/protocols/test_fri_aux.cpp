@@ -107,7 +107,7 @@ void run_calculate_next_coset_query_positions_test(
         IOP.register_deterministic_query_position(
             { },
             [initial_query_pos]
-            (const std::vector<std::size_t> &seed_positions)
+            (const temporary_vector<std::size_t> &seed_positions)
             -> std::size_t {
                 return initial_query_pos;
             });
@@ -8,6 +8,7 @@
 #include "libiop/algebra/utils.hpp"
 #include "libiop/protocols/ldt/fri/fri_aux.hpp"
 #include "libiop/protocols/ldt/fri/argument_size_optimizer.hpp"
+#include "libiop/protocols/ldt/fri/prover_time_optimizer.hpp"
 #include "libiop/snark/fri_snark.hpp"
 #include "libiop/algebra/field_subset/field_subset.hpp"
 #include "libiop/algebra/polynomials/polynomial.hpp"
@@ -56,6 +57,112 @@ TEST(FriOptimizerPredictedProofSizeTest, OptimizerTest)
     ASSERT_GE(max_delta, abs(percentage_differrence));
 }
 
+prover_cost_model example_prover_cost_model()
+{
+    prover_cost_model model;
+    model.FFT_seconds_per_element_level = 1e-8;
+    model.leaf_hash_seconds_per_element = 5e-8;
+    model.compression_hash_seconds = 4e-7;
+    model.FRI_fold_seconds_per_element = 3e-8;
+    model.hash_size_in_bytes = 32;
+    return model;
+}
+
+TEST(FriOptimizerPredictedProverTimeTest, MonotonicityTest)
+{
+    typedef libff::gf192 FieldT;
+    const prover_cost_model model = example_prover_cost_model();
+    const std::vector<size_t> locality_vector = {1, 2};
+    const std::vector<size_t> localization_vector = {1, 2, 2};
+    const size_t num_queries = 32;
+    const size_t codeword_dim = 16;
+
+    const prover_cost_prediction base = prover_cost_predictor<FieldT>(
+        model, locality_vector, localization_vector, codeword_dim, num_queries, 1, 1ull << 14, 10);
+    /* More proof of work, a larger codeword domain, or more FRI repetitions all cost prover time */
+    const prover_cost_prediction more_pow = prover_cost_predictor<FieldT>(
+        model, locality_vector, localization_vector, codeword_dim, num_queries, 1, 1ull << 14, 20);
+    const prover_cost_prediction larger_domain = prover_cost_predictor<FieldT>(
+        model, locality_vector, localization_vector, codeword_dim + 1, num_queries, 1, 1ull << 14, 10);
+    const prover_cost_prediction more_repetitions = prover_cost_predictor<FieldT>(
+        model, locality_vector, localization_vector, codeword_dim, num_queries, 2, 1ull << 14, 10);
+    ASSERT_LT(base.prover_seconds, more_pow.prover_seconds);
+    ASSERT_EQ(base.peak_memory_bytes, more_pow.peak_memory_bytes);
+    ASSERT_EQ(base.argument_size_bytes, more_pow.argument_size_bytes);
+    ASSERT_LT(base.prover_seconds, larger_domain.prover_seconds);
+    ASSERT_LT(base.peak_memory_bytes, larger_domain.peak_memory_bytes);
+    ASSERT_LT(base.prover_seconds, more_repetitions.prover_seconds);
+    ASSERT_LT(base.peak_memory_bytes, more_repetitions.peak_memory_bytes);
+
+    /* Each input oracle is a full codeword of 24 byte elements,
+     * and the Merkle trees and FRI codewords are no larger than that in total. */
+    const size_t input_oracle_bytes = 3 * (1ull << codeword_dim) * 24;
+    ASSERT_LE(input_oracle_bytes, base.peak_memory_bytes);
+    ASSERT_LE(base.peak_memory_bytes, 3 * input_oracle_bytes);
+}
+
+TEST(FriOptimizerPredictedProverTimeTest, BudgetTest)
+{
+    typedef libff::gf192 FieldT;
+    const prover_cost_model model = example_prover_cost_model();
+    const std::vector<size_t> locality_vector = {1, 1};
+    const size_t codeword_dim = 18;
+    const size_t interactive_repetitions = 1;
+    const size_t num_queries = 32;
+    const size_t max_tested_degree = 1ull << 16;
+    const size_t pow_bits = 0;
+
+    const std::vector<size_t> smallest = compute_argument_size_optimal_localization_parameters<FieldT>(
+        locality_vector, codeword_dim, num_queries, interactive_repetitions, max_tested_degree,
+        model.hash_size_in_bytes);
+    const size_t smallest_size = argument_size_predictor<FieldT>(
+        locality_vector, smallest, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, model.hash_size_in_bytes);
+
+    const std::vector<size_t> unconstrained = compute_prover_time_optimal_localization_parameters<FieldT>(
+        model, locality_vector, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, pow_bits, (size_t)-1);
+    const std::vector<size_t> constrained = compute_prover_time_optimal_localization_parameters<FieldT>(
+        model, locality_vector, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, pow_bits, smallest_size);
+    const std::vector<size_t> impossible = compute_prover_time_optimal_localization_parameters<FieldT>(
+        model, locality_vector, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, pow_bits, smallest_size - 1);
+    ASSERT_FALSE(unconstrained.empty());
+    ASSERT_FALSE(constrained.empty());
+    ASSERT_TRUE(impossible.empty());
+
+    const prover_cost_prediction fastest = prover_cost_predictor<FieldT>(
+        model, locality_vector, unconstrained, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, pow_bits);
+    const prover_cost_prediction within_budget = prover_cost_predictor<FieldT>(
+        model, locality_vector, constrained, codeword_dim, num_queries, interactive_repetitions,
+        max_tested_degree, pow_bits);
+    ASSERT_LE(within_budget.argument_size_bytes, smallest_size);
+    ASSERT_LE(fastest.prover_seconds, within_budget.prover_seconds);
+}
+
+TEST(FriOptimizerPredictedProverTimeTest, SmallDegreeTest)
+{
+    typedef libff::gf192 FieldT;
+    const prover_cost_model model = example_prover_cost_model();
+    const std::vector<size_t> locality_vector = {1};
+    const size_t codeword_dim = 6;
+    const size_t interactive_repetitions = 1;
+    const size_t num_queries = 4;
+    const size_t pow_bits = 0;
+
+    /* Too small a degree to keep the minimum final dimension only gets the single round */
+    for (size_t max_tested_degree : {1, 2, 4, 8})
+    {
+        const std::vector<size_t> localization_parameters =
+            compute_prover_time_optimal_localization_parameters<FieldT>(
+                model, locality_vector, codeword_dim, num_queries, interactive_repetitions,
+                max_tested_degree, pow_bits, (size_t)-1);
+        ASSERT_EQ(std::vector<size_t>({1}), localization_parameters);
+    }
+}
+
 /* Test that all localization vectors of the correct size are produced */
 // TEST(LocalizationVectorGeneratorTests, OptimizerAuxTest) {
 //     std::vector<std::vector<size_t>> all_loc_vector_size_3 =
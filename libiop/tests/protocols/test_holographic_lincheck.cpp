@@ -107,10 +107,12 @@ void run_black_box_multi_lincheck_test(
 
     IOP.seal_interaction_registrations();
     IOP.seal_query_registrations();
+    std::vector<matrix_indexer<FieldT>*> indexers_to_compute;
     for (size_t i = 0; i < matrices.size(); i++)
     {
-        matrix_indexers[i]->compute_oracles();
+        indexers_to_compute.emplace_back(matrix_indexers[i].get());
     }
+    matrix_indexer<FieldT>::compute_oracles(indexers_to_compute);
     IOP.signal_index_submissions_done();
     IOP.submit_oracle(fz_handle, fz_over_codeword_domain);
     for (std::size_t i = 0; i < matrices.size(); i++) {
@@ -120,6 +120,17 @@ void test_oracle_consistency(iop_protocol<FieldT> &IOP,
                              const oracle_handle_ptr &handle,
                              const std::vector<FieldT> &oracle_evals,
                              const field_subset<FieldT> &codeword_domain) {
+    /* Check the batched path first, so that it computes values rather than reading the cache */
+    temporary_vector<std::size_t> evaluation_indices(temporary_resource());
+    for (std::size_t i = 0; i < 10; i++) {
+        evaluation_indices.emplace_back(std::rand() % codeword_domain.num_elements());
+    }
+    const temporary_vector<FieldT> batch_evals = IOP.get_oracle_evaluations_at_points(handle, evaluation_indices, false);
+    for (std::size_t i = 0; i < evaluation_indices.size(); i++) {
+        EXPECT_TRUE(batch_evals[i] == oracle_evals[evaluation_indices[i]]) <<
+            "batched evaluation was inconsistent at index " << evaluation_indices[i];
+    }
+
     for (std::size_t i = 0; i < 10; i++) {
         std::size_t evaluation_index = std::rand() % codeword_domain.num_elements();
         const FieldT point_eval = IOP.get_oracle_evaluation_at_point(handle, evaluation_index, false);
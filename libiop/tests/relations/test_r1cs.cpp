@@ -32,6 +32,37 @@ TEST(R1CSTest, SimpleTest) {
     EXPECT_FALSE(constraints.is_satisfied({r}, {r}));
 }
 
+TEST(R1CSTest, AzBzCzTest) {
+    typedef libff::gf64 FieldT;
+    const std::size_t num_constraints = 1ull << 10;
+    const std::size_t num_inputs = 15;
+    const std::size_t num_variables = (1ull << 10) - 1;
+    r1cs_example<FieldT> example = generate_r1cs_example<FieldT>(
+        num_constraints, num_inputs, num_variables);
+    const r1cs_constraint_system<FieldT> &cs = example.constraint_system_;
+
+    const r1cs_variable_assignment<FieldT> x =
+        variable_assignment_from_inputs(example.primary_input_, example.auxiliary_input_);
+    std::vector<FieldT> z({ FieldT::one() });
+    z.insert(z.end(), x.begin(), x.end());
+
+    std::vector<FieldT> Az, Bz, Cz;
+    cs.create_Az_Bz_Cz_from_variable_assignment(z, Az, Bz, Cz);
+    ASSERT_EQ(Az.size(), num_constraints);
+    for (std::size_t i = 0; i < num_constraints; ++i)
+    {
+        ASSERT_TRUE(Az[i] == cs.constraints_[i].a_.evaluate(x));
+        ASSERT_TRUE(Bz[i] == cs.constraints_[i].b_.evaluate(x));
+        ASSERT_TRUE(Cz[i] == cs.constraints_[i].c_.evaluate(x));
+        ASSERT_TRUE(Az[i] * Bz[i] == Cz[i]);
+    }
+
+    /* Corrupting one variable must be caught */
+    r1cs_auxiliary_input<FieldT> bad_auxiliary_input = example.auxiliary_input_;
+    bad_auxiliary_input.back() += FieldT::one();
+    EXPECT_FALSE(cs.is_satisfied(example.primary_input_, bad_auxiliary_input));
+}
+
 TEST(R1CSGeneratorTest, SimpleTests) {
     for (std::size_t variable_dim = 8; variable_dim < 10; variable_dim++) {
         for (std::size_t constraint_dim = 8; constraint_dim < 10; constraint_dim++) {
@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <libff/algebra/fields/binary/gf64.hpp>
+#include "libiop/algebra/utils.hpp"
+#include "libiop/relations/sparse_matrix.hpp"
+
+namespace libiop {
+
+template<typename FieldT>
+naive_sparse_matrix<FieldT> random_naive_matrix(const size_t num_rows,
+                                                const size_t num_columns,
+                                                const size_t entries_per_row)
+{
+    naive_sparse_matrix<FieldT> matrix(num_rows);
+    for (size_t i = 0; i < num_rows; i++)
+    {
+        for (size_t k = 0; k < entries_per_row; k++)
+        {
+            matrix[i][std::rand() % num_columns] = FieldT::random_element();
+        }
+    }
+    return matrix;
+}
+
+template<typename FieldT>
+std::vector<FieldT> naive_transpose_multiply(const naive_sparse_matrix<FieldT> &matrix,
+                                             const std::vector<FieldT> &r,
+                                             const size_t num_columns)
+{
+    std::vector<FieldT> result(num_columns, FieldT::zero());
+    for (size_t i = 0; i < matrix.size(); i++)
+    {
+        for (auto &entry : matrix[i])
+        {
+            result[entry.first] += r[i] * entry.second;
+        }
+    }
+    return result;
+}
+
+TEST(CompressedColumnMatrixTest, TransposeMultiplyTest) {
+    typedef libff::gf64 FieldT;
+    const size_t num_rows = 300;
+    const size_t num_columns = 517;
+    const size_t num_vectors = 3;
+    const naive_sparse_matrix<FieldT> matrix = random_naive_matrix<FieldT>(num_rows, num_columns, 5);
+    const compressed_column_matrix<FieldT> csc(matrix, num_columns);
+    ASSERT_EQ(csc.num_rows(), num_rows);
+    ASSERT_EQ(csc.num_columns(), num_columns);
+
+    size_t num_nonzero = 0;
+    for (auto &row : matrix)
+    {
+        num_nonzero += row.size();
+    }
+    ASSERT_EQ(csc.num_nonzero_entries(), num_nonzero);
+
+    std::vector<std::vector<FieldT>> vectors;
+    for (size_t h = 0; h < num_vectors; h++)
+    {
+        vectors.emplace_back(random_vector<FieldT>(num_rows));
+    }
+    const std::vector<std::vector<FieldT>> products = csc.transpose_multiply(vectors);
+    ASSERT_EQ(products.size(), num_vectors);
+    for (size_t h = 0; h < num_vectors; h++)
+    {
+        ASSERT_TRUE(products[h] == naive_transpose_multiply<FieldT>(matrix, vectors[h], num_columns));
+    }
+}
+
+TEST(CompressedColumnMatrixTest, BoundsTest) {
+    typedef libff::gf64 FieldT;
+    naive_sparse_matrix<FieldT> matrix(2);
+    matrix[1][4] = FieldT::one();
+    EXPECT_THROW(compressed_column_matrix<FieldT>(matrix, 4), std::invalid_argument);
+
+    const compressed_column_matrix<FieldT> csc(matrix, 5);
+    const std::vector<std::vector<FieldT>> wrong_length = { std::vector<FieldT>(3, FieldT::one()) };
+    EXPECT_THROW(csc.transpose_multiply(wrong_length), std::invalid_argument);
+}
+
+}
@@ -63,6 +63,93 @@ TEST(AuroraSnarkTest, SimpleTest) {
     }
 }
 
+TEST(AuroraSnarkTest, ProverTimeOptimizerTest) {
+    typedef libff::gf64 FieldT;
+    typedef binary_hash_digest hash_type;
+
+    const std::size_t num_constraints = 1 << 10;
+    const std::size_t num_inputs = (1 << 5) - 1;
+    const std::size_t num_variables = (1 << 10) - 1;
+    const size_t security_parameter = 128;
+    const size_t max_argument_size_in_bytes = 250000;
+
+    r1cs_example<FieldT> r1cs_params = generate_r1cs_example<FieldT>(
+        num_constraints, num_inputs, num_variables);
+
+    aurora_snark_parameters<FieldT, hash_type> params(
+        security_parameter,
+        LDT_reducer_soundness_type::optimistic_heuristic,
+        FRI_soundness_type::heuristic,
+        blake2b_type,
+        3,
+        2,
+        true,
+        affine_subspace_type,
+        num_constraints,
+        num_variables);
+    const prover_cost_model model = calibrate_prover_cost_model<FieldT, hash_type>(
+        blake2b_type, security_parameter);
+    const prover_cost_prediction prediction =
+        params.optimize_for_prover_time(model, max_argument_size_in_bytes);
+    EXPECT_LE(prediction.argument_size_bytes, max_argument_size_in_bytes);
+    EXPECT_LT(0.0, prediction.prover_seconds);
+    EXPECT_LT(0u, prediction.peak_memory_bytes);
+
+    const aurora_snark_argument<FieldT, hash_type> argument = aurora_snark_prover<FieldT>(
+        r1cs_params.constraint_system_,
+        r1cs_params.primary_input_,
+        r1cs_params.auxiliary_input_,
+        params);
+    printf("predicted argument size in bytes %lu\n", prediction.argument_size_bytes);
+    printf("argument size in bytes %lu\n", argument.size_in_bytes());
+
+    const bool bit = aurora_snark_verifier<FieldT, hash_type>(
+        r1cs_params.constraint_system_,
+        r1cs_params.primary_input_,
+        argument,
+        params);
+    EXPECT_TRUE(bit);
+
+    /* Nothing fits in a single byte, and the parameters are left as they were */
+    const size_t RS_extra_dimensions = params.iop_params_.RS_extra_dimensions();
+    EXPECT_THROW(params.optimize_for_prover_time(model, 1), std::invalid_argument);
+    EXPECT_EQ(RS_extra_dimensions, params.iop_params_.RS_extra_dimensions());
+}
+
+TEST(AuroraSnarkTest, ProvenSoundnessProverTimeOptimizerTest) {
+    typedef libff::gf64 FieldT;
+    typedef binary_hash_digest hash_type;
+
+    const std::size_t num_constraints = 1 << 10;
+    const std::size_t num_variables = (1 << 10) - 1;
+    const size_t security_parameter = 128;
+    const size_t max_argument_size_in_bytes = 10000000;
+
+    aurora_snark_parameters<FieldT, hash_type> params(
+        security_parameter,
+        LDT_reducer_soundness_type::proven,
+        FRI_soundness_type::proven,
+        blake2b_type,
+        3,
+        3,
+        true,
+        affine_subspace_type,
+        num_constraints,
+        num_variables);
+    const prover_cost_model model = calibrate_prover_cost_model<FieldT, hash_type>(
+        blake2b_type, security_parameter);
+    const prover_cost_prediction prediction =
+        params.optimize_for_prover_time(model, max_argument_size_in_bytes);
+    EXPECT_LE(prediction.argument_size_bytes, max_argument_size_in_bytes);
+
+    /* A rate of 1/2 has no proven FRI soundness, and the chosen query count achieves the target */
+    EXPECT_LE(2u, params.iop_params_.RS_extra_dimensions());
+    const size_t query_soundness_bits =
+        security_parameter - params.bcs_params_.pow_params_.work_parameter();
+    EXPECT_LE((long double)query_soundness_bits, params.iop_params_.FRI_params_.achieved_query_soundness());
+    EXPECT_LT(params.iop_params_.FRI_params_.query_repetitions(), 1000u);
+}
+
 TEST(AuroraSnarkMultiplicativeTest, SimpleTest) {
     /* Set up R1CS */
     libff::edwards_pp::init_public_params();
@@ -117,4 +204,54 @@ TEST(AuroraSnarkMultiplicativeTest, SimpleTest) {
     }
 }
 
+TEST(AuroraSnarkMultiplicativeTest, LagrangeLincheckTest) {
+    /* Set up R1CS */
+    libff::edwards_pp::init_public_params();
+    typedef libff::edwards_Fr FieldT;
+    typedef binary_hash_digest hash_type;
+
+    const size_t num_constraints = 1 << 10;
+    const size_t num_inputs = (1 << 5) - 1;
+    const size_t num_variables = (1 << 10) - 1;
+    const size_t security_parameter = 128;
+    const size_t RS_extra_dimensions = 2;
+    const size_t FRI_localization_parameter = 3;
+    const LDT_reducer_soundness_type ldt_reducer_soundness_type = LDT_reducer_soundness_type::optimistic_heuristic;
+    const FRI_soundness_type fri_soundness_type = FRI_soundness_type::heuristic;
+    const field_subset_type domain_type = multiplicative_coset_type;
+
+    r1cs_example<FieldT> r1cs_params = generate_r1cs_example<FieldT>(
+        num_constraints, num_inputs, num_variables);
+
+    for (std::size_t i = 0; i < 2; i++) {
+        const bool make_zk = (i == 0) ? false : true;
+        aurora_snark_parameters<FieldT, hash_type> params(
+            security_parameter,
+            ldt_reducer_soundness_type,
+            fri_soundness_type,
+            blake2b_type,
+            FRI_localization_parameter,
+            RS_extra_dimensions,
+            make_zk,
+            domain_type,
+            num_constraints,
+            num_variables);
+        /* At this many queries the heuristic picks the IFFT path, so force Lagrange evaluation */
+        EXPECT_FALSE(params.iop_params_.encoded_aurora_params_.multi_lincheck_params_.use_lagrange());
+        params.iop_params_.encoded_aurora_params_.multi_lincheck_params_.set_use_lagrange(true);
+        const aurora_snark_argument<FieldT, hash_type> argument = aurora_snark_prover<FieldT>(
+            r1cs_params.constraint_system_,
+            r1cs_params.primary_input_,
+            r1cs_params.auxiliary_input_,
+            params);
+        const bool bit = aurora_snark_verifier<FieldT>(
+            r1cs_params.constraint_system_,
+            r1cs_params.primary_input_,
+            argument,
+            params);
+
+        EXPECT_TRUE(bit) << "failed on make_zk = " << i << " test";
+    }
+}
+
 }
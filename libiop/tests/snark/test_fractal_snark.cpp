@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
 
 #include <gtest/gtest.h>
 
@@ -53,6 +55,15 @@ TEST(FractalSnarkTest, SimpleTest) {
             r1cs_params.primary_input_,
             r1cs_params.auxiliary_input_,
             params);
+        /* The index is not consumed by proving, so it can be reused for another proof */
+        const fractal_snark_argument<FieldT, hash_type> second_argument =
+            fractal_snark_prover<FieldT, hash_type>(
+            index.first,
+            r1cs_params.primary_input_,
+            r1cs_params.auxiliary_input_,
+            params);
+        EXPECT_TRUE(fractal_snark_verifier<FieldT, hash_type>(
+            index.second, r1cs_params.primary_input_, second_argument, params));
 
         printf("iop size in bytes %lu\n", argument.IOP_size_in_bytes());
         printf("bcs size in bytes %lu\n", argument.BCS_size_in_bytes());
@@ -186,4 +197,96 @@ TEST(FractalAlgeraicHashTest, SimpleTest) {
     }
 }
 
+/* Writes the indices to disk, loads them back, and proves and verifies with the loaded indices */
+template<typename FieldT, typename hash_type>
+void run_index_persistence_test(const field_subset_type domain_type,
+                                const bcs_hash_type hash_enum)
+{
+    /* Set up R1CS */
+    const std::size_t num_constraints = 1 << 8;
+    const std::size_t num_inputs = (1 << 3) - 1;
+    const std::size_t num_variables = (1 << 8) - 1;
+    const size_t security_parameter = 128;
+    const size_t RS_extra_dimensions = 2;
+    const size_t FRI_localization_parameter = 3;
+    const LDT_reducer_soundness_type ldt_reducer_soundness_type = LDT_reducer_soundness_type::optimistic_heuristic;
+    const FRI_soundness_type fri_soundness_type = FRI_soundness_type::heuristic;
+
+    r1cs_example<FieldT> r1cs_params = generate_r1cs_example<FieldT>(
+        num_constraints, num_inputs, num_variables);
+    std::shared_ptr<r1cs_constraint_system<FieldT>> cs =
+        std::make_shared<r1cs_constraint_system<FieldT>>(r1cs_params.constraint_system_);
+
+    const std::string prover_index_path = "test_fractal_prover_index.bin";
+    const std::string verifier_index_path = "test_fractal_verifier_index.bin";
+    for (std::size_t i = 0; i < 2; i++) {
+        const bool make_zk = (i == 0) ? false : true;
+        fractal_snark_parameters<FieldT, hash_type> params(
+            security_parameter,
+            ldt_reducer_soundness_type,
+            fri_soundness_type,
+            hash_enum,
+            FRI_localization_parameter,
+            RS_extra_dimensions,
+            make_zk,
+            domain_type,
+            cs);
+        std::pair<bcs_prover_index<FieldT, hash_type>, bcs_verifier_index<FieldT, hash_type>> index =
+            fractal_snark_indexer(params);
+        save_bcs_prover_index(prover_index_path, index.first);
+        save_bcs_verifier_index(verifier_index_path, index.second);
+
+        bcs_prover_index<FieldT, hash_type> loaded_prover_index =
+            load_bcs_prover_index<FieldT, hash_type>(prover_index_path, params.bcs_params_);
+        const bcs_verifier_index<FieldT, hash_type> loaded_verifier_index =
+            load_bcs_verifier_index<FieldT, hash_type>(verifier_index_path);
+        EXPECT_EQ(loaded_verifier_index.index_MT_roots_, index.second.index_MT_roots_);
+        EXPECT_EQ(loaded_verifier_index.indexed_messages_, index.second.indexed_messages_);
+        ASSERT_EQ(loaded_prover_index.iop_index_.all_oracle_evals_.size(),
+                  index.first.iop_index_.all_oracle_evals_.size());
+        for (std::size_t j = 0; j < index.first.iop_index_.all_oracle_evals_.size(); j++)
+        {
+            const shared_buffer<FieldT> &loaded = loaded_prover_index.iop_index_.all_oracle_evals_[j];
+            const shared_buffer<FieldT> &original = index.first.iop_index_.all_oracle_evals_[j];
+            EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), original.begin(), original.end()));
+        }
+
+        /* The loaded index views the file's mapping, which outlives the file's name */
+        std::remove(prover_index_path.c_str());
+
+        const fractal_snark_argument<FieldT, hash_type> argument =
+            fractal_snark_prover<FieldT, hash_type>(
+            loaded_prover_index,
+            r1cs_params.primary_input_,
+            r1cs_params.auxiliary_input_,
+            params);
+        const bool bit = fractal_snark_verifier<FieldT, hash_type>(
+            loaded_verifier_index,
+            r1cs_params.primary_input_,
+            argument,
+            params);
+
+        EXPECT_TRUE(bit) << "failed on make_zk = " << i << " test";
+    }
+    std::remove(prover_index_path.c_str());
+    std::remove(verifier_index_path.c_str());
+}
+
+TEST(FractalSnarkIndexPersistenceTest, SimpleTest) {
+    run_index_persistence_test<libff::gf64, binary_hash_digest>(affine_subspace_type, blake2b_type);
+}
+
+TEST(FractalSnarkIndexPersistenceTest, MultiplicativeTest) {
+    /* Prime field elements are stored in Montgomery form */
+    libff::edwards_pp::init_public_params();
+    run_index_persistence_test<libff::edwards_Fr, binary_hash_digest>(multiplicative_coset_type, blake2b_type);
+}
+
+TEST(FractalSnarkIndexPersistenceTest, AlgebraicHashTest) {
+    /* Merkle tree digests are themselves field elements */
+    libff::alt_bn128_pp::init_public_params();
+    typedef libff::alt_bn128_Fr FieldT;
+    run_index_persistence_test<FieldT, FieldT>(multiplicative_coset_type, starkware_poseidon_type);
+}
+
 }
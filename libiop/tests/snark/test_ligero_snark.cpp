@@ -85,4 +85,120 @@ TEST(InterleavedR1CSSnarkMultiplicativeTest, SimpleTest) {
     EXPECT_TRUE(bit);
 }
 
+TEST(InterleavedR1CSSnarkTest, MatrixShapeOptimizerTest) {
+    typedef libff::gf64 FieldT;
+
+    prover_cost_model model;
+    model.FFT_seconds_per_element_level = 1e-8;
+    model.leaf_hash_seconds_per_element = 1e-7;
+    model.compression_hash_seconds = 5e-7;
+    model.FRI_fold_seconds_per_element = 1e-8;
+
+    for (std::size_t i = 0; i < 2; i++)
+    {
+        ligero_snark_parameters<FieldT, binary_hash_digest> parameters;
+        parameters.security_level_ = 128;
+        parameters.height_width_ratio_ = 0.1;
+        parameters.RS_extra_dimensions_ = 2;
+        parameters.make_zk_ = (i == 1);
+        parameters.domain_type_ = affine_subspace_type;
+        parameters.LDT_reducer_soundness_type_ = LDT_reducer_soundness_type::proven;
+
+        const std::size_t num_constraints = 1ull << 12;
+        const std::size_t num_variables = (1ull << 12) - 1;
+        const ligero_iop_parameters<FieldT> default_iop_params(
+            parameters.security_level_, parameters.LDT_reducer_soundness_type_,
+            parameters.RS_extra_dimensions_, parameters.height_width_ratio_,
+            parameters.make_zk_, parameters.domain_type_, num_constraints, num_variables);
+        const ligero_cost_prediction default_prediction = ligero_cost_predictor<FieldT>(model, default_iop_params);
+
+        const ligero_cost_prediction fastest = parameters.optimize_matrix_shape(
+            model, ligero_objective::prover_time, num_constraints, num_variables);
+        const ligero_cost_prediction smallest = parameters.optimize_matrix_shape(
+            model, ligero_objective::argument_size, num_constraints, num_variables);
+        const ligero_cost_prediction fastest_verifier = parameters.optimize_matrix_shape(
+            model, ligero_objective::verifier_time, num_constraints, num_variables);
+        EXPECT_TRUE(parameters.matrix_shape_optimized_);
+        EXPECT_TRUE(parameters.objective_ == ligero_objective::verifier_time);
+
+        /* Each optimum is at least as good as a hand picked shape, and as the other optima */
+        EXPECT_LE(fastest.prover_seconds, default_prediction.prover_seconds);
+        EXPECT_LE(smallest.argument_size_bytes, default_prediction.argument_size_bytes);
+        EXPECT_LE(fastest_verifier.verifier_seconds, default_prediction.verifier_seconds);
+        EXPECT_LE(fastest.prover_seconds, smallest.prover_seconds);
+        EXPECT_LE(smallest.argument_size_bytes, fastest.argument_size_bytes);
+        EXPECT_LE(fastest_verifier.verifier_seconds, fastest.verifier_seconds);
+
+        /* The chosen shape is the one the prediction was made for */
+        const ligero_iop_parameters<FieldT> chosen_iop_params(
+            parameters.security_level_, parameters.LDT_reducer_soundness_type_,
+            parameters.RS_extra_dimensions_, parameters.height_width_ratio_,
+            parameters.make_zk_, parameters.domain_type_, num_constraints, num_variables);
+        EXPECT_EQ(ligero_cost_predictor<FieldT>(model, chosen_iop_params).verifier_seconds,
+                  fastest_verifier.verifier_seconds);
+    }
+
+    /* An optimized shape gives a valid proof */
+    std::size_t num_constraints = 16;
+    std::size_t constraint_dim = 4;
+    std::size_t num_inputs = 8;
+    std::size_t num_variables = 15;
+    r1cs_example<FieldT> ex = generate_r1cs_example<FieldT>(num_constraints, num_inputs, num_variables);
+
+    ligero_snark_parameters<FieldT, binary_hash_digest> parameters;
+    parameters.security_level_ = 128;
+    parameters.make_zk_ = true;
+    parameters.domain_type_ = affine_subspace_type;
+    parameters.LDT_reducer_soundness_type_ = LDT_reducer_soundness_type::proven;
+    parameters.bcs_params_ = default_bcs_params<FieldT, binary_hash_digest>(
+        blake2b_type, parameters.security_level_, constraint_dim);
+    parameters.optimize_matrix_shape(model, ligero_objective::argument_size,
+                                     ex.constraint_system_.num_constraints(),
+                                     ex.constraint_system_.num_variables());
+    parameters.describe();
+
+    const ligero_snark_argument<FieldT, binary_hash_digest> argument =
+        ligero_snark_prover<FieldT>(ex.constraint_system_, ex.primary_input_, ex.auxiliary_input_, parameters);
+    const bool bit = ligero_snark_verifier<FieldT, binary_hash_digest>(
+        ex.constraint_system_, ex.primary_input_, argument, parameters);
+    EXPECT_TRUE(bit);
+}
+
+TEST(InterleavedR1CSSnarkTest, ProvenMatrixShapeTest) {
+    typedef libff::gf64 FieldT;
+
+    prover_cost_model model;
+    model.FFT_seconds_per_element_level = 1e-8;
+    model.leaf_hash_seconds_per_element = 1e-7;
+    model.compression_hash_seconds = 5e-7;
+    model.FRI_fold_seconds_per_element = 1e-8;
+
+    for (std::size_t i = 0; i < 2; i++)
+    {
+        for (const std::size_t num_variables : {15, (1 << 10) - 1})
+        {
+            ligero_snark_parameters<FieldT, binary_hash_digest> parameters;
+            parameters.security_level_ = 128;
+            parameters.make_zk_ = (i == 1);
+            parameters.domain_type_ = affine_subspace_type;
+            parameters.LDT_reducer_soundness_type_ = LDT_reducer_soundness_type::proven;
+            const std::size_t num_constraints = num_variables + 1;
+            parameters.optimize_matrix_shape(model, ligero_objective::argument_size,
+                                             num_constraints, num_variables);
+
+            /* The stored shape is used as is, rather than having extra dimensions added again */
+            const ligero_iop_parameters<FieldT> chosen_iop_params(
+                parameters.security_level_, parameters.LDT_reducer_soundness_type_,
+                parameters.RS_extra_dimensions_, parameters.height_width_ratio_,
+                parameters.make_zk_, parameters.domain_type_, num_constraints, num_variables);
+            EXPECT_EQ(parameters.RS_extra_dimensions_, chosen_iop_params.RS_extra_dimensions());
+            EXPECT_LE(2u, parameters.RS_extra_dimensions_);
+            if (!parameters.make_zk_)
+            {
+                EXPECT_GE(chosen_iop_params.achieved_soundness(), (long double)parameters.security_level_);
+            }
+        }
+    }
+}
+
 }